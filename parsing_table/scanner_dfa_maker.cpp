@@ -0,0 +1,296 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <map>
+#include <string>
+#include <cctype>
+#include <cstdio>
+#include "../src/scanner_dfa.h" // States, actions and token types shared with the scanner
+
+// Generates the transition table of the table-driven scanner (src/scanner_dfa.c)
+// from the lexical specification below. Bytes which behave identically in every
+// state are merged into one equivalence class, so the table has one column per
+// class instead of one column per byte.
+using namespace std;
+
+#define INPUT_EOF (-1)
+
+// Character groups mirroring scanner_charIdentity()
+enum CharGroup { G_LETTER, G_NUMBER, G_WHITESPACE, G_NOT_IN_LANGUAGE, G_SIMPLE, G_COMPLEX, G_EOF, G_INVALID };
+
+CharGroup charGroup(int c) {
+    if(c == INPUT_EOF)                  return G_EOF;
+    if(isalpha(c) || c == '_')          return G_LETTER;
+    if(isdigit(c))                      return G_NUMBER;
+    if(isspace(c))                      return G_WHITESPACE;
+    if(string("#$%&'^`~").find((char)c) != string::npos || c >= ADL)
+                                        return G_NOT_IN_LANGUAGE;
+    if(string("()*+,-:;{|}").find((char)c) != string::npos)
+                                        return G_SIMPLE;
+    if(string("!\"./<=>?@[\\]").find((char)c) != string::npos)
+                                        return G_COMPLEX;
+    return G_INVALID;
+}
+
+ScannerDFA_Transition go(ScannerDFA_State next, ScannerDFA_Action action) {
+    return { (uint8_t)next, (uint8_t)action, 0 };
+}
+
+ScannerDFA_Transition accept(TokenType token) {
+    return { DFA_START, DFA_ACTION_ACCEPT, (uint8_t)token };
+}
+
+ScannerDFA_Transition acceptUnget(TokenType token) {
+    return { DFA_START, DFA_ACTION_ACCEPT_UNGET, (uint8_t)token };
+}
+
+ScannerDFA_Transition error() {
+    return { DFA_START, DFA_ACTION_ERROR, 0 };
+}
+
+// Token is finished by whitespace (consumed) or by an operator/EOF (returned to input)
+ScannerDFA_Transition finish(TokenType token, int c) {
+    switch(charGroup(c)) {
+        case G_WHITESPACE:      return accept(token);
+        case G_NOT_IN_LANGUAGE:
+        case G_INVALID:         return error();
+        default:                return acceptUnget(token);
+    }
+}
+
+// Expect exactly one character, whitespace may be skipped if allowed
+ScannerDFA_Transition expect(int c, int expected, ScannerDFA_Transition onMatch,
+                             ScannerDFA_State self, bool skipSpace) {
+    if(c == expected)                                  return onMatch;
+    if(skipSpace && charGroup(c) == G_WHITESPACE)      return go(self, DFA_ACTION_SKIP);
+    return error();
+}
+
+// Lexical specification: transition for state `s` on input `c`
+ScannerDFA_Transition spec(ScannerDFA_State s, int c) {
+    CharGroup group = charGroup(c);
+
+    switch(s) {
+        case DFA_START:
+            switch(group) {
+                case G_LETTER:          return go(DFA_IDENTIFIER, DFA_ACTION_APPEND);
+                case G_NUMBER:          return go(DFA_INT, DFA_ACTION_APPEND);
+                case G_WHITESPACE:      return go(DFA_START, DFA_ACTION_SKIP);
+                case G_EOF:             return acceptUnget(TOKEN_EOF);
+                case G_NOT_IN_LANGUAGE:
+                case G_INVALID:         return error();
+                default:                break;
+            }
+            switch(c) {
+                case '(':  return accept(TOKEN_LEFT_PARENTHESIS);
+                case ')':  return accept(TOKEN_RIGHT_PARENTHESIS);
+                case '*':  return accept(TOKEN_ASTERISK);
+                case '+':  return accept(TOKEN_PLUS);
+                case ',':  return accept(TOKEN_COMMA);
+                case '-':  return accept(TOKEN_MINUS);
+                case ':':  return accept(TOKEN_COLON);
+                case ';':  return accept(TOKEN_SEMICOLON);
+                case '{':  return accept(TOKEN_LEFT_CURLY_BRACKET);
+                case '|':  return accept(TOKEN_VERTICAL_BAR);
+                case '}':  return accept(TOKEN_RIGHT_CURLY_BRACKET);
+                case '.':  return accept(TOKEN_PERIOD);
+                case '!':  return go(DFA_EXCLAMATION, DFA_ACTION_SKIP);
+                case '<':  return go(DFA_LESS, DFA_ACTION_SKIP);
+                case '>':  return go(DFA_GREATER, DFA_ACTION_SKIP);
+                case '=':  return go(DFA_EQUAL, DFA_ACTION_SKIP);
+                case '/':  return go(DFA_SLASH, DFA_ACTION_SKIP);
+                case '@':  return go(DFA_AT, DFA_ACTION_SKIP);
+                case '[':  return go(DFA_U8_A, DFA_ACTION_SKIP);
+                case '?':  return go(DFA_QMARK, DFA_ACTION_SKIP);
+                case '"':  return go(DFA_STRING, DFA_ACTION_SKIP);
+                case '\\': return go(DFA_BACKSLASH, DFA_ACTION_SKIP);
+                default:   return error();  // ']'
+            }
+
+        case DFA_IDENTIFIER:
+            if(group == G_LETTER || group == G_NUMBER) return go(DFA_IDENTIFIER, DFA_ACTION_APPEND);
+            return finish(TOKEN_IDENTIFIER, c);
+
+        case DFA_INT:
+            if(group == G_NUMBER)   return go(DFA_INT, DFA_ACTION_APPEND);
+            if(c == 'e')            return go(DFA_FLOAT_EXP, DFA_ACTION_APPEND);
+            if(c == '.')            return go(DFA_FLOAT_PERIOD, DFA_ACTION_APPEND);
+            if(group == G_LETTER)   return error();
+            return finish(TOKEN_INT, c);
+
+        case DFA_FLOAT_PERIOD:
+            if(group == G_NUMBER)   return go(DFA_FLOAT, DFA_ACTION_APPEND);
+            return error();
+
+        case DFA_FLOAT:
+            if(group == G_NUMBER)   return go(DFA_FLOAT, DFA_ACTION_APPEND);
+            if(c == 'e')            return go(DFA_FLOAT_EXP, DFA_ACTION_APPEND);
+            if(group == G_LETTER)   return error();
+            return finish(TOKEN_FLOAT, c);
+
+        case DFA_FLOAT_EXP:
+            if(group == G_NUMBER || c == '+' || c == '-')
+                                    return go(DFA_FLOAT_EXP_DIGITS, DFA_ACTION_APPEND);
+            return error();
+
+        case DFA_FLOAT_EXP_DIGITS:
+            if(group == G_NUMBER)   return go(DFA_FLOAT_EXP_DIGITS, DFA_ACTION_APPEND);
+            if(group == G_LETTER)   return error();
+            return finish(TOKEN_FLOAT, c);
+
+        case DFA_EXCLAMATION:
+            return c == '=' ? accept(TOKEN_NOT_EQUAL_TO) : error();
+
+        case DFA_LESS:
+            return c == '=' ? accept(TOKEN_LESS_EQUAL_THAN) : acceptUnget(TOKEN_LESS_THAN);
+
+        case DFA_GREATER:
+            return c == '=' ? accept(TOKEN_GREATER_EQUAL_THAN) : acceptUnget(TOKEN_GREATER_THAN);
+
+        case DFA_EQUAL:
+            return c == '=' ? accept(TOKEN_EQUAL_TO) : acceptUnget(TOKEN_EQUALITY_SIGN);
+
+        case DFA_SLASH:
+            if(c == '/')                    return go(DFA_COMMENT, DFA_ACTION_SKIP);
+            if(group == G_NOT_IN_LANGUAGE || group == G_INVALID)
+                                            return error();
+            if(group == G_WHITESPACE)       return accept(TOKEN_SLASH);
+            return acceptUnget(TOKEN_SLASH);
+
+        case DFA_COMMENT:
+            if(c == '\n')           return go(DFA_START, DFA_ACTION_SKIP);
+            if(group == G_EOF)      return acceptUnget(TOKEN_EOF);
+            if(group == G_INVALID)  return error();
+            return go(DFA_COMMENT, DFA_ACTION_SKIP);
+
+        case DFA_AT:        return c == 'i' ? go(DFA_AT_I, DFA_ACTION_SKIP) : error();
+        case DFA_AT_I:      return c == 'm' ? go(DFA_AT_IM, DFA_ACTION_SKIP) : error();
+        case DFA_AT_IM:     return c == 'p' ? go(DFA_AT_IMP, DFA_ACTION_SKIP) : error();
+        case DFA_AT_IMP:    return c == 'o' ? go(DFA_AT_IMPO, DFA_ACTION_SKIP) : error();
+        case DFA_AT_IMPO:   return c == 'r' ? go(DFA_AT_IMPOR, DFA_ACTION_SKIP) : error();
+        case DFA_AT_IMPOR:  return c == 't' ? go(DFA_AT_IMPORT, DFA_ACTION_SKIP) : error();
+        case DFA_AT_IMPORT:
+            if(group == G_LETTER)   return error();
+            return finish(TOKEN_K_import, c);
+
+        case DFA_U8_A:       return expect(c, ']', go(DFA_U8_B, DFA_ACTION_SKIP), s, true);
+        case DFA_U8_B:       return expect(c, 'u', go(DFA_U8_C, DFA_ACTION_SKIP), s, true);
+        case DFA_U8_C:       return expect(c, '8', accept(TOKEN_K_u8), s, false);
+
+        case DFA_QMARK:
+            if(c == 'i')            return go(DFA_QMARK_I, DFA_ACTION_SKIP);
+            if(c == 'f')            return go(DFA_QMARK_F, DFA_ACTION_SKIP);
+            return expect(c, '[', go(DFA_QMARK_U8_A, DFA_ACTION_SKIP), s, true);
+        case DFA_QMARK_I:    return expect(c, '3', go(DFA_QMARK_I3, DFA_ACTION_SKIP), s, false);
+        case DFA_QMARK_I3:   return expect(c, '2', accept(TOKEN_K_Qi32), s, false);
+        case DFA_QMARK_F:    return expect(c, '6', go(DFA_QMARK_F6, DFA_ACTION_SKIP), s, false);
+        case DFA_QMARK_F6:   return expect(c, '4', accept(TOKEN_K_Qf64), s, false);
+        case DFA_QMARK_U8_A: return expect(c, ']', go(DFA_QMARK_U8_B, DFA_ACTION_SKIP), s, true);
+        case DFA_QMARK_U8_B: return expect(c, 'u', go(DFA_QMARK_U8_C, DFA_ACTION_SKIP), s, true);
+        case DFA_QMARK_U8_C: return expect(c, '8', accept(TOKEN_K_Qu8), s, false);
+
+        case DFA_STRING:
+            if(c == '"')            return accept(TOKEN_STRING);
+            if(c == '\\')           return go(DFA_STRING_ESCAPE, DFA_ACTION_SKIP);
+            if(group == G_EOF)      return error();
+            return go(DFA_STRING, DFA_ACTION_APPEND);
+
+        case DFA_STRING_ESCAPE:
+            switch(c) {
+                case '"':
+                case '\\': return go(DFA_STRING, DFA_ACTION_APPEND);
+                case 'n':  return go(DFA_STRING, DFA_ACTION_APPEND_LF);
+                case 'r':  return go(DFA_STRING, DFA_ACTION_APPEND_CR);
+                case 't':  return go(DFA_STRING, DFA_ACTION_APPEND_TAB);
+                case 'x':  return go(DFA_STRING_HEX_A, DFA_ACTION_SKIP);
+                default:   return error();
+            }
+
+        case DFA_STRING_HEX_A:
+            return (c != INPUT_EOF && isxdigit(c)) ? go(DFA_STRING_HEX_B, DFA_ACTION_HEX_HIGH) : error();
+
+        case DFA_STRING_HEX_B:
+            return (c != INPUT_EOF && isxdigit(c)) ? go(DFA_STRING, DFA_ACTION_HEX_LOW) : error();
+
+        case DFA_BACKSLASH:
+            return c == '\\' ? go(DFA_ML_STRING, DFA_ACTION_SKIP) : error();
+
+        case DFA_ML_STRING:
+            if(c == '\n')           return go(DFA_ML_STRING_LF, DFA_ACTION_SKIP);
+            if(group == G_EOF)      return error();
+            return go(DFA_ML_STRING, DFA_ACTION_APPEND);
+
+        case DFA_ML_STRING_LF:
+            if(c == ' ')            return go(DFA_ML_STRING_LF, DFA_ACTION_SKIP);
+            if(c == '\\')           return go(DFA_ML_STRING_LF_BACKSLASH, DFA_ACTION_SKIP);
+            return acceptUnget(TOKEN_STRING);
+
+        case DFA_ML_STRING_LF_BACKSLASH:
+            return c == '\\' ? go(DFA_ML_STRING, DFA_ACTION_APPEND_LF) : error();
+
+        default:
+            return error();
+    }
+}
+
+static const char *stateNames[DFA_STATE_COUNT] = {
+    "DFA_START", "DFA_IDENTIFIER", "DFA_INT", "DFA_FLOAT_PERIOD", "DFA_FLOAT",
+    "DFA_FLOAT_EXP", "DFA_FLOAT_EXP_DIGITS", "DFA_EXCLAMATION", "DFA_LESS",
+    "DFA_GREATER", "DFA_EQUAL", "DFA_SLASH", "DFA_COMMENT", "DFA_AT", "DFA_AT_I",
+    "DFA_AT_IM", "DFA_AT_IMP", "DFA_AT_IMPO", "DFA_AT_IMPOR", "DFA_AT_IMPORT",
+    "DFA_U8_A", "DFA_U8_B", "DFA_U8_C", "DFA_QMARK", "DFA_QMARK_I", "DFA_QMARK_I3",
+    "DFA_QMARK_F", "DFA_QMARK_F6", "DFA_QMARK_U8_A", "DFA_QMARK_U8_B",
+    "DFA_QMARK_U8_C", "DFA_STRING", "DFA_STRING_ESCAPE", "DFA_STRING_HEX_A",
+    "DFA_STRING_HEX_B", "DFA_BACKSLASH", "DFA_ML_STRING", "DFA_ML_STRING_LF",
+    "DFA_ML_STRING_LF_BACKSLASH"
+};
+
+int main() {
+    // Column of the full table for every input (index 0 is EOF, index c + 1 is byte c)
+    vector<vector<uint32_t>> columns(SCANNER_DFA_INPUT_COUNT);
+    for(int input = 0; input < SCANNER_DFA_INPUT_COUNT; input++) {
+        for(int s = 0; s < DFA_STATE_COUNT; s++) {
+            ScannerDFA_Transition t = spec((ScannerDFA_State)s, input - 1);
+            columns[input].push_back((uint32_t)t.next << 16 | (uint32_t)t.action << 8 | t.token);
+        }
+    }
+
+    // Merge identical columns into equivalence classes
+    map<vector<uint32_t>, int> classOf;
+    vector<int> inputClass(SCANNER_DFA_INPUT_COUNT);
+    vector<int> representative;
+    for(int input = 0; input < SCANNER_DFA_INPUT_COUNT; input++) {
+        auto it = classOf.find(columns[input]);
+        if(it == classOf.end()) {
+            it = classOf.emplace(columns[input], (int)representative.size()).first;
+            representative.push_back(input);
+        }
+        inputClass[input] = it->second;
+    }
+
+    cout << "#define SCANNER_DFA_CLASS_COUNT " << representative.size() << endl << endl;
+
+    cout << "static const uint8_t scannerDFA_classTable[SCANNER_DFA_INPUT_COUNT] = {" << endl;
+    for(int input = 0; input < SCANNER_DFA_INPUT_COUNT; input++) {
+        if(input % 16 == 0) cout << "    ";
+        cout << setw(2) << inputClass[input] << ",";
+        cout << ((input % 16 == 15 || input == SCANNER_DFA_INPUT_COUNT - 1) ? "\n" : " ");
+    }
+    cout << "};" << endl << endl;
+
+    cout << "static const ScannerDFA_Transition scannerDFA_table[DFA_STATE_COUNT][SCANNER_DFA_CLASS_COUNT] = {" << endl;
+    for(int s = 0; s < DFA_STATE_COUNT; s++) {
+        cout << "    /* " << stateNames[s] << " */" << endl << "    {";
+        for(size_t cls = 0; cls < representative.size(); cls++) {
+            ScannerDFA_Transition t = spec((ScannerDFA_State)s, representative[cls] - 1);
+            if(cls % 8 == 0) cout << endl << "        ";
+            cout << "{" << setw(2) << (int)t.next << "," << (int)t.action << ","
+                 << setw(2) << (int)t.token << "}";
+            if(cls + 1 < representative.size()) cout << ", ";
+        }
+        cout << endl << "    }" << (s + 1 < DFA_STATE_COUNT ? "," : "") << endl;
+    }
+    cout << "};" << endl;
+
+    return 0;
+}
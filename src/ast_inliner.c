@@ -0,0 +1,379 @@
+/*******************************************************************************
+ *                                                                             *
+ * Název projektu:   Implementace překladače imperativního jazyka IFJ24        *
+ *                                                                             *
+ * Soubor:           ast_inliner.c                                             *
+ * Autor:            Krejčí David   <xkrejcd00>                                *
+ *                                                                             *
+ * Datum:            04.12.2024                                                *
+ * Poslední změna:   04.12.2024                                                *
+ *                                                                             *
+ * Tým:      Tým xkalinj00                                                     *
+ * Členové:  Farkašovský Lukáš    <xfarkal00>                                  *
+ *           Hýža Pavel           <xhyzapa00>                                  *
+ *           Kalina Jan           <xkalinj00>                                  *
+ *           Krejčí David         <xkrejcd00>                                  *
+ *                                                                             *
+ ******************************************************************************/
+/**
+ * @file ast_inliner.c
+ * @author Krejčí David \<xkrejcd00>
+ *
+ * @brief Implementace funkcí pro vkládání malých funkcí do místa volání.
+ * @details Implementace funkcí z hlavičkového souboru ast_inliner.h
+ */
+
+#include "ast_inliner.h"
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                        IMPLEMENTACE VEŘEJNÝCH FUNKCÍ                        *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Vloží malé listové funkce do míst jejich volání v celém programu.
+ */
+void ASTinliner_inlineProgram() {
+    if(ASTroot == NULL) {
+        return;
+    }
+
+    // Projdeme těla všech funkcí
+    AST_FunDefNode *funDefNode = ASTroot->functionList;
+    while(funDefNode != NULL) {
+        ASTinliner_inlineStatementBlock(funDefNode->body);
+        funDefNode = funDefNode->next;
+    }
+}  // ASTinliner_inlineProgram
+
+/**
+ * @brief Vrátí vkládanou funkci odpovídající volání.
+ */
+AST_FunDefNode *ASTinliner_findInlineable(AST_FunCallNode *funCallNode) {
+    // Vestavěné funkce řeší generátor kódu
+    if(funCallNode == NULL || funCallNode->isBuiltIn) {
+        return NULL;
+    }
+
+    // Najdeme definici volané funkce
+    AST_FunDefNode *funDefNode = ASTroot->functionList;
+    while(funDefNode != NULL) {
+        if(DString_compare(funDefNode->identifier, funCallNode->identifier) == STRING_EQUAL) {
+            break;
+        }
+        funDefNode = funDefNode->next;
+    }
+    if(funDefNode == NULL || !ASTinliner_isInlineableBody(funDefNode)) {
+        return NULL;
+    }
+
+    // Všechny argumenty musí být termy
+    AST_ArgOrParamNode *arg = funCallNode->arguments;
+    while(arg != NULL) {
+        if(arg->expression == NULL ||
+           (arg->expression->exprType != AST_EXPR_VARIABLE &&
+            arg->expression->exprType != AST_EXPR_LITERAL)) {
+            return NULL;
+        }
+        arg = arg->next;
+    }
+
+    return funDefNode;
+}  // ASTinliner_findInlineable
+
+/**
+ * @brief Zjistí, zda tělo funkce splňuje podmínky pro vložení do místa volání.
+ */
+bool ASTinliner_isInlineableBody(AST_FunDefNode *funDefNode) {
+    // Funkci main nevkládáme
+    if(DString_compareWithConstChar(funDefNode->identifier, "main") == STRING_EQUAL) {
+        return false;
+    }
+
+    // Tělo musí tvořit jediný příkaz return s výrazem
+    AST_StatementNode *body = funDefNode->body;
+    if(body == NULL || body->next != NULL ||
+       body->statementType != AST_STATEMENT_RETURN || body->statement == NULL) {
+        return false;
+    }
+
+    // Výraz nesmí volat funkce a nesmí být příliš velký
+    bool hasCall = false;
+    size_t size = ASTinliner_exprSize(body->statement, &hasCall);
+    return !hasCall && size <= INLINER_MAX_BODY_SIZE;
+}  // ASTinliner_isInlineableBody
+
+/**
+ * @brief Vytvoří hlubokou kopii výrazu.
+ */
+AST_ExprNode *ASTinliner_copyExpr(AST_ExprNode *exprNode) {
+    if(exprNode == NULL) {
+        return NULL;
+    }
+
+    AST_ExprNode *copy = AST_createExprNode();
+    if(copy == NULL) {
+        error_handle(ERROR_INTERNAL);
+    }
+    copy->exprType = exprNode->exprType;
+
+    switch(exprNode->exprType) {
+        case AST_EXPR_LITERAL:
+        case AST_EXPR_VARIABLE:
+            copy->expression = ASTinliner_copyVarNode(exprNode->expression);
+            break;
+
+        case AST_EXPR_BINARY_OP: {
+            AST_BinOpNode *binOp = exprNode->expression;
+            AST_BinOpNode *binOpCopy = AST_createBinOpNode();
+            if(binOpCopy == NULL) {
+                AST_destroyExprNode(copy);
+                error_handle(ERROR_INTERNAL);
+            }
+            binOpCopy->op = binOp->op;
+            binOpCopy->left = ASTinliner_copyExpr(binOp->left);
+            binOpCopy->right = ASTinliner_copyExpr(binOp->right);
+            copy->expression = binOpCopy;
+            break;
+        }
+
+        // Volání funkcí vkládaná funkce neobsahuje
+        default:
+            AST_destroyExprNode(copy);
+            error_handle(ERROR_INTERNAL);
+    }
+
+    return copy;
+}  // ASTinliner_copyExpr
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                        IMPLEMENTACE INTERNÍCH FUNKCÍ                        *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Projde blok příkazů a vloží v něm malé funkce.
+ */
+void ASTinliner_inlineStatementBlock(AST_StatementNode *statement) {
+    while(statement != NULL) {
+        switch(statement->statementType) {
+            case AST_STATEMENT_VAR_DEF:
+            case AST_STATEMENT_EXPR:
+            case AST_STATEMENT_RETURN:
+                ASTinliner_inlineExpr(statement->statement);
+                break;
+
+            // Samotné volání funkce nevkládáme, projdeme pouze argumenty
+            case AST_STATEMENT_FUN_CALL: {
+                AST_FunCallNode *funCallNode = statement->statement;
+                AST_ArgOrParamNode *arg = funCallNode->arguments;
+                while(arg != NULL) {
+                    ASTinliner_inlineExpr(arg->expression);
+                    arg = arg->next;
+                }
+                break;
+            }
+
+            case AST_STATEMENT_IF: {
+                AST_IfNode *ifNode = statement->statement;
+                ASTinliner_inlineExpr(ifNode->condition);
+                ASTinliner_inlineStatementBlock(ifNode->thenBranch);
+                ASTinliner_inlineStatementBlock(ifNode->elseBranch);
+                break;
+            }
+
+            case AST_STATEMENT_WHILE: {
+                AST_WhileNode *whileNode = statement->statement;
+                ASTinliner_inlineExpr(whileNode->condition);
+                ASTinliner_inlineStatementBlock(whileNode->body);
+                break;
+            }
+
+            default:
+                break;
+        }
+
+        statement = statement->next;
+    }
+}  // ASTinliner_inlineStatementBlock
+
+/**
+ * @brief Projde výraz a nahradí v něm volání malých funkcí.
+ */
+void ASTinliner_inlineExpr(AST_ExprNode *exprNode) {
+    if(exprNode == NULL || exprNode->expression == NULL) {
+        return;
+    }
+
+    if(exprNode->exprType == AST_EXPR_BINARY_OP) {
+        AST_BinOpNode *binOp = exprNode->expression;
+        ASTinliner_inlineExpr(binOp->left);
+        ASTinliner_inlineExpr(binOp->right);
+        return;
+    }
+
+    if(exprNode->exprType != AST_EXPR_FUN_CALL) {
+        return;
+    }
+
+    // Nejprve zpracujeme argumenty volání
+    AST_FunCallNode *funCallNode = exprNode->expression;
+    AST_ArgOrParamNode *arg = funCallNode->arguments;
+    while(arg != NULL) {
+        ASTinliner_inlineExpr(arg->expression);
+        arg = arg->next;
+    }
+
+    AST_FunDefNode *funDefNode = ASTinliner_findInlineable(funCallNode);
+    if(funDefNode == NULL) {
+        return;
+    }
+
+    // Zkopírujeme návratový výraz a dosadíme argumenty za parametry
+    AST_StatementNode *body = funDefNode->body;
+    AST_ExprNode *inlined = ASTinliner_copyExpr(body->statement);
+    ASTinliner_substituteParams(inlined, funDefNode, funCallNode);
+
+    // Nahradíme volání funkce vloženým výrazem
+    AST_destroyFunCallNode(funCallNode);
+    exprNode->exprType = inlined->exprType;
+    exprNode->expression = inlined->expression;
+    inlined->expression = NULL;
+    AST_destroyExprNode(inlined);
+}  // ASTinliner_inlineExpr
+
+/**
+ * @brief Nahradí v kopii návratového výrazu parametry argumenty volání.
+ */
+void ASTinliner_substituteParams(AST_ExprNode *exprNode, AST_FunDefNode *funDefNode,
+                                 AST_FunCallNode *funCallNode) {
+    if(exprNode == NULL) {
+        return;
+    }
+
+    if(exprNode->exprType == AST_EXPR_BINARY_OP) {
+        AST_BinOpNode *binOp = exprNode->expression;
+        ASTinliner_substituteParams(binOp->left, funDefNode, funCallNode);
+        ASTinliner_substituteParams(binOp->right, funDefNode, funCallNode);
+        return;
+    }
+
+    if(exprNode->exprType != AST_EXPR_VARIABLE) {
+        return;
+    }
+
+    AST_VarNode *varNode = exprNode->expression;
+
+    // Najdeme parametr se stejným identifikátorem a odpovídající argument
+    AST_ArgOrParamNode *param = funDefNode->parameters;
+    AST_ArgOrParamNode *arg = funCallNode->arguments;
+    while(param != NULL && arg != NULL) {
+        AST_VarNode *paramVar = param->expression->expression;
+        if(paramVar->frameID == varNode->frameID &&
+           DString_compare(paramVar->identifier, varNode->identifier) == STRING_EQUAL) {
+            AST_destroyVarNode(varNode);
+            exprNode->exprType = arg->expression->exprType;
+            exprNode->expression = ASTinliner_copyVarNode(arg->expression->expression);
+            return;
+        }
+        param = param->next;
+        arg = arg->next;
+    }
+}  // ASTinliner_substituteParams
+
+/**
+ * @brief Spočítá počet uzlů výrazu.
+ */
+size_t ASTinliner_exprSize(AST_ExprNode *exprNode, bool *hasCall) {
+    if(exprNode == NULL) {
+        return 0;
+    }
+
+    switch(exprNode->exprType) {
+        case AST_EXPR_BINARY_OP: {
+            AST_BinOpNode *binOp = exprNode->expression;
+            return 1 + ASTinliner_exprSize(binOp->left, hasCall) +
+                       ASTinliner_exprSize(binOp->right, hasCall);
+        }
+
+        case AST_EXPR_FUN_CALL:
+            *hasCall = true;
+            return 1;
+
+        default:
+            return 1;
+    }
+}  // ASTinliner_exprSize
+
+/**
+ * @brief Vytvoří hlubokou kopii uzlu proměnné nebo literálu.
+ */
+AST_VarNode *ASTinliner_copyVarNode(AST_VarNode *varNode) {
+    AST_VarNode *copy = AST_createVarNode(varNode->type);
+    if(copy == NULL) {
+        error_handle(ERROR_INTERNAL);
+    }
+    copy->frameID = varNode->frameID;
+    copy->literalType = varNode->literalType;
+
+    // Zkopírujeme identifikátor
+    if(varNode->identifier != NULL) {
+        copy->identifier = DString_init();
+        if(copy->identifier == NULL ||
+           DString_copy(varNode->identifier, copy->identifier) != STRING_SUCCESS) {
+            AST_destroyVarNode(copy);
+            error_handle(ERROR_INTERNAL);
+        }
+    }
+
+    // Zkopírujeme hodnotu literálu podle jeho typu
+    if(varNode->value != NULL) {
+        switch(varNode->literalType) {
+            case AST_LITERAL_INT:
+                copy->value = malloc(sizeof(int));
+                if(copy->value != NULL) {
+                    *(int *)copy->value = *(int *)varNode->value;
+                }
+                break;
+
+            case AST_LITERAL_FLOAT:
+                copy->value = malloc(sizeof(double));
+                if(copy->value != NULL) {
+                    *(double *)copy->value = *(double *)varNode->value;
+                }
+                break;
+
+            case AST_LITERAL_BOOL:
+                copy->value = malloc(sizeof(bool));
+                if(copy->value != NULL) {
+                    *(bool *)copy->value = *(bool *)varNode->value;
+                }
+                break;
+
+            case AST_LITERAL_STRING:
+                copy->value = DString_init();
+                if(copy->value != NULL &&
+                   DString_copy(varNode->value, copy->value) != STRING_SUCCESS) {
+                    DString_free(copy->value);
+                    copy->value = NULL;
+                }
+                break;
+
+            default:
+                return copy;
+        }
+
+        if(copy->value == NULL) {
+            AST_destroyVarNode(copy);
+            error_handle(ERROR_INTERNAL);
+        }
+    }
+
+    return copy;
+}  // ASTinliner_copyVarNode
+
+/*** Konec souboru ast_inliner.c ***/
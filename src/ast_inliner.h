@@ -0,0 +1,156 @@
+/*******************************************************************************
+ *                                                                             *
+ * Název projektu:   Implementace překladače imperativního jazyka IFJ24        *
+ *                                                                             *
+ * Soubor:           ast_inliner.h                                             *
+ * Autor:            Krejčí David   <xkrejcd00>                                *
+ *                                                                             *
+ * Datum:            04.12.2024                                                *
+ * Poslední změna:   04.12.2024                                                *
+ *                                                                             *
+ * Tým:      Tým xkalinj00                                                     *
+ * Členové:  Farkašovský Lukáš    <xfarkal00>                                  *
+ *           Hýža Pavel           <xhyzapa00>                                  *
+ *           Kalina Jan           <xkalinj00>                                  *
+ *           Krejčí David         <xkrejcd00>                                  *
+ *                                                                             *
+ ******************************************************************************/
+/**
+ * @file ast_inliner.h
+ * @author Krejčí David \<xkrejcd00>
+ *
+ * @brief Hlavičkový soubor pro vkládání malých funkcí do místa volání.
+ * @details Průchod nad sémanticky zkontrolovaným AST nahradí volání malých
+ *          listových funkcí (tělo tvoří jediný příkaz `return` s výrazem bez
+ *          volání funkcí) kopií jejich návratového výrazu, ve kterém jsou
+ *          parametry nahrazeny argumenty volání. Ušetří se tak vytvoření
+ *          rámce, `CALL`, `PUSHFRAME`, `POPFRAME` a `RETURN` v interpretu.
+ */
+
+#ifndef AST_INLINER_H_
+/** @cond  */
+#define AST_INLINER_H_
+/** @endcond  */
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include "ast_nodes.h"
+#include "ast_interface.h"
+#include "dynamic_string.h"
+#include "error.h"
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                              DEFINICE KONSTANT                              *
+ *                                                                             *
+ ******************************************************************************/
+
+#define INLINER_MAX_BODY_SIZE 15    /**< Maximální počet uzlů návratového výrazu vkládané funkce */
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                         DEKLARACE VEŘEJNÝCH FUNKCÍ                          *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Vloží malé listové funkce do míst jejich volání v celém programu.
+ *
+ * @details Funkce je vložena, pokud:
+ *          - není to funkce `main`,
+ *          - její tělo tvoří jediný příkaz `return` s výrazem,
+ *          - výraz neobsahuje žádné volání funkce (funkce tedy nemůže být
+ *            rekurzivní) a má nejvýše @c INLINER_MAX_BODY_SIZE uzlů,
+ *          - všechny argumenty volání jsou termy (proměnné nebo literály).
+ *
+ *          Protože argumenty jsou termy bez vedlejších efektů, lze jimi
+ *          parametry přímo nahradit a není potřeba zavádět nové proměnné.
+ *          Musí být voláno až po sémantické analýze programu.
+ */
+void ASTinliner_inlineProgram();
+
+/**
+ * @brief Vrátí vkládanou funkci odpovídající volání.
+ *
+ * @param [in] funCallNode Ukazatel na uzel volání funkce
+ *
+ * @return Ukazatel na definici funkce, pokud lze volání nahradit, jinak `NULL`.
+ */
+AST_FunDefNode *ASTinliner_findInlineable(AST_FunCallNode *funCallNode);
+
+/**
+ * @brief Zjistí, zda tělo funkce splňuje podmínky pro vložení do místa volání.
+ *
+ * @details Nekontroluje argumenty konkrétního volání, kladné výsledky jsou
+ *          proto nadmnožinou skutečně vložených funkcí.
+ *
+ * @param [in] funDefNode Ukazatel na definici funkce
+ *
+ * @return `true`, pokud funkci lze vložit, jinak `false`.
+ */
+bool ASTinliner_isInlineableBody(AST_FunDefNode *funDefNode);
+
+/**
+ * @brief Vytvoří hlubokou kopii výrazu.
+ *
+ * @param [in] exprNode Ukazatel na kopírovaný výraz
+ *
+ * @return Ukazatel na nový výraz.
+ */
+AST_ExprNode *ASTinliner_copyExpr(AST_ExprNode *exprNode);
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                         DEKLARACE INTERNÍCH FUNKCÍ                          *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Projde blok příkazů a vloží v něm malé funkce.
+ *
+ * @param [in] statement Ukazatel na první příkaz bloku
+ */
+void ASTinliner_inlineStatementBlock(AST_StatementNode *statement);
+
+/**
+ * @brief Projde výraz a nahradí v něm volání malých funkcí.
+ *
+ * @param [in,out] exprNode Ukazatel na výraz
+ */
+void ASTinliner_inlineExpr(AST_ExprNode *exprNode);
+
+/**
+ * @brief Nahradí v kopii návratového výrazu parametry argumenty volání.
+ *
+ * @param [in,out] exprNode Ukazatel na kopii návratového výrazu
+ * @param [in] funDefNode Ukazatel na definici vkládané funkce
+ * @param [in] funCallNode Ukazatel na uzel volání funkce
+ */
+void ASTinliner_substituteParams(AST_ExprNode *exprNode, AST_FunDefNode *funDefNode,
+                                 AST_FunCallNode *funCallNode);
+
+/**
+ * @brief Spočítá počet uzlů výrazu.
+ *
+ * @param [in] exprNode Ukazatel na výraz
+ * @param [out] hasCall Nastaví se na `true`, pokud výraz obsahuje volání funkce
+ *
+ * @return Počet uzlů výrazu.
+ */
+size_t ASTinliner_exprSize(AST_ExprNode *exprNode, bool *hasCall);
+
+/**
+ * @brief Vytvoří hlubokou kopii uzlu proměnné nebo literálu.
+ *
+ * @param [in] varNode Ukazatel na kopírovaný uzel
+ *
+ * @return Ukazatel na nový uzel.
+ */
+AST_VarNode *ASTinliner_copyVarNode(AST_VarNode *varNode);
+
+#endif // AST_INLINER_H_
+
+/*** Konec souboru ast_inliner.h ***/
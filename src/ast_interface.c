@@ -415,25 +415,23 @@ void AST_initNewVarNode(AST_VarNode *node, AST_NodeType type, DString *identifie
     node->frameID = frameID;
     node->literalType = literalType;
 
-    // Pomocná proměnná pro funkce "strtol" a "strtod"
-    char *endptr;       // Ukazatel na první neplatný znak po čísle
-
     // Převod hodnoty na příslušný datový typ na základě "literalType"
     switch(literalType) {
         // Obsah DString bude převeden na integer "i32"
         case AST_LITERAL_INT: {
             // Provádíme bezpečný převod řetězce na integer
-            long intValue = strtol(value->str, &endptr, INT_CONVERTION_BASE);
+            int64_t intValue;
+            bool isValid = numberLiteral_parseInt(value->str, value->length, &intValue);
 
-            // Kontrola přetečení nebo podtečení - ostatní sémantická chyba (10)
-            if(intValue < INT_MIN || intValue > INT_MAX) {
-                parser_errorWatcher(SET_ERROR_SEM_OTHER);
+            // Kontrola neplatného vstupu - způsobeno špatnou tvorbou tokenu
+            if(!isValid) {
+                parser_errorWatcher(SET_ERROR_INTERNAL);
                 break;
             }
 
-            // Kontrola neplatného vstupu - způsobeno špatnou tvorbou tokenu
-            if(*endptr != '\0') {
-                parser_errorWatcher(SET_ERROR_INTERNAL);
+            // Kontrola přetečení nebo podtečení - ostatní sémantická chyba (10)
+            if(intValue < INT_MIN || intValue > INT_MAX) {
+                parser_errorWatcher(SET_ERROR_SEM_OTHER);
                 break;
             }
 
@@ -458,17 +456,18 @@ void AST_initNewVarNode(AST_VarNode *node, AST_NodeType type, DString *identifie
         // Obsah DString bude převeden na double "f64"
         case AST_LITERAL_FLOAT: {
             // Provádíme bezpečný převod řetězce na double
-            double floatValue = strtod(value->str, &endptr);
+            double floatValue;
+            bool isValid = numberLiteral_parseFloat(value->str, value->length, &floatValue);
 
-            // Kontrola přetečení nebo podtečení - ostatní sémantická chyba (10)
-            if(floatValue == HUGE_VAL || floatValue == -HUGE_VAL) {
-                parser_errorWatcher(SET_ERROR_SEM_OTHER);
+            // Kontrola neplatného vstupu - způsobeno špatnou tvorbou tokenu
+            if(!isValid) {
+                parser_errorWatcher(SET_ERROR_INTERNAL);
                 break;
             }
 
-            // Kontrola neplatného vstupu - způsobeno špatnou tvorbou tokenu
-            if(*endptr != '\0') {
-                parser_errorWatcher(SET_ERROR_INTERNAL);
+            // Kontrola přetečení nebo podtečení - ostatní sémantická chyba (10)
+            if(floatValue == HUGE_VAL || floatValue == -HUGE_VAL) {
+                parser_errorWatcher(SET_ERROR_SEM_OTHER);
                 break;
             }
 
@@ -44,15 +44,7 @@
 
 // Import sdílených knihoven překladače
 #include "error.h"
-
-
-/*******************************************************************************
- *                                                                             *
- *                              DEFINICE KONSTANT                              *
- *                                                                             *
- ******************************************************************************/
-
-#define INT_CONVERTION_BASE 10      /**< Základ pro číslo dekadické soustavy při převodu pomocí "strtol" */
+#include "number_literal.h"
 
 
 /*******************************************************************************
@@ -0,0 +1,1332 @@
+/*******************************************************************************
+ *                                                                             *
+ * Název projektu:   Implementace překladače imperativního jazyka IFJ24        *
+ *                                                                             *
+ * Soubor:           ast_serializer.c                                          *
+ * Autor:            Jan Kalina   <xkalinj00>                                  *
+ *                                                                             *
+ * Datum:            04.12.2024                                                *
+ * Poslední změna:   04.12.2024                                                *
+ *                                                                             *
+ * Tým:      Tým xkalinj00                                                     *
+ * Členové:  Farkašovský Lukáš    <xfarkal00>                                  *
+ *           Hýža Pavel           <xhyzapa00>                                  *
+ *           Kalina Jan           <xkalinj00>                                  *
+ *           Krejčí David         <xkrejcd00>                                  *
+ *                                                                             *
+ ******************************************************************************/
+/**
+ * @file ast_serializer.c
+ * @author Kalina Jan \<xkalinj00>
+ *
+ * @brief Implementace binární serializace abstraktního syntaktického stromu.
+ * @details Seznamy (funkce, parametry, příkazy) se zapisují i sestavují
+ *          iterativně, rekurze se používá jen pro vnořené bloky a výrazy.
+ *          Čísla jsou uložena v nativním pořadí bajtů, soubor je tedy vázán
+ *          na konkrétní stroj stejně jako cache tokenů.
+ */
+
+// Deklarace funkcí "mmap" a "munmap" při překladu se standardem C17
+#define _POSIX_C_SOURCE 200809L
+
+#include <string.h>
+#include "ast_serializer.h"
+#include "scanner_input.h"
+#include "token_cache.h"
+#include "parser_common.h"
+#include "frame_stack.h"
+#include "symtable.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                        IMPLEMENTACE VEŘEJNÝCH FUNKCÍ                        *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Uloží AST programu do souboru.
+ */
+bool ASTserializer_saveProgram(const char *path, uint64_t inputHash, uint64_t inputLength) {
+    if(path == NULL || ASTroot == NULL) {
+        return false;
+    }
+
+    ASTserializer_Buffer buffer = { NULL, 0, 0, NULL, 0, 0, false };
+
+    // Kořen programu má vždy index 0, potomci jsou zapsáni za ním
+    uint32_t root = ASTserializer_addNode(&buffer, AST_PROGRAM_NODE);
+    uint32_t importedFile = ASTserializer_writeVar(&buffer, ASTroot->importedFile);
+    uint32_t functionList = ASTserializer_writeFunDefList(&buffer, ASTroot->functionList);
+    if(!buffer.failed) {
+        buffer.nodes[root].child[0] = importedFile;
+        buffer.nodes[root].child[1] = functionList;
+    }
+
+    bool written = false;
+    char temporaryPath[AST_SERIALIZER_PATH_SIZE + 8];
+    snprintf(temporaryPath, sizeof(temporaryPath), "%s.tmp", path);
+
+    FILE *file = buffer.failed ? NULL : fopen(temporaryPath, "wb");
+    if(file != NULL) {
+        ASTserializer_Header header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, AST_SERIALIZER_MAGIC, AST_SERIALIZER_MAGIC_SIZE);
+        header.version = AST_SERIALIZER_VERSION;
+        header.nodeCount = (uint32_t)buffer.nodeCount;
+        header.inputHash = inputHash;
+        header.inputLength = inputLength;
+        header.stringsSize = buffer.stringsSize;
+        header.frameCount = frameStack.currentID;
+        header.checksum = ASTserializer_checksum(AST_SERIALIZER_CHECKSUM_BASIS, buffer.nodes,
+                                                 buffer.nodeCount * sizeof(ASTserializer_Node));
+        header.checksum = ASTserializer_checksum(header.checksum, buffer.strings,
+                                                 buffer.stringsSize);
+
+        written = fwrite(&header, sizeof(header), 1, file) == 1 &&
+                  fwrite(buffer.nodes, sizeof(ASTserializer_Node), buffer.nodeCount, file) ==
+                        buffer.nodeCount &&
+                  fwrite(buffer.strings, 1, buffer.stringsSize, file) == buffer.stringsSize;
+
+        // Soubor přejmenujeme až po úplném zápisu
+        if(fclose(file) != 0 || !written || rename(temporaryPath, path) != 0) {
+            remove(temporaryPath);
+            written = false;
+        }
+    }
+
+    free(buffer.nodes);
+    free(buffer.strings);
+
+    return written;
+}  // ASTserializer_saveProgram()
+
+/**
+ * @brief Načte AST programu ze souboru.
+ */
+bool ASTserializer_loadProgram(const char *path, uint64_t inputHash, uint64_t inputLength) {
+    if(path == NULL || ASTroot != NULL) {
+        return false;
+    }
+
+    size_t size = 0;
+    const char *data = ASTserializer_mapFile(path, &size);
+    if(data == NULL) {
+        return false;
+    }
+
+    // Hlavička musí odpovídat formátu i vstupu, velikost souboru obsahu
+    // a kontrolní součet uzlům a řetězcům za hlavičkou
+    ASTserializer_Header header;
+    bool valid = size >= sizeof(header);
+    if(valid) {
+        memcpy(&header, data, sizeof(header));
+        size_t nodesSize = (size_t)header.nodeCount * sizeof(ASTserializer_Node);
+        valid = memcmp(header.magic, AST_SERIALIZER_MAGIC, AST_SERIALIZER_MAGIC_SIZE) == 0 &&
+                header.version == AST_SERIALIZER_VERSION && header.inputHash == inputHash &&
+                header.inputLength == inputLength && header.nodeCount > 0 &&
+                header.frameCount <= header.nodeCount &&
+                size - sizeof(header) >= nodesSize &&
+                header.stringsSize == size - sizeof(header) - nodesSize &&
+                header.checksum == ASTserializer_checksum(AST_SERIALIZER_CHECKSUM_BASIS,
+                                                          data + sizeof(header),
+                                                          size - sizeof(header));
+    }
+
+    ASTserializer_View view = { NULL, 0, NULL, 0, 0, false };
+    if(valid) {
+        // Hlavička má násobek osmi bajtů, pole uzlů je tedy zarovnané
+        view.nodes = (const ASTserializer_Node *)(const void *)(data + sizeof(header));
+        view.nodeCount = header.nodeCount;
+        view.strings = data + sizeof(header) + view.nodeCount * sizeof(ASTserializer_Node);
+        view.stringsSize = (size_t)header.stringsSize;
+        view.frameCount = (size_t)header.frameCount;
+        valid = ASTserializer_validate(&view);
+    }
+
+    // Sestavíme strom a obnovíme záznamy funkcí v globálním rámci
+    if(valid) {
+        AST_initTree();
+        if(ASTroot == NULL) {
+            ASTserializer_unmapFile(data, size);
+            error_handle(ERROR_INTERNAL);
+        }
+
+        ASTroot->importedFile = ASTserializer_readVar(&view, view.nodes[0].child[0]);
+        ASTroot->functionList = ASTserializer_readFunDefList(&view, view.nodes[0].child[1]);
+
+        frameStack_init();
+        valid = !view.failed && ASTserializer_restoreFunctions(&view) &&
+                ASTserializer_restoreSymbols(&view);
+        if(!valid) {
+            AST_destroyTree();
+            frameStack_destroyAll();
+        }
+    }
+
+    ASTserializer_unmapFile(data, size);
+
+    return valid;
+}  // ASTserializer_loadProgram()
+
+/**
+ * @brief Načte AST načteného vstupu scanneru z adresáře cache.
+ */
+bool ASTserializer_loadFromCache(const char *directory) {
+    char path[AST_SERIALIZER_PATH_SIZE];
+    if(!ASTserializer_cachePath(directory, path)) {
+        return false;
+    }
+
+    return ASTserializer_loadProgram(path, tokenCache_hash(scannerInput.data, scannerInput.length),
+                                     scannerInput.length);
+}  // ASTserializer_loadFromCache()
+
+/**
+ * @brief Uloží AST načteného vstupu scanneru do adresáře cache.
+ */
+void ASTserializer_storeToCache(const char *directory) {
+    char path[AST_SERIALIZER_PATH_SIZE];
+    if(!ASTserializer_cachePath(directory, path)) {
+        return;
+    }
+
+    // Selhání zápisu cache neovlivní výsledek překladu
+    ASTserializer_saveProgram(path, tokenCache_hash(scannerInput.data, scannerInput.length),
+                              scannerInput.length);
+}  // ASTserializer_storeToCache()
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                        IMPLEMENTACE INTERNÍCH FUNKCÍ                        *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Sestaví cestu k souboru cache pro načtený vstup scanneru.
+ */
+bool ASTserializer_cachePath(const char *directory, char *path) {
+    // Bez adresáře nebo bez vstupu v paměti cache nepoužíváme
+    if(directory == NULL || *directory == '\0' || !scannerInput.buffered) {
+        return false;
+    }
+
+    uint64_t hash = tokenCache_hash(scannerInput.data, scannerInput.length);
+    int written = snprintf(path, AST_SERIALIZER_PATH_SIZE, "%s/%016llx.ast",
+                           directory, (unsigned long long)hash);
+
+    return written > 0 && written < AST_SERIALIZER_PATH_SIZE;
+}  // ASTserializer_cachePath()
+
+/**
+ * @brief Přidá do bufferu nový uzel.
+ */
+uint32_t ASTserializer_addNode(ASTserializer_Buffer *buffer, AST_NodeType nodeType) {
+    if(buffer->failed || buffer->nodeCount >= AST_SERIALIZER_NONE) {
+        buffer->failed = true;
+        return AST_SERIALIZER_NONE;
+    }
+
+    // Zvětšíme pole uzlů
+    if(buffer->nodeCount == buffer->nodeCapacity) {
+        size_t capacity = (buffer->nodeCapacity == 0) ? AST_SERIALIZER_INITIAL_CAPACITY
+                                                      : buffer->nodeCapacity * 2;
+        ASTserializer_Node *nodes = realloc(buffer->nodes, capacity * sizeof(ASTserializer_Node));
+        if(nodes == NULL) {
+            buffer->failed = true;
+            return AST_SERIALIZER_NONE;
+        }
+        buffer->nodes = nodes;
+        buffer->nodeCapacity = capacity;
+    }
+
+    ASTserializer_Node *node = &buffer->nodes[buffer->nodeCount];
+    memset(node, 0, sizeof(*node));
+    node->nodeType = (uint8_t)nodeType;
+    node->identifier = AST_SERIALIZER_NONE;
+    for(size_t i = 0; i < AST_SERIALIZER_CHILDREN; i++) {
+        node->child[i] = AST_SERIALIZER_NONE;
+    }
+
+    return (uint32_t)buffer->nodeCount++;
+}  // ASTserializer_addNode()
+
+/**
+ * @brief Přidá do tabulky řetězců dynamický řetězec.
+ */
+uint32_t ASTserializer_addString(ASTserializer_Buffer *buffer, DString *str) {
+    if(str == NULL || buffer->failed) {
+        return AST_SERIALIZER_NONE;
+    }
+
+    // Posun i délka řetězce se musí vejít do 32 bitů
+    uint32_t length = (uint32_t)str->length;
+    size_t required = buffer->stringsSize + sizeof(length) + str->length;
+    if(str->length >= AST_SERIALIZER_NONE || required >= AST_SERIALIZER_NONE) {
+        buffer->failed = true;
+        return AST_SERIALIZER_NONE;
+    }
+
+    // Zvětšíme tabulku řetězců
+    if(required > buffer->stringsCapacity) {
+        size_t capacity = (buffer->stringsCapacity == 0) ? AST_SERIALIZER_INITIAL_CAPACITY
+                                                         : buffer->stringsCapacity;
+        while(capacity < required) {
+            capacity *= 2;
+        }
+        char *strings = realloc(buffer->strings, capacity);
+        if(strings == NULL) {
+            buffer->failed = true;
+            return AST_SERIALIZER_NONE;
+        }
+        buffer->strings = strings;
+        buffer->stringsCapacity = capacity;
+    }
+
+    uint32_t offset = (uint32_t)buffer->stringsSize;
+    memcpy(buffer->strings + offset, &length, sizeof(length));
+    memcpy(buffer->strings + offset + sizeof(length), str->str, str->length);
+    buffer->stringsSize = required;
+
+    return offset;
+}  // ASTserializer_addString()
+
+/**
+ * @brief Serializuje seznam definic funkcí.
+ */
+uint32_t ASTserializer_writeFunDefList(ASTserializer_Buffer *buffer, AST_FunDefNode *funDef) {
+    uint32_t first = AST_SERIALIZER_NONE;
+    uint32_t previous = AST_SERIALIZER_NONE;
+
+    for(; funDef != NULL && !buffer->failed; funDef = funDef->next) {
+        // Rámec těla funkce není součástí AST, převezmeme jej z tabulky symbolů
+        SymtableItem *item = NULL;
+        if(symtable_findItem(frameStack.bottom->frame, funDef->identifier, &item) !=
+           SYMTABLE_SUCCESS || item->data == NULL)
+        {
+            buffer->failed = true;
+            return AST_SERIALIZER_NONE;
+        }
+
+        uint32_t index = ASTserializer_addNode(buffer, AST_FUN_DEF_NODE);
+        uint32_t identifier = ASTserializer_addString(buffer, funDef->identifier);
+        uint32_t parameters = ASTserializer_writeArgList(buffer, funDef->parameters);
+        uint32_t body = ASTserializer_writeStatementList(buffer, funDef->body);
+        if(buffer->failed) {
+            return AST_SERIALIZER_NONE;
+        }
+
+        ASTserializer_Node *node = &buffer->nodes[index];
+        node->identifier = identifier;
+        node->dataType = (uint8_t)funDef->returnType;
+        node->frameID = ((SymtableFunctionData *)item->data)->bodyFrameID;
+        node->child[0] = parameters;
+        node->child[1] = body;
+
+        // Napojíme funkci na předchozí prvek seznamu
+        if(previous == AST_SERIALIZER_NONE) {
+            first = index;
+        }
+        else {
+            buffer->nodes[previous].child[2] = index;
+        }
+        previous = index;
+    }
+
+    return first;
+}  // ASTserializer_writeFunDefList()
+
+/**
+ * @brief Serializuje seznam argumentů nebo parametrů.
+ */
+uint32_t ASTserializer_writeArgList(ASTserializer_Buffer *buffer, AST_ArgOrParamNode *arg) {
+    uint32_t first = AST_SERIALIZER_NONE;
+    uint32_t previous = AST_SERIALIZER_NONE;
+
+    for(; arg != NULL && !buffer->failed; arg = arg->next) {
+        uint32_t index = ASTserializer_addNode(buffer, AST_ARG_OR_PARAM_NODE);
+        uint32_t expression = ASTserializer_writeExpr(buffer, arg->expression);
+        if(buffer->failed) {
+            return AST_SERIALIZER_NONE;
+        }
+
+        buffer->nodes[index].kind = (uint8_t)arg->dataType;
+        buffer->nodes[index].child[0] = expression;
+
+        if(previous == AST_SERIALIZER_NONE) {
+            first = index;
+        }
+        else {
+            buffer->nodes[previous].child[1] = index;
+        }
+        previous = index;
+    }
+
+    return first;
+}  // ASTserializer_writeArgList()
+
+/**
+ * @brief Serializuje seznam příkazů.
+ */
+uint32_t ASTserializer_writeStatementList(ASTserializer_Buffer *buffer,
+                                          AST_StatementNode *statement)
+{
+    uint32_t first = AST_SERIALIZER_NONE;
+    uint32_t previous = AST_SERIALIZER_NONE;
+
+    for(; statement != NULL && !buffer->failed; statement = statement->next) {
+        uint32_t index = ASTserializer_addNode(buffer, AST_STATEMENT_NODE);
+        uint32_t child = AST_SERIALIZER_NONE;
+
+        // Podle typu příkazu serializujeme jeho konkrétní uzel
+        switch(statement->statementType) {
+            case AST_STATEMENT_VAR_DEF:
+            case AST_STATEMENT_EXPR:
+            case AST_STATEMENT_RETURN:
+                child = ASTserializer_writeExpr(buffer, statement->statement);
+                break;
+
+            case AST_STATEMENT_FUN_CALL:
+                child = ASTserializer_writeFunCall(buffer, statement->statement);
+                break;
+
+            case AST_STATEMENT_IF: {
+                AST_IfNode *ifNode = statement->statement;
+                child = ASTserializer_addNode(buffer, AST_IF_NODE);
+                uint32_t condition = ASTserializer_writeExpr(buffer, ifNode->condition);
+                uint32_t nullCondition = ASTserializer_writeVar(buffer, ifNode->nullCondition);
+                uint32_t thenBranch = ASTserializer_writeStatementList(buffer, ifNode->thenBranch);
+                uint32_t elseBranch = ASTserializer_writeStatementList(buffer, ifNode->elseBranch);
+                if(!buffer->failed) {
+                    buffer->nodes[child].child[0] = condition;
+                    buffer->nodes[child].child[1] = nullCondition;
+                    buffer->nodes[child].child[2] = thenBranch;
+                    buffer->nodes[child].child[3] = elseBranch;
+                }
+                break;
+            }
+
+            case AST_STATEMENT_WHILE: {
+                AST_WhileNode *whileNode = statement->statement;
+                child = ASTserializer_addNode(buffer, AST_WHILE_NODE);
+                uint32_t condition = ASTserializer_writeExpr(buffer, whileNode->condition);
+                uint32_t nullCondition = ASTserializer_writeVar(buffer, whileNode->nullCondition);
+                uint32_t body = ASTserializer_writeStatementList(buffer, whileNode->body);
+                if(!buffer->failed) {
+                    buffer->nodes[child].child[0] = condition;
+                    buffer->nodes[child].child[1] = nullCondition;
+                    buffer->nodes[child].child[2] = body;
+                }
+                break;
+            }
+
+            case AST_STATEMENT_NOT_DEFINED:
+            default:
+                buffer->failed = true;
+                break;
+        }
+
+        if(buffer->failed) {
+            return AST_SERIALIZER_NONE;
+        }
+
+        buffer->nodes[index].kind = (uint8_t)statement->statementType;
+        buffer->nodes[index].frameID = statement->frameID;
+        buffer->nodes[index].child[0] = child;
+
+        if(previous == AST_SERIALIZER_NONE) {
+            first = index;
+        }
+        else {
+            buffer->nodes[previous].child[1] = index;
+        }
+        previous = index;
+    }
+
+    return first;
+}  // ASTserializer_writeStatementList()
+
+/**
+ * @brief Serializuje uzel výrazu.
+ */
+uint32_t ASTserializer_writeExpr(ASTserializer_Buffer *buffer, AST_ExprNode *expr) {
+    if(expr == NULL || buffer->failed) {
+        return AST_SERIALIZER_NONE;
+    }
+
+    uint32_t index = ASTserializer_addNode(buffer, AST_EXPR_NODE);
+    uint32_t child = AST_SERIALIZER_NONE;
+
+    switch(expr->exprType) {
+        case AST_EXPR_LITERAL:
+        case AST_EXPR_VARIABLE:
+            child = ASTserializer_writeVar(buffer, expr->expression);
+            break;
+
+        case AST_EXPR_FUN_CALL:
+            child = ASTserializer_writeFunCall(buffer, expr->expression);
+            break;
+
+        case AST_EXPR_BINARY_OP: {
+            AST_BinOpNode *binOp = expr->expression;
+            child = ASTserializer_addNode(buffer, AST_BIN_OP_NODE);
+            uint32_t left = ASTserializer_writeExpr(buffer, binOp->left);
+            uint32_t right = ASTserializer_writeExpr(buffer, binOp->right);
+            if(!buffer->failed) {
+                buffer->nodes[child].kind = (uint8_t)binOp->op;
+                buffer->nodes[child].child[0] = left;
+                buffer->nodes[child].child[1] = right;
+            }
+            break;
+        }
+
+        case AST_EXPR_NOT_DEFINED:
+        default:
+            buffer->failed = true;
+            break;
+    }
+
+    if(buffer->failed) {
+        return AST_SERIALIZER_NONE;
+    }
+
+    buffer->nodes[index].kind = (uint8_t)expr->exprType;
+    buffer->nodes[index].child[0] = child;
+
+    return index;
+}  // ASTserializer_writeExpr()
+
+/**
+ * @brief Serializuje uzel volání funkce.
+ */
+uint32_t ASTserializer_writeFunCall(ASTserializer_Buffer *buffer, AST_FunCallNode *funCall) {
+    if(funCall == NULL || buffer->failed) {
+        return AST_SERIALIZER_NONE;
+    }
+
+    uint32_t index = ASTserializer_addNode(buffer, AST_FUN_CALL_NODE);
+    uint32_t identifier = ASTserializer_addString(buffer, funCall->identifier);
+    uint32_t arguments = ASTserializer_writeArgList(buffer, funCall->arguments);
+    if(buffer->failed) {
+        return AST_SERIALIZER_NONE;
+    }
+
+    buffer->nodes[index].identifier = identifier;
+    buffer->nodes[index].flags = funCall->isBuiltIn ? AST_SERIALIZER_FLAG_BUILT_IN : 0;
+    buffer->nodes[index].child[0] = arguments;
+
+    return index;
+}  // ASTserializer_writeFunCall()
+
+/**
+ * @brief Serializuje uzel proměnné nebo literálu.
+ */
+uint32_t ASTserializer_writeVar(ASTserializer_Buffer *buffer, AST_VarNode *var) {
+    if(var == NULL || buffer->failed) {
+        return AST_SERIALIZER_NONE;
+    }
+
+    uint32_t index = ASTserializer_addNode(buffer, var->type);
+    uint32_t identifier = ASTserializer_addString(buffer, var->identifier);
+
+    // Hodnotu literálu uložíme jako bity čísla, nebo jako odkaz na řetězec
+    uint64_t value = 0;
+    if(var->value != NULL) {
+        switch(var->literalType) {
+            case AST_LITERAL_INT:
+                value = (uint64_t)(int64_t)*(int *)var->value;
+                break;
+            case AST_LITERAL_FLOAT:
+                memcpy(&value, var->value, sizeof(double));
+                break;
+            case AST_LITERAL_BOOL:
+                value = *(bool *)var->value ? 1 : 0;
+                break;
+            case AST_LITERAL_STRING:
+                value = ASTserializer_addString(buffer, var->value);
+                break;
+            default:
+                break;
+        }
+    }
+
+    if(buffer->failed) {
+        return AST_SERIALIZER_NONE;
+    }
+
+    ASTserializer_Node *node = &buffer->nodes[index];
+    node->identifier = identifier;
+    node->kind = (uint8_t)var->literalType;
+    node->frameID = var->frameID;
+    node->value = value;
+    if(var->value != NULL) {
+        node->flags |= AST_SERIALIZER_FLAG_HAS_VALUE;
+    }
+
+    // U proměnné uložíme stav jejího symbolu, ze kterého se určuje typ výrazu
+    SymtableItem *item = NULL;
+    if(var->type == AST_VAR_NODE && var->identifier != NULL && var->frameID > 0 &&
+       var->frameID <= frameStack.currentID &&
+       symtable_findItem(frameArray.array[var->frameID]->frame, var->identifier, &item) ==
+       SYMTABLE_SUCCESS)
+    {
+        node->flags |= AST_SERIALIZER_FLAG_SYMBOL;
+        node->dataType = (uint8_t)item->symbolState;
+        if(item->knownValue && item->data == NULL) {
+            node->flags |= AST_SERIALIZER_FLAG_KNOWN_NULL;
+        }
+    }
+
+    return index;
+}  // ASTserializer_writeVar()
+
+/**
+ * @brief Přičte data ke kontrolnímu součtu souboru s AST.
+ */
+uint64_t ASTserializer_checksum(uint64_t hash, const void *data, size_t length) {
+    const unsigned char *bytes = data;
+
+    for(size_t i = 0; i < length; i++) {
+        hash ^= bytes[i];
+        hash *= UINT64_C(1099511628211);
+    }
+
+    return hash;
+}  // ASTserializer_checksum()
+
+/**
+ * @brief Ověří odkazy uzlů na potomky a řetězce a tvar každého uzlu.
+ */
+bool ASTserializer_validate(const ASTserializer_View *view) {
+    if(view->nodes[0].nodeType != AST_PROGRAM_NODE) {
+        return false;
+    }
+
+    // Počet odkazů na každý uzel
+    uint8_t *parents = calloc(view->nodeCount, sizeof(uint8_t));
+    if(parents == NULL) {
+        return false;
+    }
+
+    bool valid = true;
+    for(size_t i = 0; i < view->nodeCount && valid; i++) {
+        valid = ASTserializer_validateLinks(view, &view->nodes[i], i, parents) &&
+                ASTserializer_validateNode(view, &view->nodes[i]);
+    }
+
+    // Kromě kořene musí mít každý uzel právě jednoho rodiče
+    for(size_t i = 1; i < view->nodeCount && valid; i++) {
+        valid = (parents[i] == 1);
+    }
+
+    free(parents);
+
+    return valid;
+}  // ASTserializer_validate()
+
+/**
+ * @brief Ověří odkazy jednoho uzlu na potomky, rámce a řetězce.
+ */
+bool ASTserializer_validateLinks(const ASTserializer_View *view, const ASTserializer_Node *node,
+                                 size_t index, uint8_t *parents)
+{
+    // Potomek musí mít vyšší index než rodič, strom tedy nemůže obsahovat cyklus
+    for(size_t j = 0; j < AST_SERIALIZER_CHILDREN; j++) {
+        if(node->child[j] == AST_SERIALIZER_NONE) {
+            continue;
+        }
+        if(node->child[j] <= index || node->child[j] >= view->nodeCount ||
+           parents[node->child[j]]++ != 0)
+        {
+            return false;
+        }
+    }
+
+    // Rámec musí být některý z obnovených rámců
+    if(node->frameID > view->frameCount) {
+        return false;
+    }
+
+    // Záznam proměnné musí patřit do některého z obnovených rámců
+    if((node->flags & AST_SERIALIZER_FLAG_SYMBOL) &&
+       (node->nodeType != AST_VAR_NODE || node->identifier == AST_SERIALIZER_NONE ||
+        node->frameID == 0 || node->dataType < SYMTABLE_SYMBOL_VARIABLE_INT ||
+        node->dataType > SYMTABLE_SYMBOL_VARIABLE_STRING_OR_NULL))
+    {
+        return false;
+    }
+
+    // Řetězce musí celé ležet v tabulce řetězců
+    uint64_t strings[2] = { node->identifier, AST_SERIALIZER_NONE };
+    if(node->kind == AST_LITERAL_STRING && (node->flags & AST_SERIALIZER_FLAG_HAS_VALUE) &&
+       (node->nodeType == AST_VAR_NODE || node->nodeType == AST_LITERAL_NODE))
+    {
+        strings[1] = node->value;
+    }
+
+    for(size_t j = 0; j < 2; j++) {
+        if(strings[j] == AST_SERIALIZER_NONE) {
+            continue;
+        }
+
+        uint32_t length;
+        if(strings[j] > view->stringsSize || view->stringsSize - strings[j] < sizeof(length)) {
+            return false;
+        }
+        memcpy(&length, view->strings + strings[j], sizeof(length));
+        if(view->stringsSize - strings[j] - sizeof(length) < length) {
+            return false;
+        }
+    }
+
+    return true;
+}  // ASTserializer_validateLinks()
+
+/**
+ * @brief Ověří, že podtyp, příznaky a potomci uzlu odpovídají jeho typu.
+ */
+bool ASTserializer_validateNode(const ASTserializer_View *view, const ASTserializer_Node *node) {
+    bool validKind = (node->kind == 0);
+    bool validDataType = (node->dataType == 0);
+    bool needsIdentifier = false;
+    uint8_t allowedFlags = 0;
+    unsigned allowedChildren = 0;   // Bitová maska potomků, které uzel smí mít
+    unsigned requiredChildren = 0;  // Bitová maska potomků, které uzel musí mít
+
+    switch(node->nodeType) {
+        case AST_PROGRAM_NODE:
+            allowedChildren = 0x3;
+            break;
+
+        case AST_FUN_DEF_NODE:
+            validDataType = (node->dataType >= AST_DATA_TYPE_INT &&
+                             node->dataType <= AST_DATA_TYPE_VOID);
+            needsIdentifier = true;
+            allowedChildren = 0x7;
+            break;
+
+        case AST_ARG_OR_PARAM_NODE:
+            validKind = (node->kind <= AST_DATA_TYPE_STRING_OR_NULL);
+            allowedChildren = 0x3;
+            requiredChildren = 0x1;
+            break;
+
+        case AST_STATEMENT_NODE:
+            validKind = (node->kind >= AST_STATEMENT_VAR_DEF && node->kind <= AST_STATEMENT_RETURN);
+            allowedChildren = 0x3;
+            // Jen příkaz "return" ve funkci bez návratové hodnoty nemá výraz
+            requiredChildren = (node->kind == AST_STATEMENT_RETURN) ? 0x0 : 0x1;
+            break;
+
+        case AST_FUN_CALL_NODE:
+            needsIdentifier = true;
+            allowedFlags = AST_SERIALIZER_FLAG_BUILT_IN;
+            allowedChildren = 0x1;
+            break;
+
+        case AST_IF_NODE:
+        case AST_WHILE_NODE:
+            allowedChildren = (node->nodeType == AST_IF_NODE) ? 0xF : 0x7;
+            requiredChildren = 0x1;
+
+            // Proměnná bez hodnoty null nemůže být literál
+            if(node->child[1] != AST_SERIALIZER_NONE &&
+               view->nodes[node->child[1]].nodeType != AST_VAR_NODE)
+            {
+                return false;
+            }
+            break;
+
+        case AST_EXPR_NODE: {
+            validKind = (node->kind >= AST_EXPR_LITERAL && node->kind <= AST_EXPR_BINARY_OP);
+            allowedChildren = 0x1;
+            requiredChildren = 0x1;
+
+            // Typ výrazu musí odpovídat typu jeho konkrétního uzlu
+            uint8_t expected = (node->kind == AST_EXPR_LITERAL)  ? AST_LITERAL_NODE :
+                               (node->kind == AST_EXPR_VARIABLE) ? AST_VAR_NODE :
+                               (node->kind == AST_EXPR_FUN_CALL) ? AST_FUN_CALL_NODE :
+                                                                   AST_BIN_OP_NODE;
+            if(node->child[0] != AST_SERIALIZER_NONE &&
+               view->nodes[node->child[0]].nodeType != expected)
+            {
+                return false;
+            }
+            break;
+        }
+
+        case AST_BIN_OP_NODE:
+            validKind = (node->kind >= AST_OP_EQUAL && node->kind <= AST_OP_ASSIGNMENT);
+            allowedChildren = 0x3;
+            requiredChildren = 0x3;
+            break;
+
+        case AST_LITERAL_NODE:
+            // Hodnotu má právě každý literál kromě null
+            validKind = (node->kind >= AST_LITERAL_INT && node->kind <= AST_LITERAL_BOOL &&
+                         ((node->flags & AST_SERIALIZER_FLAG_HAS_VALUE) != 0) ==
+                         (node->kind != AST_LITERAL_NULL));
+            allowedFlags = AST_SERIALIZER_FLAG_HAS_VALUE;
+            break;
+
+        case AST_VAR_NODE:
+            validKind = (node->kind <= AST_LITERAL_BOOL &&
+                         (!(node->flags & AST_SERIALIZER_FLAG_HAS_VALUE) ||
+                          (node->kind != AST_LITERAL_NOT_DEFINED &&
+                           node->kind != AST_LITERAL_NULL)));
+            validDataType = validDataType || (node->flags & AST_SERIALIZER_FLAG_SYMBOL);
+            needsIdentifier = true;
+            allowedFlags = AST_SERIALIZER_FLAG_HAS_VALUE | AST_SERIALIZER_FLAG_SYMBOL |
+                           AST_SERIALIZER_FLAG_KNOWN_NULL;
+
+            // Známá hodnota null patří jen proměnné se záznamem v tabulce symbolů
+            if((node->flags & AST_SERIALIZER_FLAG_KNOWN_NULL) &&
+               !(node->flags & AST_SERIALIZER_FLAG_SYMBOL))
+            {
+                return false;
+            }
+            break;
+
+        default:
+            return false;
+    }
+
+    if(!validKind || !validDataType || (node->flags & ~allowedFlags) != 0 ||
+       (needsIdentifier && node->identifier == AST_SERIALIZER_NONE))
+    {
+        return false;
+    }
+
+    for(size_t j = 0; j < AST_SERIALIZER_CHILDREN; j++) {
+        bool present = (node->child[j] != AST_SERIALIZER_NONE);
+        if((present && !(allowedChildren & (1u << j))) ||
+           (!present && (requiredChildren & (1u << j))))
+        {
+            return false;
+        }
+    }
+
+    // Příznak vestavěné funkce musí patřit volání některé ze známých funkcí
+    if(node->flags & AST_SERIALIZER_FLAG_BUILT_IN) {
+        uint32_t length;
+        memcpy(&length, view->strings + node->identifier, sizeof(length));
+
+        DString *identifier = DString_init();
+        if(identifier == NULL || DString_appendChars(identifier,
+           view->strings + node->identifier + sizeof(length), length) != STRING_SUCCESS)
+        {
+            DString_free(identifier);
+            return false;
+        }
+
+        bool known = (frameStack_findBuiltIn(identifier) != NULL);
+        DString_free(identifier);
+
+        return known;
+    }
+
+    return true;
+}  // ASTserializer_validateNode()
+
+/**
+ * @brief Vrátí uzel s daným indexem, pokud má očekávaný typ.
+ */
+const ASTserializer_Node *ASTserializer_node(ASTserializer_View *view, uint32_t index,
+                                             AST_NodeType nodeType)
+{
+    if(index == AST_SERIALIZER_NONE || view->failed) {
+        return NULL;
+    }
+
+    const ASTserializer_Node *node = &view->nodes[index];
+
+    // Proměnná a literál sdílí stejnou strukturu uzlu
+    bool isVar = (node->nodeType == AST_VAR_NODE || node->nodeType == AST_LITERAL_NODE);
+    bool expectsVar = (nodeType == AST_VAR_NODE || nodeType == AST_LITERAL_NODE);
+    if(node->nodeType != nodeType && !(isVar && expectsVar)) {
+        view->failed = true;
+        return NULL;
+    }
+
+    return node;
+}  // ASTserializer_node()
+
+/**
+ * @brief Vytvoří dynamický řetězec z tabulky řetězců.
+ */
+DString *ASTserializer_readString(ASTserializer_View *view, uint32_t offset) {
+    if(offset == AST_SERIALIZER_NONE) {
+        return NULL;
+    }
+
+    uint32_t length;
+    memcpy(&length, view->strings + offset, sizeof(length));
+
+    DString *str = DString_init();
+    if(str == NULL ||
+       DString_appendChars(str, view->strings + offset + sizeof(length), length) != STRING_SUCCESS)
+    {
+        error_handle(ERROR_INTERNAL);
+    }
+
+    return str;
+}  // ASTserializer_readString()
+
+/**
+ * @brief Sestaví seznam definic funkcí.
+ */
+AST_FunDefNode *ASTserializer_readFunDefList(ASTserializer_View *view, uint32_t index) {
+    AST_FunDefNode *first = NULL;
+    AST_FunDefNode *last = NULL;
+
+    const ASTserializer_Node *node;
+    while((node = ASTserializer_node(view, index, AST_FUN_DEF_NODE)) != NULL) {
+        AST_FunDefNode *funDef = AST_createFunDefNode();
+        if(funDef == NULL) {
+            error_handle(ERROR_INTERNAL);
+        }
+
+        // Uzel napojíme hned, aby jej při chybě uvolnilo zrušení stromu
+        if(last == NULL) {
+            first = funDef;
+        }
+        else {
+            last->next = funDef;
+        }
+        last = funDef;
+
+        funDef->identifier = ASTserializer_readString(view, node->identifier);
+        funDef->returnType = (AST_DataType)node->dataType;
+        funDef->parameters = ASTserializer_readArgList(view, node->child[0]);
+        funDef->body = ASTserializer_readStatementList(view, node->child[1]);
+
+        index = node->child[2];
+    }
+
+    return first;
+}  // ASTserializer_readFunDefList()
+
+/**
+ * @brief Sestaví seznam argumentů nebo parametrů.
+ */
+AST_ArgOrParamNode *ASTserializer_readArgList(ASTserializer_View *view, uint32_t index) {
+    AST_ArgOrParamNode *first = NULL;
+    AST_ArgOrParamNode *last = NULL;
+
+    const ASTserializer_Node *node;
+    while((node = ASTserializer_node(view, index, AST_ARG_OR_PARAM_NODE)) != NULL) {
+        AST_ArgOrParamNode *arg = AST_createArgOrParamNode();
+        if(arg == NULL) {
+            error_handle(ERROR_INTERNAL);
+        }
+
+        if(last == NULL) {
+            first = arg;
+        }
+        else {
+            last->next = arg;
+        }
+        last = arg;
+
+        arg->dataType = (AST_DataType)node->kind;
+        arg->expression = ASTserializer_readExpr(view, node->child[0]);
+
+        index = node->child[1];
+    }
+
+    return first;
+}  // ASTserializer_readArgList()
+
+/**
+ * @brief Sestaví seznam příkazů.
+ */
+AST_StatementNode *ASTserializer_readStatementList(ASTserializer_View *view, uint32_t index) {
+    AST_StatementNode *first = NULL;
+    AST_StatementNode *last = NULL;
+
+    const ASTserializer_Node *node;
+    while((node = ASTserializer_node(view, index, AST_STATEMENT_NODE)) != NULL) {
+        AST_StatementNode *statement = AST_createStatementNode();
+        if(statement == NULL) {
+            error_handle(ERROR_INTERNAL);
+        }
+
+        if(last == NULL) {
+            first = statement;
+        }
+        else {
+            last->next = statement;
+        }
+        last = statement;
+
+        statement->frameID = (size_t)node->frameID;
+        statement->statementType = (AST_StatementType)node->kind;
+
+        // Podle typu příkazu sestavíme jeho konkrétní uzel
+        switch(statement->statementType) {
+            case AST_STATEMENT_VAR_DEF:
+            case AST_STATEMENT_EXPR:
+            case AST_STATEMENT_RETURN:
+                statement->statement = ASTserializer_readExpr(view, node->child[0]);
+                break;
+
+            case AST_STATEMENT_FUN_CALL:
+                statement->statement = ASTserializer_readFunCall(view, node->child[0]);
+                break;
+
+            case AST_STATEMENT_IF: {
+                const ASTserializer_Node *child = ASTserializer_node(view, node->child[0],
+                                                                     AST_IF_NODE);
+                if(child == NULL) {
+                    view->failed = true;
+                    break;
+                }
+
+                AST_IfNode *ifNode = AST_createIfNode();
+                if(ifNode == NULL) {
+                    error_handle(ERROR_INTERNAL);
+                }
+                statement->statement = ifNode;
+                ifNode->condition = ASTserializer_readExpr(view, child->child[0]);
+                ifNode->nullCondition = ASTserializer_readVar(view, child->child[1]);
+                ifNode->thenBranch = ASTserializer_readStatementList(view, child->child[2]);
+                ifNode->elseBranch = ASTserializer_readStatementList(view, child->child[3]);
+                break;
+            }
+
+            case AST_STATEMENT_WHILE: {
+                const ASTserializer_Node *child = ASTserializer_node(view, node->child[0],
+                                                                     AST_WHILE_NODE);
+                if(child == NULL) {
+                    view->failed = true;
+                    break;
+                }
+
+                AST_WhileNode *whileNode = AST_createWhileNode();
+                if(whileNode == NULL) {
+                    error_handle(ERROR_INTERNAL);
+                }
+                statement->statement = whileNode;
+                whileNode->condition = ASTserializer_readExpr(view, child->child[0]);
+                whileNode->nullCondition = ASTserializer_readVar(view, child->child[1]);
+                whileNode->body = ASTserializer_readStatementList(view, child->child[2]);
+                break;
+            }
+
+            case AST_STATEMENT_NOT_DEFINED:
+            default:
+                statement->statementType = AST_STATEMENT_NOT_DEFINED;
+                view->failed = true;
+                break;
+        }
+
+        index = node->child[1];
+    }
+
+    return first;
+}  // ASTserializer_readStatementList()
+
+/**
+ * @brief Sestaví uzel výrazu.
+ */
+AST_ExprNode *ASTserializer_readExpr(ASTserializer_View *view, uint32_t index) {
+    const ASTserializer_Node *node = ASTserializer_node(view, index, AST_EXPR_NODE);
+    if(node == NULL) {
+        return NULL;
+    }
+
+    AST_ExprNode *expr = AST_createExprNode();
+    if(expr == NULL) {
+        error_handle(ERROR_INTERNAL);
+    }
+
+    expr->exprType = (AST_ExprType)node->kind;
+
+    switch(expr->exprType) {
+        case AST_EXPR_LITERAL:
+        case AST_EXPR_VARIABLE:
+            expr->expression = ASTserializer_readVar(view, node->child[0]);
+            break;
+
+        case AST_EXPR_FUN_CALL:
+            expr->expression = ASTserializer_readFunCall(view, node->child[0]);
+            break;
+
+        case AST_EXPR_BINARY_OP: {
+            const ASTserializer_Node *child = ASTserializer_node(view, node->child[0],
+                                                                 AST_BIN_OP_NODE);
+            if(child == NULL) {
+                view->failed = true;
+                break;
+            }
+
+            AST_BinOpNode *binOp = AST_createBinOpNode();
+            if(binOp == NULL) {
+                error_handle(ERROR_INTERNAL);
+            }
+            expr->expression = binOp;
+            binOp->op = (AST_BinOpType)child->kind;
+            binOp->left = ASTserializer_readExpr(view, child->child[0]);
+            binOp->right = ASTserializer_readExpr(view, child->child[1]);
+            break;
+        }
+
+        case AST_EXPR_NOT_DEFINED:
+        default:
+            expr->exprType = AST_EXPR_NOT_DEFINED;
+            view->failed = true;
+            break;
+    }
+
+    // Výraz bez konkrétního uzlu značí poškozený soubor
+    if(expr->expression == NULL) {
+        view->failed = true;
+    }
+
+    return expr;
+}  // ASTserializer_readExpr()
+
+/**
+ * @brief Sestaví uzel volání funkce.
+ */
+AST_FunCallNode *ASTserializer_readFunCall(ASTserializer_View *view, uint32_t index) {
+    const ASTserializer_Node *node = ASTserializer_node(view, index, AST_FUN_CALL_NODE);
+    if(node == NULL) {
+        return NULL;
+    }
+
+    AST_FunCallNode *funCall = AST_createFunCallNode();
+    if(funCall == NULL) {
+        error_handle(ERROR_INTERNAL);
+    }
+
+    funCall->identifier = ASTserializer_readString(view, node->identifier);
+    funCall->isBuiltIn = (node->flags & AST_SERIALIZER_FLAG_BUILT_IN) != 0;
+    funCall->arguments = ASTserializer_readArgList(view, node->child[0]);
+
+    return funCall;
+}  // ASTserializer_readFunCall()
+
+/**
+ * @brief Sestaví uzel proměnné nebo literálu.
+ */
+AST_VarNode *ASTserializer_readVar(ASTserializer_View *view, uint32_t index) {
+    const ASTserializer_Node *node = ASTserializer_node(view, index, AST_VAR_NODE);
+    if(node == NULL) {
+        return NULL;
+    }
+
+    AST_VarNode *var = AST_createVarNode((AST_NodeType)node->nodeType);
+    if(var == NULL) {
+        error_handle(ERROR_INTERNAL);
+    }
+
+    var->identifier = ASTserializer_readString(view, node->identifier);
+    var->frameID = (size_t)node->frameID;
+    var->literalType = (AST_LiteralType)node->kind;
+
+    if(!(node->flags & AST_SERIALIZER_FLAG_HAS_VALUE)) {
+        return var;
+    }
+
+    // Hodnotu literálu obnovíme podle jeho typu
+    switch(var->literalType) {
+        case AST_LITERAL_INT:
+            var->value = malloc(sizeof(int));
+            if(var->value != NULL) {
+                *(int *)var->value = (int)(int64_t)node->value;
+            }
+            break;
+
+        case AST_LITERAL_FLOAT:
+            var->value = malloc(sizeof(double));
+            if(var->value != NULL) {
+                memcpy(var->value, &node->value, sizeof(double));
+            }
+            break;
+
+        case AST_LITERAL_BOOL:
+            var->value = malloc(sizeof(bool));
+            if(var->value != NULL) {
+                *(bool *)var->value = (node->value != 0);
+            }
+            break;
+
+        case AST_LITERAL_STRING:
+            var->value = ASTserializer_readString(view, (uint32_t)node->value);
+            break;
+
+        default:
+            view->failed = true;
+            return var;
+    }
+
+    if(var->value == NULL) {
+        AST_destroyVarNode(var);
+        error_handle(ERROR_INTERNAL);
+    }
+
+    return var;
+}  // ASTserializer_readVar()
+
+/**
+ * @brief Obnoví záznamy definic funkcí v globálním rámci.
+ */
+bool ASTserializer_restoreFunctions(ASTserializer_View *view) {
+    uint32_t index = view->nodes[0].child[1];
+
+    for(AST_FunDefNode *funDef = ASTroot->functionList; funDef != NULL; funDef = funDef->next) {
+        const ASTserializer_Node *node = &view->nodes[index];
+        index = node->child[2];
+
+        SymtableItem *item = NULL;
+        if(frameStack_addItemExpress(funDef->identifier, SYMTABLE_SYMBOL_FUNCTION, IS_VAR,
+                                     NULL, &item) != FRAME_STACK_SUCCESS)
+        {
+            return false;
+        }
+
+        size_t paramCount = 0;
+        for(AST_ArgOrParamNode *param = funDef->parameters; param != NULL; param = param->next) {
+            paramCount++;
+        }
+
+        SymtableFunctionData *functionData = symtable_initFunctionData(paramCount);
+        if(functionData == NULL) {
+            error_handle(ERROR_INTERNAL);
+        }
+        item->data = functionData;
+
+        // Identifikátory parametrů sdílí tabulka symbolů s AST, stejně jako v parseru
+        Symtable_functionReturnType funType = SYMTABLE_TYPE_UNKNOWN;
+        AST_ArgOrParamNode *param = funDef->parameters;
+        for(size_t i = 0; i < paramCount; i++, param = param->next) {
+            if(param->expression == NULL || param->expression->exprType != AST_EXPR_VARIABLE) {
+                return false;
+            }
+
+            parser_mapASTDataTypeToFunReturnType(param->dataType, &funType);
+            functionData->params[i].id = ((AST_VarNode *)param->expression->expression)->identifier;
+            functionData->params[i].type = funType;
+        }
+
+        parser_mapASTDataTypeToFunReturnType(funDef->returnType, &funType);
+        functionData->bodyFrameID = (size_t)node->frameID;
+        functionData->returnType = funType;
+    }
+
+    return true;
+}  // ASTserializer_restoreFunctions()
+
+/**
+ * @brief Obnoví rámce a záznamy proměnných, na které odkazuje AST.
+ */
+bool ASTserializer_restoreSymbols(ASTserializer_View *view) {
+    // Rámce vytvoříme ve stejném pořadí, aby odpovídala jejich ID
+    for(size_t i = 0; i < view->frameCount; i++) {
+        frameStack_push(false);
+        frameStack_pop();
+    }
+
+    for(size_t i = 0; i < view->nodeCount; i++) {
+        const ASTserializer_Node *node = &view->nodes[i];
+        if(!(node->flags & AST_SERIALIZER_FLAG_SYMBOL)) {
+            continue;
+        }
+
+        DString *identifier = ASTserializer_readString(view, node->identifier);
+        SymtableItem *item = NULL;
+        Symtable_result result = symtable_addItem(frameArray.array[node->frameID]->frame,
+                                                  identifier, &item);
+        DString_free(identifier);
+
+        // Proměnná se v AST vyskytuje vícekrát, záznam stačí vytvořit jednou
+        if(result == SYMTABLE_ITEM_ALREADY_EXISTS) {
+            continue;
+        }
+        if(result != SYMTABLE_SUCCESS) {
+            return false;
+        }
+
+        item->symbolState = (Symtable_symbolState)node->dataType;
+        item->used = true;
+        item->knownValue = (node->flags & AST_SERIALIZER_FLAG_KNOWN_NULL) != 0;
+    }
+
+    return true;
+}  // ASTserializer_restoreSymbols()
+
+/**
+ * @brief Namapuje soubor do paměti pouze pro čtení.
+ */
+const char *ASTserializer_mapFile(const char *path, size_t *size) {
+#if defined(__unix__) || defined(__APPLE__)
+    int descriptor = open(path, O_RDONLY);
+    if(descriptor < 0) {
+        return NULL;
+    }
+
+    struct stat info;
+    if(fstat(descriptor, &info) != 0 || info.st_size <= 0) {
+        close(descriptor);
+        return NULL;
+    }
+
+    void *data = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    close(descriptor);
+    if(data == MAP_FAILED) {
+        return NULL;
+    }
+
+    *size = (size_t)info.st_size;
+    return data;
+#else
+    FILE *file = fopen(path, "rb");
+    if(file == NULL) {
+        return NULL;
+    }
+
+    // Soubor načteme celý do paměti
+    char *data = NULL;
+    size_t length = 0;
+    char chunk[SCANNER_INPUT_CHUNK_SIZE];
+    size_t read;
+    while((read = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+        char *newData = realloc(data, length + read);
+        if(newData == NULL) {
+            free(data);
+            fclose(file);
+            return NULL;
+        }
+        data = newData;
+        memcpy(data + length, chunk, read);
+        length += read;
+    }
+    fclose(file);
+
+    *size = length;
+    return data;
+#endif
+}  // ASTserializer_mapFile()
+
+/**
+ * @brief Uvolní soubor namapovaný funkcí @c ASTserializer_mapFile().
+ */
+void ASTserializer_unmapFile(const char *data, size_t size) {
+#if defined(__unix__) || defined(__APPLE__)
+    munmap((void *)(uintptr_t)data, size);
+#else
+    (void)size;
+    free((void *)(uintptr_t)data);
+#endif
+}  // ASTserializer_unmapFile()
+
+/*** Konec souboru ast_serializer.c ***/
@@ -0,0 +1,483 @@
+/*******************************************************************************
+ *                                                                             *
+ * Název projektu:   Implementace překladače imperativního jazyka IFJ24        *
+ *                                                                             *
+ * Soubor:           ast_serializer.h                                          *
+ * Autor:            Jan Kalina   <xkalinj00>                                  *
+ *                                                                             *
+ * Datum:            04.12.2024                                                *
+ * Poslední změna:   04.12.2024                                                *
+ *                                                                             *
+ * Tým:      Tým xkalinj00                                                     *
+ * Členové:  Farkašovský Lukáš    <xfarkal00>                                  *
+ *           Hýža Pavel           <xhyzapa00>                                  *
+ *           Kalina Jan           <xkalinj00>                                  *
+ *           Krejčí David         <xkrejcd00>                                  *
+ *                                                                             *
+ ******************************************************************************/
+/**
+ * @file ast_serializer.h
+ * @author Kalina Jan \<xkalinj00>
+ *
+ * @brief Hlavičkový soubor pro binární serializaci abstraktního syntaktického stromu.
+ * @details Sémanticky zkontrolovaný AST lze uložit do souboru a později jej
+ *          znovu načíst, čímž se přeskočí lexikální, syntaktická i sémantická
+ *          analýza. Pokud je nastavena proměnná prostředí @c AST_CACHE_ENV
+ *          s cestou k adresáři, překladač takto ukládá AST pod hashem obsahu
+ *          vstupu a při dalším překladu téhož vstupu spustí rovnou optimalizace
+ *          a generování kódu.
+ *
+ *          Formát souboru nezávisí na adresách v paměti:
+ *          - hlavička @c ASTserializer_Header,
+ *          - pole uzlů @c ASTserializer_Node pevné velikosti, potomci jsou
+ *            odkazováni indexem uzlu v poli,
+ *          - tabulka řetězců, na které uzly odkazují posunem v bajtech
+ *            (každý řetězec je uložen jako `uint32_t` délka a znaky).
+ *
+ *          Uzly jsou uloženy v pořadí průchodu preorder, takže potomek má vždy
+ *          vyšší index než rodič. Soubor je načítán pomocí `mmap` a před
+ *          sestavením stromu je ověřen jeho kontrolní součet i tvar každého
+ *          uzlu. Spolu s AST se obnoví i záznamy funkcí
+ *          v globálním rámci a typy proměnných v jejich rámcích, které potřebuje
+ *          generátor kódu.
+ */
+
+#ifndef AST_SERIALIZER_H_
+/** @cond  */
+#define AST_SERIALIZER_H_
+/** @endcond  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "ast_nodes.h"
+#include "ast_interface.h"
+#include "dynamic_string.h"
+#include "error.h"
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                             DEKLARACE KONSTANT                              *
+ *                                                                             *
+ ******************************************************************************/
+
+#define AST_CACHE_ENV "IFJ24_AST_CACHE"         /**< Proměnná prostředí s adresářem cache AST */
+#define AST_SERIALIZER_MAGIC "IFJ24AST"         /**< Identifikace souboru s AST               */
+#define AST_SERIALIZER_MAGIC_SIZE 8             /**< Délka identifikace souboru               */
+#define AST_SERIALIZER_VERSION 2                /**< Verze formátu souboru                    */
+#define AST_SERIALIZER_NONE UINT32_MAX          /**< Chybějící potomek nebo řetězec           */
+#define AST_SERIALIZER_CHILDREN 4               /**< Počet odkazů na potomky v uzlu           */
+#define AST_SERIALIZER_PATH_SIZE 4096           /**< Velikost bufferu pro cestu k souboru     */
+#define AST_SERIALIZER_INITIAL_CAPACITY 256     /**< Počáteční kapacita polí při zápisu       */
+#define AST_SERIALIZER_CHECKSUM_BASIS UINT64_C(14695981039346656037)   /**< Počáteční hodnota součtu */
+
+#define AST_SERIALIZER_FLAG_BUILT_IN 0x01       /**< Volání vestavěné funkce                  */
+#define AST_SERIALIZER_FLAG_HAS_VALUE 0x02      /**< Uzel proměnné nebo literálu má hodnotu   */
+#define AST_SERIALIZER_FLAG_SYMBOL 0x04         /**< Proměnná má záznam v tabulce symbolů     */
+#define AST_SERIALIZER_FLAG_KNOWN_NULL 0x08     /**< Hodnota proměnné je známá hodnota null   */
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                             DEKLARACE STRUKTUR                              *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Hlavička souboru s AST.
+ */
+typedef struct ASTserializer_Header {
+    char magic[AST_SERIALIZER_MAGIC_SIZE];  /**< Identifikace @c AST_SERIALIZER_MAGIC       */
+    uint32_t version;                       /**< Verze formátu @c AST_SERIALIZER_VERSION    */
+    uint32_t nodeCount;                     /**< Počet uzlů                                 */
+    uint64_t inputHash;                     /**< Hash obsahu vstupu                         */
+    uint64_t inputLength;                   /**< Délka vstupu v bajtech                     */
+    uint64_t stringsSize;                   /**< Velikost tabulky řetězců v bajtech         */
+    uint64_t frameCount;                    /**< Počet rámců tabulky symbolů bez globálního */
+    uint64_t checksum;                      /**< Kontrolní součet uzlů a tabulky řetězců    */
+} ASTserializer_Header;
+
+/**
+ * @brief Uzel AST v serializované podobě.
+ *
+ * @details Význam položek podle typu uzlu:
+ *          - program: `child[0]` importovaný soubor, `child[1]` první funkce,
+ *          - definice funkce: `identifier`, `dataType` návratový typ, `frameID`
+ *            rámec těla, `child[0]` parametry, `child[1]` tělo, `child[2]` další,
+ *          - argument/parametr: `kind` datový typ, `child[0]` výraz, `child[1]` další,
+ *          - příkaz: `kind` typ příkazu, `frameID`, `child[0]` příkaz, `child[1]` další,
+ *          - volání funkce: `identifier`, příznak vestavěné funkce, `child[0]` argumenty,
+ *          - if a while: `child[0]` podmínka, `child[1]` nullable podmínka,
+ *            `child[2]` větev then nebo tělo, `child[3]` větev else,
+ *          - výraz: `kind` typ výrazu, `child[0]` konkrétní uzel,
+ *          - binární operace: `kind` operátor, `child[0]` a `child[1]` operandy,
+ *          - proměnná a literál: `identifier`, `kind` typ literálu, `frameID`,
+ *            `value` hodnota (bity čísla, nebo posun řetězce), u proměnné
+ *            `dataType` stav symbolu v tabulce symbolů.
+ */
+typedef struct ASTserializer_Node {
+    uint8_t nodeType;                           /**< Typ uzlu (@c AST_NodeType)           */
+    uint8_t kind;                               /**< Podtyp uzlu podle jeho typu          */
+    uint8_t flags;                              /**< Příznaky @c AST_SERIALIZER_FLAG_*    */
+    uint8_t dataType;                           /**< Návratový typ nebo stav symbolu      */
+    uint32_t identifier;                        /**< Posun identifikátoru v tabulce       */
+    uint32_t child[AST_SERIALIZER_CHILDREN];    /**< Indexy potomků                       */
+    uint64_t frameID;                           /**< ID rámce                             */
+    uint64_t value;                             /**< Hodnota literálu                     */
+} ASTserializer_Node;
+
+/**
+ * @brief Rozpracovaný serializovaný AST při zápisu.
+ */
+typedef struct ASTserializer_Buffer {
+    ASTserializer_Node *nodes;          /**< Pole uzlů                          */
+    size_t nodeCount;                   /**< Počet uzlů                         */
+    size_t nodeCapacity;                /**< Kapacita pole uzlů                 */
+    char *strings;                      /**< Tabulka řetězců                    */
+    size_t stringsSize;                 /**< Velikost tabulky řetězců           */
+    size_t stringsCapacity;             /**< Kapacita tabulky řetězců           */
+    bool failed;                        /**< Příznak chyby alokace              */
+} ASTserializer_Buffer;
+
+/**
+ * @brief Načtený serializovaný AST při sestavování stromu.
+ */
+typedef struct ASTserializer_View {
+    const ASTserializer_Node *nodes;    /**< Pole uzlů                          */
+    size_t nodeCount;                   /**< Počet uzlů                         */
+    const char *strings;                /**< Tabulka řetězců                    */
+    size_t stringsSize;                 /**< Velikost tabulky řetězců           */
+    size_t frameCount;                  /**< Počet rámců bez globálního         */
+    bool failed;                        /**< Příznak neplatného souboru         */
+} ASTserializer_View;
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                         DEKLARACE VEŘEJNÝCH FUNKCÍ                          *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Uloží AST programu do souboru.
+ *
+ * @details Musí být voláno po sémantické analýze, dokud je naplněn globální
+ *          rámec s definicemi funkcí.
+ *
+ * @param [in] path Cesta k souboru
+ * @param [in] inputHash Hash obsahu vstupu
+ * @param [in] inputLength Délka vstupu
+ *
+ * @return `true`, pokud se soubor podařilo zapsat, jinak `false`.
+ */
+bool ASTserializer_saveProgram(const char *path, uint64_t inputHash, uint64_t inputLength);
+
+/**
+ * @brief Načte AST programu ze souboru.
+ *
+ * @details Pokud soubor neexistuje, neodpovídá vstupu nebo je poškozený,
+ *          vrátí `false` a nezanechá žádný AST ani rámce.
+ *
+ * @param [in] path Cesta k souboru
+ * @param [in] inputHash Hash obsahu vstupu
+ * @param [in] inputLength Délka vstupu
+ *
+ * @return `true`, pokud byl AST načten, jinak `false`.
+ */
+bool ASTserializer_loadProgram(const char *path, uint64_t inputHash, uint64_t inputLength);
+
+/**
+ * @brief Načte AST načteného vstupu scanneru z adresáře cache.
+ *
+ * @param [in] directory Cesta k adresáři cache, nebo `NULL`
+ *
+ * @return `true`, pokud byl AST načten, jinak `false`.
+ */
+bool ASTserializer_loadFromCache(const char *directory);
+
+/**
+ * @brief Uloží AST načteného vstupu scanneru do adresáře cache.
+ *
+ * @param [in] directory Cesta k adresáři cache, nebo `NULL`
+ */
+void ASTserializer_storeToCache(const char *directory);
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                         DEKLARACE INTERNÍCH FUNKCÍ                          *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Sestaví cestu k souboru cache pro načtený vstup scanneru.
+ *
+ * @param [in] directory Cesta k adresáři cache
+ * @param [out] path Buffer o velikosti @c AST_SERIALIZER_PATH_SIZE
+ *
+ * @return `true`, pokud se cestu podařilo sestavit, jinak `false`.
+ */
+bool ASTserializer_cachePath(const char *directory, char *path);
+
+/**
+ * @brief Přidá do bufferu nový uzel.
+ *
+ * @param [in,out] buffer Ukazatel na buffer
+ * @param [in] nodeType Typ uzlu
+ *
+ * @return Index nového uzlu, nebo @c AST_SERIALIZER_NONE při chybě.
+ */
+uint32_t ASTserializer_addNode(ASTserializer_Buffer *buffer, AST_NodeType nodeType);
+
+/**
+ * @brief Přidá do tabulky řetězců dynamický řetězec.
+ *
+ * @param [in,out] buffer Ukazatel na buffer
+ * @param [in] str Ukazatel na řetězec (může být `NULL`)
+ *
+ * @return Posun řetězce, nebo @c AST_SERIALIZER_NONE.
+ */
+uint32_t ASTserializer_addString(ASTserializer_Buffer *buffer, DString *str);
+
+/**
+ * @brief Serializuje seznam definic funkcí.
+ *
+ * @param [in,out] buffer Ukazatel na buffer
+ * @param [in] funDef Ukazatel na první funkci seznamu
+ *
+ * @return Index prvního uzlu seznamu, nebo @c AST_SERIALIZER_NONE.
+ */
+uint32_t ASTserializer_writeFunDefList(ASTserializer_Buffer *buffer, AST_FunDefNode *funDef);
+
+/**
+ * @brief Serializuje seznam argumentů nebo parametrů.
+ *
+ * @param [in,out] buffer Ukazatel na buffer
+ * @param [in] arg Ukazatel na první argument seznamu
+ *
+ * @return Index prvního uzlu seznamu, nebo @c AST_SERIALIZER_NONE.
+ */
+uint32_t ASTserializer_writeArgList(ASTserializer_Buffer *buffer, AST_ArgOrParamNode *arg);
+
+/**
+ * @brief Serializuje seznam příkazů.
+ *
+ * @param [in,out] buffer Ukazatel na buffer
+ * @param [in] statement Ukazatel na první příkaz seznamu
+ *
+ * @return Index prvního uzlu seznamu, nebo @c AST_SERIALIZER_NONE.
+ */
+uint32_t ASTserializer_writeStatementList(ASTserializer_Buffer *buffer,
+                                          AST_StatementNode *statement);
+
+/**
+ * @brief Serializuje uzel výrazu.
+ *
+ * @param [in,out] buffer Ukazatel na buffer
+ * @param [in] expr Ukazatel na výraz
+ *
+ * @return Index uzlu, nebo @c AST_SERIALIZER_NONE.
+ */
+uint32_t ASTserializer_writeExpr(ASTserializer_Buffer *buffer, AST_ExprNode *expr);
+
+/**
+ * @brief Serializuje uzel volání funkce.
+ *
+ * @param [in,out] buffer Ukazatel na buffer
+ * @param [in] funCall Ukazatel na volání funkce
+ *
+ * @return Index uzlu, nebo @c AST_SERIALIZER_NONE.
+ */
+uint32_t ASTserializer_writeFunCall(ASTserializer_Buffer *buffer, AST_FunCallNode *funCall);
+
+/**
+ * @brief Serializuje uzel proměnné nebo literálu.
+ *
+ * @param [in,out] buffer Ukazatel na buffer
+ * @param [in] var Ukazatel na proměnnou nebo literál
+ *
+ * @return Index uzlu, nebo @c AST_SERIALIZER_NONE.
+ */
+uint32_t ASTserializer_writeVar(ASTserializer_Buffer *buffer, AST_VarNode *var);
+
+/**
+ * @brief Přičte data ke kontrolnímu součtu souboru s AST.
+ *
+ * @details Součet je FNV-1a jako u hashe vstupu, lze jej ale počítat
+ *          po částech, protože uzly a řetězce leží při zápisu v různých
+ *          polích a při čtení za sebou.
+ *
+ * @param [in] hash Dosavadní součet, na začátku @c AST_SERIALIZER_CHECKSUM_BASIS
+ * @param [in] data Ukazatel na data
+ * @param [in] length Délka dat v bajtech
+ *
+ * @return Nový kontrolní součet.
+ */
+uint64_t ASTserializer_checksum(uint64_t hash, const void *data, size_t length);
+
+/**
+ * @brief Ověří odkazy uzlů na potomky a řetězce a tvar každého uzlu.
+ *
+ * @details Každý uzel kromě kořene musí mít právě jednoho rodiče, jinak by
+ *          sestavený strom sdílel podstrom a uvolnil jej dvakrát.
+ *
+ * @param [in] view Ukazatel na načtený AST
+ *
+ * @return `true`, pokud jsou všechny odkazy i uzly platné, jinak `false`.
+ */
+bool ASTserializer_validate(const ASTserializer_View *view);
+
+/**
+ * @brief Ověří odkazy jednoho uzlu na potomky, rámce a řetězce.
+ *
+ * @param [in] view Ukazatel na načtený AST
+ * @param [in] node Ověřovaný uzel
+ * @param [in] index Index ověřovaného uzlu
+ * @param [in,out] parents Počty již nalezených rodičů jednotlivých uzlů
+ *
+ * @return `true`, pokud jsou všechny odkazy uzlu platné, jinak `false`.
+ */
+bool ASTserializer_validateLinks(const ASTserializer_View *view, const ASTserializer_Node *node,
+                                 size_t index, uint8_t *parents);
+
+/**
+ * @brief Ověří, že podtyp, příznaky a potomci uzlu odpovídají jeho typu.
+ *
+ * @details Odmítne například příznak vestavěné funkce u uzlu, který není
+ *          voláním známé vestavěné funkce, nebo literál bez hodnoty.
+ *
+ * @param [in] view Ukazatel na načtený AST
+ * @param [in] node Ověřovaný uzel
+ *
+ * @return `true`, pokud je uzel platný, jinak `false`.
+ */
+bool ASTserializer_validateNode(const ASTserializer_View *view, const ASTserializer_Node *node);
+
+/**
+ * @brief Vrátí uzel s daným indexem, pokud má očekávaný typ.
+ *
+ * @param [in,out] view Ukazatel na načtený AST
+ * @param [in] index Index uzlu
+ * @param [in] nodeType Očekávaný typ uzlu
+ *
+ * @return Ukazatel na uzel, nebo `NULL` (u neshody typu nastaví příznak chyby).
+ */
+const ASTserializer_Node *ASTserializer_node(ASTserializer_View *view, uint32_t index,
+                                             AST_NodeType nodeType);
+
+/**
+ * @brief Vytvoří dynamický řetězec z tabulky řetězců.
+ *
+ * @param [in] view Ukazatel na načtený AST
+ * @param [in] offset Posun řetězce
+ *
+ * @return Ukazatel na nový řetězec, nebo `NULL` pro chybějící řetězec.
+ */
+DString *ASTserializer_readString(ASTserializer_View *view, uint32_t offset);
+
+/**
+ * @brief Sestaví seznam definic funkcí.
+ *
+ * @param [in,out] view Ukazatel na načtený AST
+ * @param [in] index Index prvního uzlu seznamu
+ *
+ * @return Ukazatel na první funkci seznamu.
+ */
+AST_FunDefNode *ASTserializer_readFunDefList(ASTserializer_View *view, uint32_t index);
+
+/**
+ * @brief Sestaví seznam argumentů nebo parametrů.
+ *
+ * @param [in,out] view Ukazatel na načtený AST
+ * @param [in] index Index prvního uzlu seznamu
+ *
+ * @return Ukazatel na první argument seznamu.
+ */
+AST_ArgOrParamNode *ASTserializer_readArgList(ASTserializer_View *view, uint32_t index);
+
+/**
+ * @brief Sestaví seznam příkazů.
+ *
+ * @param [in,out] view Ukazatel na načtený AST
+ * @param [in] index Index prvního uzlu seznamu
+ *
+ * @return Ukazatel na první příkaz seznamu.
+ */
+AST_StatementNode *ASTserializer_readStatementList(ASTserializer_View *view, uint32_t index);
+
+/**
+ * @brief Sestaví uzel výrazu.
+ *
+ * @param [in,out] view Ukazatel na načtený AST
+ * @param [in] index Index uzlu
+ *
+ * @return Ukazatel na výraz.
+ */
+AST_ExprNode *ASTserializer_readExpr(ASTserializer_View *view, uint32_t index);
+
+/**
+ * @brief Sestaví uzel volání funkce.
+ *
+ * @param [in,out] view Ukazatel na načtený AST
+ * @param [in] index Index uzlu
+ *
+ * @return Ukazatel na volání funkce.
+ */
+AST_FunCallNode *ASTserializer_readFunCall(ASTserializer_View *view, uint32_t index);
+
+/**
+ * @brief Sestaví uzel proměnné nebo literálu.
+ *
+ * @param [in,out] view Ukazatel na načtený AST
+ * @param [in] index Index uzlu
+ *
+ * @return Ukazatel na proměnnou nebo literál.
+ */
+AST_VarNode *ASTserializer_readVar(ASTserializer_View *view, uint32_t index);
+
+/**
+ * @brief Obnoví záznamy definic funkcí v globálním rámci.
+ *
+ * @param [in] view Ukazatel na načtený AST
+ *
+ * @return `true`, pokud se záznamy podařilo vytvořit, jinak `false`.
+ */
+bool ASTserializer_restoreFunctions(ASTserializer_View *view);
+
+/**
+ * @brief Obnoví rámce a záznamy proměnných, na které odkazuje AST.
+ *
+ * @details Generátor kódu zjišťuje typ operandů dělení z tabulky symbolů,
+ *          proto se pro každou proměnnou obnoví její stav symbolu.
+ *
+ * @param [in] view Ukazatel na načtený AST
+ *
+ * @return `true`, pokud se záznamy podařilo vytvořit, jinak `false`.
+ */
+bool ASTserializer_restoreSymbols(ASTserializer_View *view);
+
+/**
+ * @brief Namapuje soubor do paměti pouze pro čtení.
+ *
+ * @details Na systémech POSIX využívá `mmap`, jinde soubor načte do paměti.
+ *
+ * @param [in] path Cesta k souboru
+ * @param [out] size Velikost souboru
+ *
+ * @return Ukazatel na obsah souboru, nebo `NULL` při chybě.
+ */
+const char *ASTserializer_mapFile(const char *path, size_t *size);
+
+/**
+ * @brief Uvolní soubor namapovaný funkcí @c ASTserializer_mapFile().
+ *
+ * @param [in] data Ukazatel na obsah souboru
+ * @param [in] size Velikost souboru
+ */
+void ASTserializer_unmapFile(const char *data, size_t size);
+
+#endif // AST_SERIALIZER_H_
+
+/*** Konec souboru ast_serializer.h ***/
@@ -31,6 +31,110 @@
  */
 
 #include "built_in_functions.h"
+#include "tac_generator.h"
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                   KÓD VESTAVĚNÝCH FUNKCÍ V CÍLOVÉM JAZYCE                   *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Kód vestavěné funkce `pub fn ifj.substring(s: []u8, i: i32, j: i32) ?[]u8`.
+ */
+static const char builtInFunSubstring[] =
+    "LABEL $$ifj$substring\n"
+    "PUSHFRAME\n"
+    "LT GF@?tempDEST LF@i int@0\n"
+    "JUMPIFEQ $$$null GF@?tempDEST bool@true\n"
+    "LT GF@?tempDEST LF@j int@0\n"
+    "JUMPIFEQ $$$null GF@?tempDEST bool@true\n"
+    "GT GF@?tempDEST LF@i LF@j\n"
+    "JUMPIFEQ $$$null GF@?tempDEST bool@true\n"
+    "STRLEN GF@?tempSRC1 LF@s\n"
+    "GT GF@?tempDEST LF@i GF@?tempSRC1\n"
+    "JUMPIFEQ $$$null GF@?tempDEST bool@true\n"
+    "EQ GF@?tempDEST LF@i GF@?tempSRC1\n"
+    "JUMPIFEQ $$$null GF@?tempDEST bool@true\n"
+    "GT GF@?tempDEST LF@j GF@?tempSRC1\n"
+    "JUMPIFEQ $$$null GF@?tempDEST bool@true\n"
+    "MOVE GF@?tempDEST string@\n"
+    "LABEL $$$while\n"
+    "JUMPIFEQ $$$substring_success LF@i LF@j\n"
+    "GETCHAR GF@?tempSRC1 LF@s LF@i\n"
+    "CONCAT GF@?tempDEST GF@?tempDEST GF@?tempSRC1\n"
+    "ADD LF@i LF@i int@1\n"
+    "JUMP $$$while\n"
+    "LABEL $$$null\n"
+    "PUSHS nil@nil\n"
+    "JUMP $$$substring_end\n"
+    "LABEL $$$substring_success\n"
+    "PUSHS GF@?tempDEST\n"
+    "LABEL $$$substring_end\n"
+    "POPFRAME\n"
+    "RETURN\n";
+
+/**
+ * @brief Kód vestavěné funkce `pub fn ifj.strcmp(s1: []u8, s2: []u8) i32`.
+ */
+static const char builtInFunStrcmp[] =
+    "LABEL $$ifj$strcmp\n"
+    "PUSHFRAME\n"
+    "STRLEN GF@?tempSRC1 LF@s1\n"
+    "STRLEN GF@?tempSRC2 LF@s2\n"
+    "DEFVAR LF@len\n"
+    "MOVE LF@len GF@?tempSRC1\n"
+    "LT GF@?tempDEST GF@?tempSRC1 GF@?tempSRC2\n"
+    "JUMPIFEQ $$$cmp_def GF@?tempDEST bool@true\n"
+    "MOVE LF@len GF@?tempSRC2\n"
+    "LABEL $$$cmp_def\n"
+    "DEFVAR LF@i\n"
+    "MOVE LF@i int@0\n"
+    "LABEL $$$cmp_while\n"
+    "JUMPIFEQ $$$strcmp0 LF@i LF@len\n"
+    "GETCHAR GF@?tempSRC1 LF@s1 LF@i\n"
+    "GETCHAR GF@?tempSRC2 LF@s2 LF@i\n"
+    "LT GF@?tempDEST GF@?tempSRC1 GF@?tempSRC2\n"
+    "JUMPIFEQ $$$strcmp-1 GF@?tempDEST bool@true\n"
+    "GT GF@?tempDEST GF@?tempSRC1 GF@?tempSRC2\n"
+    "JUMPIFEQ $$$strcmp1 GF@?tempDEST bool@true\n"
+    "ADD LF@i LF@i int@1\n"
+    "JUMP $$$cmp_while\n"
+    "LABEL $$$strcmp-1\n"
+    "PUSHS int@-1\n"
+    "JUMP $$$cmp_end\n"
+    "LABEL $$$strcmp1\n"
+    "PUSHS int@1\n"
+    "JUMP $$$cmp_end\n"
+    "LABEL $$$strcmp0\n"
+    "PUSHS int@0\n"
+    "LABEL $$$cmp_end\n"
+    "POPFRAME\n"
+    "RETURN\n";
+
+/**
+ * @brief Tabulka podprogramů vestavěných funkcí indexovaná výčtem `BuiltIn_routine`.
+ *
+ * @details Délky kódu jsou známy již v době překladu, při výpisu se tedy
+ *          nemusí nic počítat.
+ */
+static const struct {
+    const char *identifier;     /**< Identifikátor funkce bez prefixu `ifj.` */
+    const char *code;           /**< Kód funkce v jazyce IFJcode24           */
+    size_t length;              /**< Délka kódu bez ukončovacího znaku       */
+} builtInRoutines[BUILT_IN_ROUTINE_COUNT] = {
+    [BUILT_IN_ROUTINE_SUBSTRING] = {"substring", builtInFunSubstring, sizeof(builtInFunSubstring) - 1},
+    [BUILT_IN_ROUTINE_STRCMP]    = {"strcmp",    builtInFunStrcmp,    sizeof(builtInFunStrcmp) - 1},
+};
+
+/**
+ * @brief Příznaky podprogramů, na které se program odkazuje.
+ *
+ * @details Každé vlákno generátoru má vlastní příznaky, výsledky vláken
+ *          se slučují pomocí masek.
+ */
+static _Thread_local bool builtInUsed[BUILT_IN_ROUTINE_COUNT] = {false};
 
 
 /*******************************************************************************
@@ -39,156 +143,76 @@
  *                                                                             *
  ******************************************************************************/
 
+/**
+ * @brief Označí podprogram vestavěné funkce jako použitý.
+ */
+void TAC_builtInMarkUsed(const char *identifier) {
+    if(identifier == NULL) {
+        return;
+    }
+
+    for(size_t i = 0; i < BUILT_IN_ROUTINE_COUNT; i++) {
+        if(strcmp(identifier, builtInRoutines[i].identifier) == 0) {
+            builtInUsed[i] = true;
+            return;
+        }
+    }
+} // TAC_builtInMarkUsed()
+
+/**
+ * @brief Zruší označení všech podprogramů vestavěných funkcí.
+ */
+void TAC_builtInReset() {
+    for(size_t i = 0; i < BUILT_IN_ROUTINE_COUNT; i++) {
+        builtInUsed[i] = false;
+    }
+} // TAC_builtInReset()
+
+/**
+ * @brief Vrátí bitovou masku použitých podprogramů vestavěných funkcí.
+ */
+uint32_t TAC_builtInUsedMask() {
+    uint32_t mask = 0;
+    for(size_t i = 0; i < BUILT_IN_ROUTINE_COUNT; i++) {
+        if(builtInUsed[i]) {
+            mask |= UINT32_C(1) << i;
+        }
+    }
+
+    return mask;
+} // TAC_builtInUsedMask()
+
+/**
+ * @brief Označí jako použité podprogramy z bitové masky.
+ */
+void TAC_builtInMarkMask(uint32_t mask) {
+    for(size_t i = 0; i < BUILT_IN_ROUTINE_COUNT; i++) {
+        if(mask & (UINT32_C(1) << i)) {
+            builtInUsed[i] = true;
+        }
+    }
+} // TAC_builtInMarkMask()
+
 /**
  * @brief Generuje vestavěné funkce pro cílový kód IFJcode24.
  */
 void TAC_builtInFunctions() {
-    // Kód pro vestavěnou funkci "ifj.substring()""
-    char builtInFunSubstring[] = "\n\
-        #---------------------------------------------------\n\
-        #pub fn ifj.substring(s: []u8, i: i32, j: i32) ?[]u8\n\
-        LABEL $$ifj$substring\n\
-        PUSHFRAME\n\
-        \n\
-            LT GF@?tempDEST LF@i int@0\n\
-            JUMPIFEQ $$$null GF@?tempDEST bool@true\n\
-            \n\
-            LT GF@?tempDEST LF@j int@0\n\
-            JUMPIFEQ $$$null GF@?tempDEST bool@true\n\
-            \n\
-            GT GF@?tempDEST LF@i LF@j\n\
-            JUMPIFEQ $$$null GF@?tempDEST bool@true\n\
-            \n\
-            STRLEN GF@?tempSRC1 LF@s\n\
-            \n\
-            GT GF@?tempDEST LF@i GF@?tempSRC1\n\
-            JUMPIFEQ $$$null GF@?tempDEST bool@true\n\
-            EQ GF@?tempDEST LF@i GF@?tempSRC1\n\
-            JUMPIFEQ $$$null GF@?tempDEST bool@true\n\
-            \n\
-            GT GF@?tempDEST LF@j GF@?tempSRC1\n\
-            JUMPIFEQ $$$null GF@?tempDEST bool@true\n\
-        \n\
-        PUSHS string@ \n\
-        POPS GF@?tempDEST \n\
-        \n\
-        LABEL $$$while\n\
-        \n\
-            JUMPIFEQ $$$substring_success LF@i LF@j\n\
-            \n\
-            GETCHAR GF@?tempSRC1 LF@s LF@i\n\
-            CONCAT GF@?tempDEST GF@?tempDEST GF@?tempSRC1\n\
-            ADD LF@i LF@i int@1\n\
-            JUMP $$$while\n\
-        \n\
-        LABEL $$$null\n\
-            PUSHS nil@nil\n\
-            JUMP $$$substring_end\n\
-        \n\
-        LABEL $$$substring_success\n\
-            PUSHS GF@?tempDEST\n\
-        \n\
-        LABEL $$$substring_end\n\
-        \n\
-        POPFRAME\n\
-        RETURN\n\
-        \n\
-        \n\
-        ";
-
-    // Kód pro vestavěnou funkci "ifj.strcmp()""
-    char builtInFunStrcmp[] = "\n\
-        #-----------------------------------------\n\
-        #pub fn ifj.strcmp(s1: []u8, s2: []u8) i32\n\
-        LABEL $$ifj$strcmp\n\
-        PUSHFRAME\n\
-        \n\
-        STRLEN GF@?tempSRC1 LF@s1\n\
-        STRLEN GF@?tempSRC2 LF@s2\n\
-        DEFVAR LF@len\n\
-        MOVE LF@len GF@?tempSRC1\n\
-        \n\
-        LT GF@?tempDEST GF@?tempSRC1 GF@?tempSRC2\n\
-        JUMPIFEQ $$$cmp_def GF@?tempDEST bool@true\n\
-        \n\
-        MOVE LF@len GF@?tempSRC2\n\
-        \n\
-        LABEL $$$cmp_def\n\
-        DEFVAR LF@i\n\
-        MOVE LF@i int@0\n\
-        LABEL $$$cmp_while\n\
-        \n\
-            JUMPIFEQ $$$strcmp0 LF@i LF@len\n\
-            GETCHAR GF@?tempSRC1 LF@s1 LF@i\n\
-            GETCHAR GF@?tempSRC2 LF@s2 LF@i\n\
-            \n\
-            LT GF@?tempDEST GF@?tempSRC1 GF@?tempSRC2\n\
-            JUMPIFEQ $$$strcmp-1 GF@?tempDEST bool@true\n\
-            \n\
-            GT GF@?tempDEST GF@?tempSRC1 GF@?tempSRC2\n\
-            JUMPIFEQ $$$strcmp1 GF@?tempDEST bool@true\n\
-            \n\
-            ADD LF@i LF@i int@1\n\
-        \n\
-        JUMP $$$cmp_while\n\
-        \n\
-        LABEL $$$strcmp-1\n\
-            PUSHS int@-1\n\
-            JUMP $$$cmp_end\n\
-        \n\
-        LABEL $$$strcmp1\n\
-            PUSHS int@1\n\
-            JUMP $$$cmp_end\n\
-        \n\
-        LABEL $$$strcmp0\n\
-            PUSHS int@0\n\
-            JUMP $$$cmp_end\n\
-        \n\
-        LABEL $$$cmp_end\n\
-        \n\
-        POPFRAME\n\
-        RETURN\n\
-        \n\
-        \n\
-        ";
-
-    // Kód pro vestavěnou funkci "ifj.ord()""
-    char builtInFunOrd[] = "\n\
-        #-----------------------------------------\n\
-        #pub fn ifj.ord(s: []u8, i: i32) i32\n\
-        LABEL $$ifj$ord\n\
-        PUSHFRAME\n\
-        \n\
-        STRLEN GF@?tempSRC1 LF@s\n\
-        EQ GF@?tempDEST GF@?tempSRC1 int@0\n\
-        JUMPIFEQ $$$ord_zero GF@?tempDEST bool@true\n\
-        \n\
-        LT GF@?tempDEST LF@i int@0\n\
-        JUMPIFEQ $$$ord_zero GF@?tempDEST bool@true\n\
-        EQ GF@?tempDEST LF@i GF@?tempSRC1\n\
-        JUMPIFEQ $$$ord_zero GF@?tempDEST bool@true\n\
-        GT GF@?tempDEST LF@i GF@?tempSRC1\n\
-        JUMPIFEQ $$$ord_zero GF@?tempDEST bool@true\n\
-        \n\
-        STRI2INT GF@?tempDEST LF@s LF@i\n\
-        PUSHS GF@?tempDEST\n\
-        JUMP $$$ord_end\n\
-        \n\
-        # Vrácení hodnoty 0\n\
-        LABEL $$$ord_zero\n\
-        PUSHS int@0\n\
-        \n\
-        LABEL $$$ord_end\n\
-        POPFRAME\n\
-        RETURN\n\
-        \n\
-        \n\
-        ";
-
-    // Vytiskne kód pro vestavěné funkce
-    printf("%s", builtInFunSubstring);
-    printf("%s", builtInFunStrcmp);
-    printf("%s", builtInFunOrd);
+    // Buffer pojme kód všech podprogramů najednou
+    char buffer[sizeof(builtInFunSubstring) + sizeof(builtInFunStrcmp)];
+    size_t length = 0;
+
+    // Poskládáme pouze použité podprogramy
+    for(size_t i = 0; i < BUILT_IN_ROUTINE_COUNT; i++) {
+        if(builtInUsed[i]) {
+            memcpy(buffer + length, builtInRoutines[i].code, builtInRoutines[i].length);
+            length += builtInRoutines[i].length;
+        }
+    }
+
+    // Vytiskne kód použitých vestavěných funkcí jediným zápisem
+    if(length > 0) {
+        fwrite(buffer, sizeof(char), length, TAC_OUTPUT);
+    }
 } // TAC_builtInFunctions()
 
 /*** Konec souboru built_in_functions.c ***/
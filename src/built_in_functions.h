@@ -38,6 +38,25 @@
 
 // Import standardních knihoven jazyka C
 #include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                             VÝČTOVÉ DATOVÉ TYPY                             *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Výčet vestavěných funkcí, které mají v cílovém kódu vlastní podprogram.
+ */
+typedef enum BuiltIn_routine {
+    BUILT_IN_ROUTINE_SUBSTRING = 0,     /**< Podprogram `$$ifj$substring` */
+    BUILT_IN_ROUTINE_STRCMP    = 1,     /**< Podprogram `$$ifj$strcmp`    */
+    BUILT_IN_ROUTINE_COUNT     = 2,     /**< Počet podprogramů            */
+} BuiltIn_routine;
 
 
 /*******************************************************************************
@@ -46,14 +65,50 @@
  *                                                                             *
  ******************************************************************************/
 
+/**
+ * @brief Označí podprogram vestavěné funkce jako použitý.
+ *
+ * @details Volá generátor kódu při generování instrukce `CALL` na vestavěnou
+ *          funkci. Identifikátory bez vlastního podprogramu jsou ignorovány.
+ *
+ * @param [in] identifier Identifikátor funkce bez prefixu `ifj.`
+ */
+void TAC_builtInMarkUsed(const char *identifier);
+
+/**
+ * @brief Zruší označení všech podprogramů vestavěných funkcí.
+ */
+void TAC_builtInReset();
+
+/**
+ * @brief Vrátí bitovou masku použitých podprogramů vestavěných funkcí.
+ *
+ * @return Maska, ve které bit @c BuiltIn_routine značí použitý podprogram.
+ */
+uint32_t TAC_builtInUsedMask();
+
+/**
+ * @brief Označí jako použité podprogramy z bitové masky.
+ *
+ * @details Slouží k obnovení použitých podprogramů u funkce, jejíž kód nebyl
+ *          generován, ale převzat z cache.
+ *
+ * @param [in] mask Maska vrácená funkcí @c TAC_builtInUsedMask()
+ */
+void TAC_builtInMarkMask(uint32_t mask);
+
 /**
  * @brief Generuje vestavěné funkce pro cílový kód IFJcode24.
  *
- * @details Tato funkce generuje kód pro vestavěné funkce, které jsou součástí
- *          jazyka IFJ24. Tyto funkce zahrnují:
+ * @details Tato funkce vypíše kód pro vestavěné funkce, které jsou součástí
+ *          jazyka IFJ24 a které byly označeny jako použité. Tyto funkce
+ *          zahrnují:
  *          - @c ifj.substring()
  *          - @c ifj.strcmp()
- *          - @c ifj.ord()
+ *
+ *          Funkce @c ifj.ord() je generována přímo v místě volání.
+ *          Kód je uložen jako statický řetězec bez odsazení a komentářů
+ *          a vypíše se jediným zápisem do výstupu generátoru kódu.
  */
 void TAC_builtInFunctions();
 
@@ -112,6 +112,31 @@ int DString_appendChar(DString *str, char character) {
     return STRING_SUCCESS;
 } // konec DString_appendChar()
 
+/**
+ * @brief Přidání úseku znaků na konec dynamického řetězce.
+*/
+int DString_appendChars(DString *str, const char *chars, size_t count) {
+    // Kontrola, že přijatý ukazatel není NULL
+    if(str == NULL) {
+        return STRING_RESIZE_FAIL;
+    }
+
+    // Pokud se úsek (i s nulovým znakem) nevejde, zvětšíme řetězec najednou
+    if(str->length + count + 1 >= str->allocatedSize) {
+        str = DString_resize(str, count + DEFAULT_RESIZE_SIZE);
+        if(str == NULL){
+            return STRING_RESIZE_FAIL;
+        }
+    }
+
+    // Přidání znaků na konec
+    memcpy(str->str + str->length, chars, count);
+    // Délka řetězce se zvětší o počet přidaných znaků
+    str->length += count;
+
+    return STRING_SUCCESS;
+} // konec DString_appendChars()
+
 /**
  * @brief Zkopíruje obsah jednoho dynamického řetězce do druhého.
 */
@@ -132,6 +132,21 @@ void DString_free(DString *str);
  */
 int DString_appendChar(DString *str, char character);
 
+/**
+ * @brief   Přidání úseku znaků na konec dynamického řetězce.
+ *
+ * @details Řetězec se zvětší nejvýše jednou, a to o délku úseku a
+ *          @c DEFAULT_RESIZE_SIZE.
+ *
+ * @param [in,out] str Ukazatel na datový typ DString
+ * @param [in] chars Ukazatel na první přidávaný znak
+ * @param [in] count Počet přidávaných znaků
+ *
+ * @return Vrací @c STRING_SUCCESS, pokud se vyvedla operace.
+ *         Vrací @c STRING_RESIZE_FAIL, pokud se nezdařilo nafouknout datový typ.
+ */
+int DString_appendChars(DString *str, const char *chars, size_t count);
+
 /**
  * @brief   Zkopíruje obsah jednoho dynamického řetězce do druhého.
  *
@@ -34,6 +34,11 @@
 #include "frame_stack.h"
 #include "ast_interface.h"
 #include "tac_generator.h"
+#include "scanner_input.h"
+#include "token_cache.h"
+#include "scanner_pipeline.h"
+#include "output_writer.h"
+#include "incremental.h"
 
 /*******************************************************************************
  *                                                                             *
@@ -168,6 +173,11 @@ inline void error_freeAll() {
     precStackList_destroy();
     frameStack_destroyAll();
     AST_destroyTree();
+    outputWriter_finish();
+    scannerPipeline_free();
+    tokenCache_free();
+    incremental_free();
+    scannerInput_free();
 } // error_freeAll()
 
 /**
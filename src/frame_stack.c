@@ -45,6 +45,43 @@ FrameStack frameStack = {NULL, NULL, 0};
  */
 FrameArray frameArray = {0, NULL};
 
+/**
+ * @brief Statická tabulka signatur vestavěných funkcí jazyka IFJ24.
+ *
+ * @details Funkce `ifj.write` a `ifj.string` přijímají více typů, proto je
+ *          typ jejich parametru ponechán jako neznámý a sémantický analyzátor
+ *          je kontroluje jako speciální případy.
+ */
+static const BuiltInSignature builtInTable[] = {
+    // Funkce pro načítání hodnot
+    {"readstr",   SYMTABLE_TYPE_STRING_OR_NULL, 0, {{NULL, SYMTABLE_TYPE_UNKNOWN}}},
+    {"readi32",   SYMTABLE_TYPE_INT_OR_NULL,    0, {{NULL, SYMTABLE_TYPE_UNKNOWN}}},
+    {"readf64",   SYMTABLE_TYPE_DOUBLE_OR_NULL, 0, {{NULL, SYMTABLE_TYPE_UNKNOWN}}},
+    // Funkce pro výpis hodnoty
+    {"write",     SYMTABLE_TYPE_VOID,           1, {{"term", SYMTABLE_TYPE_UNKNOWN}}},
+    // Funkce pro konverzi číselných typů
+    {"i2f",       SYMTABLE_TYPE_DOUBLE,         1, {{"term", SYMTABLE_TYPE_INT}}},
+    {"f2i",       SYMTABLE_TYPE_INT,            1, {{"term", SYMTABLE_TYPE_DOUBLE}}},
+    // Funkce pro práci s řezy
+    {"string",    SYMTABLE_TYPE_STRING,         1, {{"term", SYMTABLE_TYPE_UNKNOWN}}},
+    {"length",    SYMTABLE_TYPE_INT,            1, {{"s", SYMTABLE_TYPE_STRING}}},
+    {"concat",    SYMTABLE_TYPE_STRING,         2, {{"s1", SYMTABLE_TYPE_STRING},
+                                                    {"s2", SYMTABLE_TYPE_STRING}}},
+    {"substring", SYMTABLE_TYPE_STRING_OR_NULL, 3, {{"s", SYMTABLE_TYPE_STRING},
+                                                    {"i", SYMTABLE_TYPE_INT},
+                                                    {"j", SYMTABLE_TYPE_INT}}},
+    {"strcmp",    SYMTABLE_TYPE_INT,            2, {{"s1", SYMTABLE_TYPE_STRING},
+                                                    {"s2", SYMTABLE_TYPE_STRING}}},
+    {"ord",       SYMTABLE_TYPE_INT,            2, {{"s", SYMTABLE_TYPE_STRING},
+                                                    {"i", SYMTABLE_TYPE_INT}}},
+    {"chr",       SYMTABLE_TYPE_STRING,         1, {{"i", SYMTABLE_TYPE_INT}}},
+};
+
+/**
+ * @brief Počet vestavěných funkcí ve statické tabulce.
+ */
+#define BUILT_IN_COUNT (sizeof(builtInTable) / sizeof(builtInTable[0]))
+
 
 /*******************************************************************************
  *                                                                             *
@@ -93,8 +130,8 @@ void frameStack_init() {
     frameArray.allocated = FRAME_ARRAY_INIT_SIZE;
     frameArray.array[frame->frameID] = frame;
 
-    // Do globálního rámce přidáme vestavěné funkce
-    frameStack_addEmbeddedFunctions();
+    // Vestavěné funkce se do globálního rámce nepřidávají, jejich signatury
+    // jsou ve statické tabulce `builtInTable`
 } // frameStack_init()
 
 /**
@@ -391,177 +428,22 @@ inline void frameStack_printSimple() {
     frameStack_print(stdout, false, true);
 } // frameStack_printSimple()
 
-void frameStack_addEmbeddedFunctions() {
-    SymtableFunctionData *data;
-
-    // Funkce pro načítání hodnot
-    data = symtable_initFunctionData(0);
-    if(data == NULL) {
-        return;
-    }
-    data->returnType = SYMTABLE_TYPE_STRING_OR_NULL;
-    if(frameStack_addFunction("ifj.readstr", data) != FRAME_STACK_SUCCESS) {
-        error_handle(ERROR_INTERNAL);
-    }
-
-    data = symtable_initFunctionData(0);
-    if(data == NULL) {
-        return;
-    }
-    data->returnType = SYMTABLE_TYPE_INT_OR_NULL;
-    if(frameStack_addFunction("ifj.readi32", data) != FRAME_STACK_SUCCESS) {
-        error_handle(ERROR_INTERNAL);
-    }
-
-    data = symtable_initFunctionData(0);
-    if(data == NULL) {
-        return;
-    }
-    data->returnType = SYMTABLE_TYPE_DOUBLE_OR_NULL;
-    if(frameStack_addFunction("ifj.readf64", data) != FRAME_STACK_SUCCESS) {
-        error_handle(ERROR_INTERNAL);
-    }
-
-    // Funkce pro výpis hodnoty
-    // Neuložíme skutečná data, protože bere jakýkoliv typ = speciální případ
-    data = symtable_initFunctionData(1);
-    if(data == NULL) {
-        return;
-    }
-    data->returnType = SYMTABLE_TYPE_VOID;
-    data->params[0].id = DString_constCharToDString("term");
-    if(frameStack_addFunction("ifj.write", data) != FRAME_STACK_SUCCESS) {
-        error_handle(ERROR_INTERNAL);
-    }
-
-    // Funkce pro konverzi číselných typů
-    data = symtable_initFunctionData(1);
-    if(data == NULL) {
-        return;
-    }
-    data->returnType = SYMTABLE_TYPE_DOUBLE;
-    data->params[0].type = SYMTABLE_TYPE_INT;
-    data->params[0].id = DString_constCharToDString("term");
-    if(frameStack_addFunction("ifj.i2f", data) != FRAME_STACK_SUCCESS) {
-        error_handle(ERROR_INTERNAL);
-    }
-
-    data = symtable_initFunctionData(1);
-    if(data == NULL) {
-        return;
-    }
-    data->returnType = SYMTABLE_TYPE_INT;
-    data->params[0].type = SYMTABLE_TYPE_DOUBLE;
-    data->params[0].id = DString_constCharToDString("term");
-    if(frameStack_addFunction("ifj.f2i", data) != FRAME_STACK_SUCCESS) {
-        error_handle(ERROR_INTERNAL);
-    }
-
-    // Funkce pro práci s řezy
-    // Neuložíme skutečná data, protože bere 2 typy = speciální případ
-    data = symtable_initFunctionData(1);
-    if(data == NULL) {
-        return;
-    }
-    data->returnType = SYMTABLE_TYPE_STRING;
-    data->params[0].id = DString_constCharToDString("term");
-    if(frameStack_addFunction("ifj.string", data) != FRAME_STACK_SUCCESS) {
-        error_handle(ERROR_INTERNAL);
-    }
-
-    data = symtable_initFunctionData(1);
-    if(data == NULL) {
-        return;
-    }
-    data->returnType = SYMTABLE_TYPE_INT;
-    data->params[0].type = SYMTABLE_TYPE_STRING;
-    data->params[0].id = DString_constCharToDString("s");
-    if(frameStack_addFunction("ifj.length", data) != FRAME_STACK_SUCCESS) {
-        error_handle(ERROR_INTERNAL);
-    }
-
-    data = symtable_initFunctionData(2);
-    if(data == NULL) {
-        return;
-    }
-    data->returnType = SYMTABLE_TYPE_STRING;
-    data->params[0].type = SYMTABLE_TYPE_STRING;
-    data->params[0].id = DString_constCharToDString("s1");
-    data->params[1].type = SYMTABLE_TYPE_STRING;
-    data->params[1].id = DString_constCharToDString("s2");
-    if(frameStack_addFunction("ifj.concat", data) != FRAME_STACK_SUCCESS) {
-        error_handle(ERROR_INTERNAL);
-    }
-
-    data = symtable_initFunctionData(3);
-    if(data == NULL) {
-        return;
-    }
-    data->returnType = SYMTABLE_TYPE_STRING_OR_NULL;
-    data->params[0].type = SYMTABLE_TYPE_STRING;
-    data->params[0].id = DString_constCharToDString("s");
-    data->params[1].type = SYMTABLE_TYPE_INT;
-    data->params[1].id = DString_constCharToDString("i");
-    data->params[2].type = SYMTABLE_TYPE_INT;
-    data->params[2].id = DString_constCharToDString("j");
-    if(frameStack_addFunction("ifj.substring", data) != FRAME_STACK_SUCCESS) {
-        error_handle(ERROR_INTERNAL);
-    }
-
-    data = symtable_initFunctionData(2);
-    if(data == NULL) {
-        return;
-    }
-    data->returnType = SYMTABLE_TYPE_INT;
-    data->params[0].type = SYMTABLE_TYPE_STRING;
-    data->params[0].id = DString_constCharToDString("s1");
-    data->params[1].type = SYMTABLE_TYPE_STRING;
-    data->params[1].id = DString_constCharToDString("s2");
-    if(frameStack_addFunction("ifj.strcmp", data) != FRAME_STACK_SUCCESS) {
-        error_handle(ERROR_INTERNAL);
-    }
-
-    data = symtable_initFunctionData(2);
-    if(data == NULL) {
-        return;
-    }
-    data->returnType = SYMTABLE_TYPE_INT;
-    data->params[0].type = SYMTABLE_TYPE_STRING;
-    data->params[0].id = DString_constCharToDString("s");
-    data->params[1].type = SYMTABLE_TYPE_INT;
-    data->params[1].id = DString_constCharToDString("i");
-    if(frameStack_addFunction("ifj.ord", data) != FRAME_STACK_SUCCESS) {
-        error_handle(ERROR_INTERNAL);
+/**
+ * @brief Vyhledá signaturu vestavěné funkce ve statické tabulce.
+ */
+const BuiltInSignature *frameStack_findBuiltIn(DString *identifier) {
+    if(identifier == NULL) {
+        return NULL;
     }
 
-    data = symtable_initFunctionData(1);
-    if(data == NULL) {
-        return;
-    }
-    data->returnType = SYMTABLE_TYPE_STRING;
-    data->params[0].type = SYMTABLE_TYPE_INT;
-    data->params[0].id = DString_constCharToDString("i");
-    if(frameStack_addFunction("ifj.chr", data) != FRAME_STACK_SUCCESS) {
-        error_handle(ERROR_INTERNAL);
+    // Vestavěných funkcí je málo, lineární průchod je dostatečný
+    for(size_t i = 0; i < BUILT_IN_COUNT; i++) {
+        if(DString_compareWithConstChar(identifier, builtInTable[i].identifier) == STRING_EQUAL) {
+            return &builtInTable[i];
+        }
     }
-} // frameStack_addEmbeddedFunctions()
 
-FrameStack_result frameStack_addFunction(const char* key, void* data) {
-    // Funkce pro načítání hodnot
-    DString *sKey = DString_constCharToDString(key);
-    if(key == NULL) {
-        return FRAME_STACK_ALLOCATION_FAIL;
-    }
-    SymtableItemPtr item;
-    FrameStack_result result = frameStack_addItem(sKey, &item);
-    if(result != FRAME_STACK_SUCCESS) {
-        DString_free(sKey);
-        return result;
-    }
-    item->symbolState = SYMTABLE_SYMBOL_FUNCTION;
-    item->data = data;
-    DString_free(sKey);
-    return FRAME_STACK_SUCCESS;
-} // frameStack_addFunction()
+    return NULL;
+} // frameStack_findBuiltIn()
 
 /*** Konec souboru frame_stack.c ***/
@@ -60,6 +60,8 @@
 #define IS_FUNCTION  true       /**< Vkládáme rámec označený jako rámec funkce.       */
 #define NOT_FUNCTION false      /**< Vkládáme rámec, který je podřízený rámci funkce. */
 
+#define BUILT_IN_MAX_PARAMS 3   /**< Maximální počet parametrů vestavěné funkce (`ifj.substring`). */
+
 /*******************************************************************************
  *                                                                             *
  *                             VÝČTOVÉ DATOVÉ TYPY                             *
@@ -108,6 +110,28 @@ typedef struct FrameStack {
     size_t currentID;        /**< Aktuální ID nejvyššího rámce.             */
 } FrameStack, *FrameStackPtr;
 
+/**
+ * @brief Struktura představující jeden parametr vestavěné funkce.
+ */
+typedef struct BuiltInParam {
+    const char *id;                         /**< Identifikátor parametru v cílovém kódu. */
+    Symtable_functionReturnType type;       /**< Datový typ parametru.                   */
+} BuiltInParam;
+
+/**
+ * @brief Struktura představující signaturu vestavěné funkce.
+ *
+ * @details Signatury vestavěných funkcí jsou uloženy ve statické konstantní
+ *          tabulce, a proto se pro ně při inicializaci zásobníku rámců nic
+ *          nealokuje a tabulku lze sdílet (pouze pro čtení) mezi vlákny.
+ */
+typedef struct BuiltInSignature {
+    const char *identifier;                         /**< Identifikátor funkce bez prefixu `ifj.`. */
+    Symtable_functionReturnType returnType;         /**< Návratový typ funkce.                    */
+    size_t paramCount;                              /**< Počet parametrů funkce.                  */
+    BuiltInParam params[BUILT_IN_MAX_PARAMS];       /**< Parametry funkce.                        */
+} BuiltInSignature;
+
 /**
  * @brief Struktura představující nafukovací pole rámců.
  */
@@ -281,17 +305,17 @@ void frameStack_print(FILE *file, bool printData, bool cutData);
 void frameStack_printSimple();
 
 /**
- * @brief Přidá vestavěné funkce do zásobníku rámců.
- */
-void frameStack_addEmbeddedFunctions();
-
-/**
- * @brief Přidá funkci do zásobníku rámců.
+ * @brief Vyhledá signaturu vestavěné funkce ve statické tabulce.
+ *
+ * @details Tabulka je inicializována staticky a je pouze pro čtení, vyhledání
+ *          tedy nic nealokuje a je bezpečné i při souběžném přístupu.
+ *
+ * @param [in] identifier Identifikátor funkce bez prefixu `ifj.`
  *
- * @param [in] key Klíč funkce
- * @param [in] data Ukazatel na data funkce
+ * @return Ukazatel na signaturu funkce, nebo `NULL`, pokud taková vestavěná
+ *         funkce neexistuje.
  */
-FrameStack_result frameStack_addFunction(const char* key, void* data);
+const BuiltInSignature *frameStack_findBuiltIn(DString *identifier);
 
 #endif  // FRAME_STACK_H_
 
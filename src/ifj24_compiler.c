@@ -32,19 +32,59 @@
  * @brief Hlavní funkce překladače 'ifj24compiler' týmu "xkalinj00".
  */
 int main() {
-    // Spustíme parsování zdrojového souboru a vygeneruje AST
-    LLparser_parseProgram();
+    // Načteme celý zdrojový soubor ze STDIN do paměti
+    if(!scannerInput_bufferStdin()) {
+        error_handle(ERROR_INTERNAL);
+    }
+
+    // Ověříme, že vstup neobsahuje znaky, které nejsou platné nikde v programu
+    if(!scannerInput_validateBuffer()) {
+        error_handle(ERROR_LEXICAL);
+    }
+
+    // Pokud je AST vstupu v cache, přeskočíme lexikální, syntaktickou i sémantickou analýzu
+    if(!ASTserializer_loadFromCache(getenv(AST_CACHE_ENV))) {
+        // Pokud je nastaven adresář cache tokenů, použijeme ji
+        if(!tokenCache_init(getenv(TOKEN_CACHE_ENV))) {
+            error_handle(ERROR_INTERNAL);
+        }
+
+        // Pokud je zapnut zřetězený běh, spustíme scanner ve vlastním vlákně
+        scannerPipeline_init(getenv(SCANNER_PIPELINE_ENV));
+
+        // Pokud je zapnut analyzátor výrazů metodou Pratt, použijeme jej místo precedenčního
+        prattParser_init(getenv(PRATT_PARSER_ENV));
 
-    // Přestože by toto nemělo nikdy nastat, raději zkontrolujeme, že kořen AST je platný
-    if(ASTroot != NULL) {
-        // Spustíme sémantickou analýzu nad AST pomocí Symtable
-        semantic_analyseProgram();
+        // Pokud je nastaven adresář cache funkcí, budeme překládat inkrementálně
+        incremental_init(getenv(INCREMENTAL_CACHE_ENV));
 
-        // Spustíme generování mezikódu IFJ24code
-        TAC_generateProgram();
+        // Spustíme parsování zdrojového souboru a vygeneruje AST
+        LLparser_parseProgram();
+
+        // Přestože by toto nemělo nikdy nastat, raději zkontrolujeme, že kořen AST je platný
+        if(ASTroot == NULL) {
+            error_handle(ERROR_INTERNAL);
+        }
+
+        // Spustíme sémantickou analýzu nad AST pomocí Symtable (funkce
+        // s kódem v cache funkcí se neanalyzují)
+        if(incremental_analyseProgram()) {
+            // Celé sémanticky správné AST uložíme do cache pro další překlad
+            ASTserializer_storeToCache(getenv(AST_CACHE_ENV));
+        }
     }
-    // Pokud tento neočekávaný případ nastal, hlásíme interní chybu
-    else {
+
+    // Vložíme malé funkce do míst jejich volání
+    ASTinliner_inlineProgram();
+
+    // Pokud je zapnut asynchronní výstup, kód bude vypisovat samostatné vlákno
+    outputWriter_init(getenv(OUTPUT_WRITER_ENV), stdout);
+
+    // Spustíme generování mezikódu IFJ24code (s kódem funkcí z cache)
+    incremental_generateProgram();
+
+    // Počkáme na výpis celého kódu
+    if(!outputWriter_finish()) {
         error_handle(ERROR_INTERNAL);
     }
 
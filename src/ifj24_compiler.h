@@ -31,9 +31,17 @@
 /** @endcond  */
 
 // Import knihoven hlavních modolů
+#include "scanner_input.h"
+#include "token_cache.h"
+#include "scanner_pipeline.h"
 #include "llparser.h"
+#include "pratt_parser.h"
 #include "semantic_analyser.h"
+#include "ast_serializer.h"
+#include "incremental.h"
+#include "ast_inliner.h"
 #include "tac_generator.h"
+#include "output_writer.h"
 
 // Import sdílených knihoven překladače
 #include "error.h"
@@ -0,0 +1,597 @@
+/*******************************************************************************
+ *                                                                             *
+ * Název projektu:   Implementace překladače imperativního jazyka IFJ24        *
+ *                                                                             *
+ * Soubor:           incremental.c                                             *
+ * Autor:            Krejčí David   <xkrejcd00>                                *
+ *                                                                             *
+ * Datum:            04.12.2024                                                *
+ * Poslední změna:   04.12.2024                                                *
+ *                                                                             *
+ * Tým:      Tým xkalinj00                                                     *
+ * Členové:  Farkašovský Lukáš    <xfarkal00>                                  *
+ *           Hýža Pavel           <xhyzapa00>                                  *
+ *           Kalina Jan           <xkalinj00>                                  *
+ *           Krejčí David         <xkrejcd00>                                  *
+ *                                                                             *
+ ******************************************************************************/
+/**
+ * @file incremental.c
+ * @author Krejčí David \<xkrejcd00>
+ *
+ * @brief Implementace inkrementálního překladu po jednotlivých funkcích.
+ * @details Soubory cache jsou vázány na konkrétní stroj (čísla jsou uložena
+ *          v nativním pořadí bajtů). Poškozený nebo cizí soubor se ignoruje
+ *          a funkce se přeloží znovu.
+ */
+
+#include <string.h>
+#include "incremental.h"
+#include "frame_stack.h"
+#include "semantic_analyser.h"
+#include "ast_inliner.h"
+#include "tac_generator.h"
+#include "built_in_functions.h"
+#include "error.h"
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                       INICIALIZACE GLOBÁLNÍCH PROMĚNNÝCH                    *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Globální stav inkrementálního překladu.
+ */
+Incremental incremental = { false, NULL, 0, 0, 0, "" };
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                        IMPLEMENTACE VEŘEJNÝCH FUNKCÍ                        *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Zapne inkrementální překlad s cache v daném adresáři.
+ */
+void incremental_init(const char *directory) {
+    incremental_free();
+
+    if(directory == NULL || *directory == '\0' || strlen(directory) >= INCREMENTAL_PATH_SIZE) {
+        return;
+    }
+
+    strcpy(incremental.directory, directory);
+    incremental.enabled = true;
+}  // incremental_init()
+
+/**
+ * @brief Započítá token přijatý parserem do hashe právě parsované funkce.
+ */
+void incremental_observeToken(Token token) {
+    if(!incremental.enabled) {
+        return;
+    }
+
+    // Klíčové slovo `pub` zahajuje novou definici funkce
+    if(token.type == TOKEN_K_pub) {
+        if(incremental.count == incremental.capacity) {
+            size_t capacity = incremental.capacity == 0 ? INCREMENTAL_INITIAL_CAPACITY
+                                                        : incremental.capacity * 2;
+            IncrementalFunction *functions = realloc(incremental.functions,
+                                                     capacity * sizeof(IncrementalFunction));
+            // Při chybě alokace překládáme program celý, překlad tím ale neovlivníme
+            if(functions == NULL) {
+                incremental_free();
+                return;
+            }
+            incremental.functions = functions;
+            incremental.capacity = capacity;
+        }
+
+        IncrementalFunction *function = &incremental.functions[incremental.count++];
+        memset(function, 0, sizeof(IncrementalFunction));
+        function->sourceHash = INCREMENTAL_HASH_OFFSET;
+        return;
+    }
+
+    // Tokeny prologu ani konec souboru nepatří žádné funkci
+    if(incremental.count == 0 || token.type == TOKEN_EOF) {
+        return;
+    }
+
+    // Bílé znaky a komentáře scanner nevrací, hash na nich proto nezávisí
+    IncrementalFunction *function = &incremental.functions[incremental.count - 1];
+    uint8_t type = (uint8_t)token.type;
+    uint64_t length = token.value != NULL ? token.value->length : 0;
+    function->sourceHash = incremental_hash(function->sourceHash, &type, sizeof(type));
+    function->sourceHash = incremental_hash(function->sourceHash, &length, sizeof(length));
+    if(token.value != NULL) {
+        function->sourceHash = incremental_hash(function->sourceHash, token.value->str,
+                                                token.value->length);
+    }
+}  // incremental_observeToken()
+
+/**
+ * @brief Provede sémantickou analýzu programu s vynecháním funkcí z cache.
+ */
+bool incremental_analyseProgram() {
+    if(!incremental.enabled) {
+        semantic_analyseProgram();
+        return true;
+    }
+
+    // Počet definic funkcí musí odpovídat počtu zaznamenaných hashů
+    size_t count = 0;
+    for(AST_FunDefNode *node = ASTroot->functionList; node != NULL; node = node->next) {
+        count++;
+    }
+
+    bool *selectedFunctions = calloc(count + 1, sizeof(bool));
+    bool *selectedFrames = calloc(frameStack.currentID + 1, sizeof(bool));
+    if(count != incremental.count || selectedFunctions == NULL || selectedFrames == NULL) {
+        free(selectedFunctions);
+        free(selectedFrames);
+        incremental_free();
+        semantic_analyseProgram();
+        return true;
+    }
+
+    // Spočítáme klíče funkcí a vyhledáme jejich kód v cache
+    bool allSelected = true;
+    AST_FunDefNode *node = ASTroot->functionList;
+    for(size_t i = 0; i < count; i++, node = node->next) {
+        IncrementalFunction *function = &incremental.functions[i];
+        function->key = incremental_functionKey(node, function->sourceHash);
+        function->cached = incremental_load(function);
+
+        // Funkce vkládané do místa volání musí být analyzovány kvůli volajícím
+        selectedFunctions[i] = !function->cached || ASTinliner_isInlineableBody(node);
+    }
+
+    // Vložitelnost se rozhodne až po analýze (skládání konstant a vypuštění
+    // definic šířených konstant tělo zmenší), analyzujeme proto i všechny
+    // funkce volané z překládaných funkcí
+    node = ASTroot->functionList;
+    for(size_t i = 0; i < count; i++, node = node->next) {
+        if(!incremental.functions[i].cached) {
+            incremental_selectCallees(node->body, selectedFunctions);
+        }
+    }
+    for(size_t i = 0; i < count; i++) {
+        allSelected = allSelected && selectedFunctions[i];
+    }
+
+    incremental_selectFrames(selectedFunctions, selectedFrames);
+
+    // Při chybě se překladač ukončí a paměť uvolní operační systém
+    semantic_analyseSelected(selectedFunctions, selectedFrames);
+
+    free(selectedFunctions);
+    free(selectedFrames);
+
+    return allSelected;
+}  // incremental_analyseProgram()
+
+/**
+ * @brief Vygeneruje cílový kód programu s kódem funkcí z cache.
+ */
+void incremental_generateProgram() {
+    if(!incremental.enabled) {
+        TAC_generateProgram();
+        return;
+    }
+
+    TAC_resetStatic();
+    TAC_generateProlog();
+
+    // Funkce, které nejsou v cache, vygenerujeme (případně paralelně) do paměti
+    AST_FunDefNode **functions = malloc((incremental.count + 1) * sizeof(AST_FunDefNode *));
+    TAC_FunctionCode *codes = calloc(incremental.count + 1, sizeof(TAC_FunctionCode));
+    if(functions == NULL || codes == NULL) {
+        free(functions);
+        free(codes);
+        error_handle(ERROR_INTERNAL);
+    }
+
+    size_t generated = 0;
+    AST_FunDefNode *node = ASTroot->functionList;
+    for(size_t i = 0; i < incremental.count && node != NULL; i++, node = node->next) {
+        if(!incremental.functions[i].cached) {
+            functions[generated++] = node;
+        }
+    }
+    TAC_generateFunctions(functions, codes, generated);
+
+    // Kód funkcí vypíšeme v pořadí jejich definic a nový kód uložíme
+    generated = 0;
+    for(size_t i = 0; i < incremental.count; i++) {
+        IncrementalFunction *function = &incremental.functions[i];
+        fputc('\n', TAC_OUTPUT);
+
+        if(function->cached) {
+            fwrite(function->code, 1, function->codeLength, TAC_OUTPUT);
+            TAC_builtInMarkMask(function->builtIns);
+            incremental.reused++;
+            continue;
+        }
+
+        TAC_FunctionCode *code = &codes[generated++];
+        fwrite(code->code, 1, code->length, TAC_OUTPUT);
+        TAC_builtInMarkMask(code->builtIns);
+        incremental_store(function->key, code->code, code->length, code->builtIns);
+        free(code->code);
+    }
+
+    free(functions);
+    free(codes);
+
+    TAC_generateEpilog();
+}  // incremental_generateProgram()
+
+/**
+ * @brief Uvolní zdroje inkrementálního překladu a vypne jej.
+ */
+void incremental_free() {
+    for(size_t i = 0; i < incremental.count; i++) {
+        free(incremental.functions[i].code);
+    }
+    free(incremental.functions);
+
+    incremental.enabled = false;
+    incremental.functions = NULL;
+    incremental.count = 0;
+    incremental.capacity = 0;
+    incremental.reused = 0;
+    incremental.directory[0] = '\0';
+}  // incremental_free()
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                        IMPLEMENTACE INTERNÍCH FUNKCÍ                        *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Přidá data do 64bitového hashe FNV-1a.
+ */
+uint64_t incremental_hash(uint64_t hash, const void *data, size_t length) {
+    const unsigned char *bytes = data;
+
+    for(size_t i = 0; i < length; i++) {
+        hash ^= bytes[i];
+        hash *= UINT64_C(1099511628211);
+    }
+
+    return hash;
+}  // incremental_hash()
+
+/**
+ * @brief Spočítá klíč funkce v cache.
+ */
+uint64_t incremental_functionKey(AST_FunDefNode *funDef, uint64_t sourceHash) {
+    uint32_t version = INCREMENTAL_VERSION;
+    uint64_t hash = incremental_hash(INCREMENTAL_HASH_OFFSET, &version, sizeof(version));
+    hash = incremental_hash(hash, &sourceHash, sizeof(sourceHash));
+
+    return incremental_hashStatements(hash, funDef->body);
+}  // incremental_functionKey()
+
+/**
+ * @brief Přidá do klíče volání funkcí v bloku příkazů.
+ */
+uint64_t incremental_hashStatements(uint64_t hash, AST_StatementNode *statement) {
+    while(statement != NULL) {
+        switch(statement->statementType) {
+            case AST_STATEMENT_VAR_DEF:
+            case AST_STATEMENT_EXPR:
+            case AST_STATEMENT_RETURN:
+                hash = incremental_hashExpr(hash, statement->statement);
+                break;
+
+            case AST_STATEMENT_FUN_CALL:
+                hash = incremental_hashCall(hash, statement->statement);
+                break;
+
+            case AST_STATEMENT_IF: {
+                AST_IfNode *ifNode = statement->statement;
+                hash = incremental_hashExpr(hash, ifNode->condition);
+                hash = incremental_hashStatements(hash, ifNode->thenBranch);
+                hash = incremental_hashStatements(hash, ifNode->elseBranch);
+                break;
+            }
+
+            case AST_STATEMENT_WHILE: {
+                AST_WhileNode *whileNode = statement->statement;
+                hash = incremental_hashExpr(hash, whileNode->condition);
+                hash = incremental_hashStatements(hash, whileNode->body);
+                break;
+            }
+
+            default:
+                break;
+        }
+
+        statement = statement->next;
+    }
+
+    return hash;
+}  // incremental_hashStatements()
+
+/**
+ * @brief Přidá do klíče volání funkcí ve výrazu.
+ */
+uint64_t incremental_hashExpr(uint64_t hash, AST_ExprNode *expr) {
+    if(expr == NULL || expr->expression == NULL) {
+        return hash;
+    }
+
+    if(expr->exprType == AST_EXPR_BINARY_OP) {
+        AST_BinOpNode *binOp = expr->expression;
+        hash = incremental_hashExpr(hash, binOp->left);
+        return incremental_hashExpr(hash, binOp->right);
+    }
+
+    if(expr->exprType == AST_EXPR_FUN_CALL) {
+        return incremental_hashCall(hash, expr->expression);
+    }
+
+    return hash;
+}  // incremental_hashExpr()
+
+/**
+ * @brief Přidá do klíče signaturu volané funkce.
+ */
+uint64_t incremental_hashCall(uint64_t hash, AST_FunCallNode *funCall) {
+    // Argumenty mohou obsahovat další volání
+    for(AST_ArgOrParamNode *arg = funCall->arguments; arg != NULL; arg = arg->next) {
+        hash = incremental_hashExpr(hash, arg->expression);
+    }
+
+    // Signatury vestavěných funkcí se nemění
+    if(funCall->isBuiltIn) {
+        return hash;
+    }
+
+    hash = incremental_hash(hash, &funCall->identifier->length, sizeof(size_t));
+    hash = incremental_hash(hash, funCall->identifier->str, funCall->identifier->length);
+
+    // Nedefinovaná funkce má vlastní značku, aby se klíč změnil po jejím přidání
+    SymtableItemPtr item = NULL;
+    if(symtable_findItem(frameStack.bottom->frame, funCall->identifier,
+                         &item) != SYMTABLE_SUCCESS || item->data == NULL)
+    {
+        uint8_t missing = 0xFF;
+        return incremental_hash(hash, &missing, sizeof(missing));
+    }
+
+    SymtableFunctionData *data = item->data;
+    uint32_t returnType = (uint32_t)data->returnType;
+    uint64_t paramCount = data->paramCount;
+    hash = incremental_hash(hash, &returnType, sizeof(returnType));
+    hash = incremental_hash(hash, &paramCount, sizeof(paramCount));
+    for(size_t i = 0; i < data->paramCount; i++) {
+        uint32_t type = (uint32_t)data->params[i].type;
+        uint64_t length = data->params[i].id->length;
+        hash = incremental_hash(hash, &type, sizeof(type));
+        hash = incremental_hash(hash, &length, sizeof(length));
+        hash = incremental_hash(hash, data->params[i].id->str, data->params[i].id->length);
+    }
+
+    // Tělo funkce se může kopírovat do místa volání; zda bude vložena, se
+    // rozhodne až po sémantické analýze, proto přidáme hash každé volané funkce
+    size_t index = 0;
+    if(incremental_findFunction(funCall->identifier, &index) != NULL) {
+        hash = incremental_hash(hash, &incremental.functions[index].sourceHash, sizeof(uint64_t));
+    }
+
+    return hash;
+}  // incremental_hashCall()
+
+/**
+ * @brief Vybere k analýze funkce volané v bloku příkazů.
+ */
+void incremental_selectCallees(AST_StatementNode *statement, bool *selectedFunctions) {
+    while(statement != NULL) {
+        switch(statement->statementType) {
+            case AST_STATEMENT_VAR_DEF:
+            case AST_STATEMENT_EXPR:
+            case AST_STATEMENT_RETURN:
+                incremental_selectCalleesInExpr(statement->statement, selectedFunctions);
+                break;
+
+            case AST_STATEMENT_FUN_CALL:
+                incremental_selectCallee(statement->statement, selectedFunctions);
+                break;
+
+            case AST_STATEMENT_IF: {
+                AST_IfNode *ifNode = statement->statement;
+                incremental_selectCalleesInExpr(ifNode->condition, selectedFunctions);
+                incremental_selectCallees(ifNode->thenBranch, selectedFunctions);
+                incremental_selectCallees(ifNode->elseBranch, selectedFunctions);
+                break;
+            }
+
+            case AST_STATEMENT_WHILE: {
+                AST_WhileNode *whileNode = statement->statement;
+                incremental_selectCalleesInExpr(whileNode->condition, selectedFunctions);
+                incremental_selectCallees(whileNode->body, selectedFunctions);
+                break;
+            }
+
+            default:
+                break;
+        }
+
+        statement = statement->next;
+    }
+}  // incremental_selectCallees()
+
+/**
+ * @brief Vybere k analýze funkce volané ve výrazu.
+ */
+void incremental_selectCalleesInExpr(AST_ExprNode *expr, bool *selectedFunctions) {
+    if(expr == NULL || expr->expression == NULL) {
+        return;
+    }
+
+    if(expr->exprType == AST_EXPR_BINARY_OP) {
+        AST_BinOpNode *binOp = expr->expression;
+        incremental_selectCalleesInExpr(binOp->left, selectedFunctions);
+        incremental_selectCalleesInExpr(binOp->right, selectedFunctions);
+    }
+    else if(expr->exprType == AST_EXPR_FUN_CALL) {
+        incremental_selectCallee(expr->expression, selectedFunctions);
+    }
+}  // incremental_selectCalleesInExpr()
+
+/**
+ * @brief Vybere k analýze volanou funkci a funkce volané v jejích argumentech.
+ */
+void incremental_selectCallee(AST_FunCallNode *funCall, bool *selectedFunctions) {
+    for(AST_ArgOrParamNode *arg = funCall->arguments; arg != NULL; arg = arg->next) {
+        incremental_selectCalleesInExpr(arg->expression, selectedFunctions);
+    }
+
+    size_t index = 0;
+    if(!funCall->isBuiltIn && incremental_findFunction(funCall->identifier, &index) != NULL) {
+        selectedFunctions[index] = true;
+    }
+}  // incremental_selectCallee()
+
+/**
+ * @brief Najde definici funkce podle identifikátoru.
+ */
+AST_FunDefNode *incremental_findFunction(DString *identifier, size_t *index) {
+    AST_FunDefNode *node = ASTroot->functionList;
+    for(size_t i = 0; node != NULL && i < incremental.count; i++, node = node->next) {
+        if(DString_compare(node->identifier, identifier) == STRING_EQUAL) {
+            *index = i;
+            return node;
+        }
+    }
+
+    return NULL;
+}  // incremental_findFunction()
+
+/**
+ * @brief Vybere rámce, které patří k vybraným funkcím.
+ */
+void incremental_selectFrames(const bool *selectedFunctions, bool *selectedFrames) {
+    // Každé funkci patří rámce od rámce jejího těla k rámci těla další funkce
+    size_t first = 0;
+    bool selected = false;
+    AST_FunDefNode *node = ASTroot->functionList;
+    for(size_t i = 0; node != NULL; i++, node = node->next) {
+        SymtableItemPtr item = NULL;
+        if(symtable_findItem(frameStack.bottom->frame, node->identifier,
+                             &item) != SYMTABLE_SUCCESS || item->data == NULL)
+        {
+            continue;
+        }
+
+        size_t bodyFrameID = ((SymtableFunctionData *)item->data)->bodyFrameID;
+        for(size_t id = first; id < bodyFrameID && id <= frameStack.currentID; id++) {
+            selectedFrames[id] = selected;
+        }
+
+        first = bodyFrameID;
+        selected = selectedFunctions[i];
+    }
+
+    for(size_t id = first; id <= frameStack.currentID; id++) {
+        selectedFrames[id] = selected;
+    }
+}  // incremental_selectFrames()
+
+/**
+ * @brief Sestaví cestu k souboru s kódem funkce.
+ */
+bool incremental_path(uint64_t key, char *path) {
+    int written = snprintf(path, INCREMENTAL_PATH_SIZE, "%s/%016llx.fn",
+                           incremental.directory, (unsigned long long)key);
+
+    return written >= 0 && written < INCREMENTAL_PATH_SIZE;
+}  // incremental_path()
+
+/**
+ * @brief Načte kód funkce z cache.
+ */
+bool incremental_load(IncrementalFunction *function) {
+    char path[INCREMENTAL_PATH_SIZE];
+    if(!incremental_path(function->key, path)) {
+        return false;
+    }
+
+    FILE *file = fopen(path, "rb");
+    if(file == NULL) {
+        return false;
+    }
+
+    // Hlavička musí odpovídat formátu i klíči funkce
+    IncrementalHeader header;
+    if(fread(&header, sizeof(header), 1, file) != 1 ||
+       memcmp(header.magic, INCREMENTAL_MAGIC, INCREMENTAL_MAGIC_SIZE) != 0 ||
+       header.version != INCREMENTAL_VERSION || header.key != function->key ||
+       header.codeLength == 0)
+    {
+        fclose(file);
+        return false;
+    }
+
+    size_t codeLength = (size_t)header.codeLength;
+    char *code = malloc(codeLength);
+
+    // Za kódem už nesmí nic následovat
+    bool loaded = code != NULL && fread(code, 1, codeLength, file) == codeLength &&
+                  fgetc(file) == EOF;
+    fclose(file);
+
+    if(!loaded) {
+        free(code);
+        return false;
+    }
+
+    function->code = code;
+    function->codeLength = codeLength;
+    function->builtIns = header.builtIns;
+
+    return true;
+}  // incremental_load()
+
+/**
+ * @brief Uloží kód funkce do cache.
+ */
+void incremental_store(uint64_t key, const char *code, size_t codeLength, uint32_t builtIns) {
+    char path[INCREMENTAL_PATH_SIZE];
+    char temporaryPath[INCREMENTAL_PATH_SIZE + 8];
+    if(codeLength == 0 || !incremental_path(key, path)) {
+        return;
+    }
+    snprintf(temporaryPath, sizeof(temporaryPath), "%s.tmp", path);
+
+    FILE *file = fopen(temporaryPath, "wb");
+    if(file == NULL) {
+        return;
+    }
+
+    IncrementalHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, INCREMENTAL_MAGIC, INCREMENTAL_MAGIC_SIZE);
+    header.version = INCREMENTAL_VERSION;
+    header.builtIns = builtIns;
+    header.key = key;
+    header.codeLength = codeLength;
+
+    bool written = fwrite(&header, sizeof(header), 1, file) == 1 &&
+                   fwrite(code, 1, codeLength, file) == codeLength;
+
+    if(fclose(file) != 0 || !written || rename(temporaryPath, path) != 0) {
+        remove(temporaryPath);
+    }
+}  // incremental_store()
+
+/*** Konec souboru incremental.c ***/
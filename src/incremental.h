@@ -0,0 +1,320 @@
+/*******************************************************************************
+ *                                                                             *
+ * Název projektu:   Implementace překladače imperativního jazyka IFJ24        *
+ *                                                                             *
+ * Soubor:           incremental.h                                             *
+ * Autor:            Krejčí David   <xkrejcd00>                                *
+ *                                                                             *
+ * Datum:            04.12.2024                                                *
+ * Poslední změna:   04.12.2024                                                *
+ *                                                                             *
+ * Tým:      Tým xkalinj00                                                     *
+ * Členové:  Farkašovský Lukáš    <xfarkal00>                                  *
+ *           Hýža Pavel           <xhyzapa00>                                  *
+ *           Kalina Jan           <xkalinj00>                                  *
+ *           Krejčí David         <xkrejcd00>                                  *
+ *                                                                             *
+ ******************************************************************************/
+/**
+ * @file incremental.h
+ * @author Krejčí David \<xkrejcd00>
+ *
+ * @brief Hlavičkový soubor pro inkrementální překlad po jednotlivých funkcích.
+ * @details Pokud je nastavena proměnná prostředí @c INCREMENTAL_CACHE_ENV
+ *          s cestou k adresáři, překladač si pro každou definici funkce uloží
+ *          vygenerovaný cílový kód pod klíčem, který tvoří:
+ *          - hash tokenů definice funkce (od `pub` po další `pub` nebo EOF),
+ *          - signatury volaných funkcí z tabulky symbolů (návratový typ,
+ *            typy a jména parametrů),
+ *          - hash tokenů volaných funkcí, které mohou být vloženy do místa
+ *            volání.
+ *
+ *          Při dalším překladu se funkce se známým klíčem sémanticky
+ *          neanalyzují a jejich kód se převezme z cache. Parsuje se vždy celý
+ *          program, protože z něj vznikají signatury všech funkcí.
+ *
+ *          Kód funkcí nezávisí na pořadí generování, protože návěští obsahují
+ *          jméno funkce a jména proměnných ID rámce relativní k rámci těla
+ *          funkce. Do cache se zapisuje pouze kód programu, který prošel
+ *          sémantickou analýzou.
+ */
+
+#ifndef INCREMENTAL_H_
+/** @cond  */
+#define INCREMENTAL_H_
+/** @endcond  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "scanner.h"
+#include "ast_nodes.h"
+#include "dynamic_string.h"
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                             DEKLARACE KONSTANT                              *
+ *                                                                             *
+ ******************************************************************************/
+
+#define INCREMENTAL_CACHE_ENV "IFJ24_INCREMENTAL_CACHE" /**< Proměnná prostředí s adresářem cache */
+#define INCREMENTAL_MAGIC "IFJ24FUN"            /**< Identifikace souboru s kódem funkce       */
+#define INCREMENTAL_MAGIC_SIZE 8                /**< Délka identifikace souboru                */
+#define INCREMENTAL_VERSION 3                   /**< Verze formátu a generovaného kódu         */
+#define INCREMENTAL_PATH_SIZE 4096              /**< Velikost bufferu pro cestu k souboru      */
+#define INCREMENTAL_INITIAL_CAPACITY 16         /**< Počáteční kapacita pole funkcí            */
+#define INCREMENTAL_HASH_OFFSET UINT64_C(14695981039346656037) /**< Počáteční hodnota hashe FNV-1a */
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                             DEKLARACE STRUKTUR                              *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Hlavička souboru s kódem funkce.
+ */
+typedef struct IncrementalHeader {
+    char magic[INCREMENTAL_MAGIC_SIZE]; /**< Identifikace souboru @c INCREMENTAL_MAGIC      */
+    uint32_t version;                   /**< Verze formátu @c INCREMENTAL_VERSION           */
+    uint32_t builtIns;                  /**< Maska použitých vestavěných podprogramů        */
+    uint64_t key;                       /**< Klíč funkce                                    */
+    uint64_t codeLength;                /**< Délka kódu funkce v bajtech                    */
+} IncrementalHeader;
+
+/**
+ * @brief Stav jedné definice funkce při inkrementálním překladu.
+ */
+typedef struct IncrementalFunction {
+    uint64_t sourceHash;        /**< Hash tokenů definice funkce                    */
+    uint64_t key;               /**< Klíč funkce v cache                            */
+    char *code;                 /**< Kód funkce převzatý z cache                    */
+    size_t codeLength;          /**< Délka kódu funkce                              */
+    uint32_t builtIns;          /**< Maska použitých vestavěných podprogramů        */
+    bool cached;                /**< Kód funkce je převzat z cache                  */
+} IncrementalFunction;
+
+/**
+ * @brief Stav inkrementálního překladu.
+ */
+typedef struct Incremental {
+    bool enabled;                       /**< Inkrementální překlad je zapnut            */
+    IncrementalFunction *functions;     /**< Funkce v pořadí jejich definic             */
+    size_t count;                       /**< Počet funkcí                               */
+    size_t capacity;                    /**< Kapacita pole funkcí                       */
+    size_t reused;                      /**< Počet funkcí převzatých z cache            */
+    char directory[INCREMENTAL_PATH_SIZE];  /**< Adresář cache                          */
+} Incremental;
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                       DEKLARACE GLOBÁLNÍCH PROMĚNNÝCH                       *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Globální stav inkrementálního překladu.
+ */
+extern Incremental incremental;
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                         DEKLARACE VEŘEJNÝCH FUNKCÍ                          *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Zapne inkrementální překlad s cache v daném adresáři.
+ *
+ * @details Musí být voláno před parsováním programu, aby se zaznamenaly
+ *          hashe definic funkcí. Pokud je @p directory `NULL` nebo prázdný
+ *          řetězec, inkrementální překlad zůstane vypnutý.
+ *
+ * @param [in] directory Cesta k adresáři cache, nebo `NULL`
+ */
+void incremental_init(const char *directory);
+
+/**
+ * @brief Započítá token přijatý parserem do hashe právě parsované funkce.
+ *
+ * @details Token `pub` zahajuje novou definici funkce. Tokeny před první
+ *          definicí (prolog programu) se nezapočítávají.
+ *
+ * @param [in] token Token přijatý parserem
+ */
+void incremental_observeToken(Token token);
+
+/**
+ * @brief Provede sémantickou analýzu programu s vynecháním funkcí z cache.
+ *
+ * @details Bez zapnutého inkrementálního překladu analyzuje celý program.
+ *          Funkce, které mohou být vloženy do místa volání, se analyzují vždy,
+ *          protože jejich tělo se kopíruje do volajících funkcí.
+ *
+ * @return `true`, pokud byly analyzovány všechny funkce, jinak `false`.
+ */
+bool incremental_analyseProgram();
+
+/**
+ * @brief Vygeneruje cílový kód programu s kódem funkcí z cache.
+ *
+ * @details Kód funkcí, které nejsou v cache, se vygeneruje, vypíše a uloží
+ *          do cache. Bez zapnutého inkrementálního překladu se generuje celý
+ *          program.
+ */
+void incremental_generateProgram();
+
+/**
+ * @brief Uvolní zdroje inkrementálního překladu a vypne jej.
+ */
+void incremental_free();
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                         DEKLARACE INTERNÍCH FUNKCÍ                          *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Přidá data do 64bitového hashe FNV-1a.
+ *
+ * @param [in] hash Dosavadní hodnota hashe
+ * @param [in] data Ukazatel na data
+ * @param [in] length Délka dat
+ *
+ * @return Nová hodnota hashe.
+ */
+uint64_t incremental_hash(uint64_t hash, const void *data, size_t length);
+
+/**
+ * @brief Spočítá klíč funkce v cache.
+ *
+ * @param [in] funDef Ukazatel na definici funkce
+ * @param [in] sourceHash Hash tokenů definice funkce
+ *
+ * @return Klíč funkce.
+ */
+uint64_t incremental_functionKey(AST_FunDefNode *funDef, uint64_t sourceHash);
+
+/**
+ * @brief Přidá do klíče volání funkcí v bloku příkazů.
+ *
+ * @param [in] hash Dosavadní hodnota klíče
+ * @param [in] statement Ukazatel na první příkaz bloku
+ *
+ * @return Nová hodnota klíče.
+ */
+uint64_t incremental_hashStatements(uint64_t hash, AST_StatementNode *statement);
+
+/**
+ * @brief Přidá do klíče volání funkcí ve výrazu.
+ *
+ * @param [in] hash Dosavadní hodnota klíče
+ * @param [in] expr Ukazatel na výraz
+ *
+ * @return Nová hodnota klíče.
+ */
+uint64_t incremental_hashExpr(uint64_t hash, AST_ExprNode *expr);
+
+/**
+ * @brief Přidá do klíče signaturu volané funkce.
+ *
+ * @details U uživatelské funkce přidá i hash jejích tokenů, protože funkce
+ *          může být po sémantické analýze vložena do místa volání.
+ *
+ * @param [in] hash Dosavadní hodnota klíče
+ * @param [in] funCall Ukazatel na uzel volání funkce
+ *
+ * @return Nová hodnota klíče.
+ */
+uint64_t incremental_hashCall(uint64_t hash, AST_FunCallNode *funCall);
+
+/**
+ * @brief Vybere k analýze funkce volané v bloku příkazů.
+ *
+ * @details Funkce z cache, kterou by vkladač mohl vložit do překládané
+ *          funkce, musí projít sémantickou analýzou, jinak by vkladač
+ *          rozhodoval podle jejího nezjednodušeného těla.
+ *
+ * @param [in] statement Ukazatel na první příkaz bloku
+ * @param [in,out] selectedFunctions Příznaky funkcí vybraných k analýze
+ */
+void incremental_selectCallees(AST_StatementNode *statement, bool *selectedFunctions);
+
+/**
+ * @brief Vybere k analýze funkce volané ve výrazu.
+ *
+ * @param [in] expr Ukazatel na výraz
+ * @param [in,out] selectedFunctions Příznaky funkcí vybraných k analýze
+ */
+void incremental_selectCalleesInExpr(AST_ExprNode *expr, bool *selectedFunctions);
+
+/**
+ * @brief Vybere k analýze volanou funkci a funkce volané v jejích argumentech.
+ *
+ * @param [in] funCall Ukazatel na uzel volání funkce
+ * @param [in,out] selectedFunctions Příznaky funkcí vybraných k analýze
+ */
+void incremental_selectCallee(AST_FunCallNode *funCall, bool *selectedFunctions);
+
+/**
+ * @brief Najde definici funkce podle identifikátoru.
+ *
+ * @param [in] identifier Identifikátor funkce
+ * @param [out] index Pořadí nalezené definice funkce
+ *
+ * @return Ukazatel na definici funkce, nebo `NULL`, pokud funkce neexistuje.
+ */
+AST_FunDefNode *incremental_findFunction(DString *identifier, size_t *index);
+
+/**
+ * @brief Vybere rámce, které patří k vybraným funkcím.
+ *
+ * @details Rámce jsou číslovány postupně při parsování, funkci tedy patří
+ *          rámce od rámce jejího těla až po rámec těla následující funkce.
+ *
+ * @param [in] selectedFunctions Příznaky vybraných funkcí
+ * @param [out] selectedFrames Příznaky rámců indexované ID rámce
+ */
+void incremental_selectFrames(const bool *selectedFunctions, bool *selectedFrames);
+
+/**
+ * @brief Sestaví cestu k souboru s kódem funkce.
+ *
+ * @param [in] key Klíč funkce
+ * @param [out] path Buffer o velikosti @c INCREMENTAL_PATH_SIZE
+ *
+ * @return `true`, pokud se cesta vešla do bufferu, jinak `false`.
+ */
+bool incremental_path(uint64_t key, char *path);
+
+/**
+ * @brief Načte kód funkce z cache.
+ *
+ * @param [in,out] function Funkce s vyplněným klíčem
+ *
+ * @return `true`, pokud byl kód načten, jinak `false`.
+ */
+bool incremental_load(IncrementalFunction *function);
+
+/**
+ * @brief Uloží kód funkce do cache.
+ *
+ * @details Soubor se nejprve zapíše pod dočasným názvem a poté přejmenuje.
+ *
+ * @param [in] key Klíč funkce
+ * @param [in] code Kód funkce
+ * @param [in] codeLength Délka kódu funkce
+ * @param [in] builtIns Maska použitých vestavěných podprogramů
+ */
+void incremental_store(uint64_t key, const char *code, size_t codeLength, uint32_t builtIns);
+
+#endif // INCREMENTAL_H_
+
+/*** Konec souboru incremental.h ***/
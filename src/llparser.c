@@ -857,40 +857,59 @@ AST_DataType LLparser_parseDataType() {
  *        seznam příkazů.
  */
 AST_StatementNode *LLparser_parseStatementList() {
-    // Vyhledáme pravidlo v LL tabulce
-    LLRuleSet rule = RULE_UNDEFINED;
-    LLtable_findRule(currentTerminal.LLterminal, NT_STATEMENT_LIST, &rule);
+    // Zásobník otevřených bloků; na jeho dně je blok, jehož "}" zpracuje volající
+    LLparser_BlockStack stack = { NULL, 0, 0 };
 
-    // Na neterminál <STATEMENT_LIST> lze aplikovat dvě různá pravidla
-    switch(rule) {
-        // <STATEMENT_LIST> -> <STATEMENT> <STATEMENT_LIST>
-        case STATEMENT_LIST_1: {
-            // Analyzujeme neterminál <STATEMENT>
-            AST_StatementNode *statement = LLparser_parseStatement();
+    if(!LLparser_pushBlock(&stack, LL_BLOCK_SEQUENCE)) {
+        goto parseStatementList_errorHandle;  // ošetření chyb na konci funkce
+    }
 
-            if(parser_errorWatcher(IS_PARSING_ERROR)) {
-                AST_destroyStatementList(statement);
+    while(true) {
+        // Vyhledáme pravidlo v LL tabulce
+        LLRuleSet rule = RULE_UNDEFINED;
+        LLtable_findRule(currentTerminal.LLterminal, NT_STATEMENT_LIST, &rule);
+
+        // <STATEMENT_LIST> -> ε
+        if(rule == STATEMENT_LIST_2) {
+            // Seznam příkazů bloku na dně zásobníku je výsledkem analýzy
+            if(stack.count == 1) {
+                AST_StatementNode *statementList = stack.blocks[0].first;
+                free(stack.blocks);
+                return statementList;
+            }
+
+            // Jinak končí seznam příkazů vnořeného bloku
+            if(!LLparser_closeBlock(&stack)) {
                 goto parseStatementList_errorHandle;  // ošetření chyb na konci funkce
             }
 
-            // Analyzujeme neterminál  <STATEMENT_LIST>
-            AST_StatementNode *statementList = LLparser_parseStatementList();
+            continue;
+        }
+
+        // <STATEMENT_LIST> -> <STATEMENT> <STATEMENT_LIST>
+        if(rule != STATEMENT_LIST_1) {
+            goto parseStatementList_errorHandle;  // ošetření chyb na konci funkce
+        }
+
+        // Příkazy "if" a "while" otevírají vnořený blok na zásobníku bloků
+        LLtable_findRule(currentTerminal.LLterminal, NT_STATEMENT, &rule);
 
-            // Pokud není navrácený seznam příkazů prázdný, připojíme ho ke stávajícímmu
-            if(statementList != NULL) {
-                statement->next = statementList;
+        if(rule == STATEMENT_4 || rule == STATEMENT_5) {
+            if(!LLparser_openBlock(&stack, rule)) {
+                goto parseStatementList_errorHandle;  // ošetření chyb na konci funkce
             }
 
-            return statement;
+            continue;
         }
 
-        // <STATEMENT_LIST> -> ε
-        case STATEMENT_LIST_2:
-            return NULL;  // ε reprezentujeme jako NULL
+        // Ostatní příkazy analyzujeme přímo a připojíme je k aktuálnímu bloku
+        AST_StatementNode *statement = LLparser_parseStatement();
 
-        // Výchozí stav: došlo k chybě
-        default:
+        if(parser_errorWatcher(IS_PARSING_ERROR)) {
             goto parseStatementList_errorHandle;  // ošetření chyb na konci funkce
+        }
+
+        LLparser_appendStatement(&stack.blocks[stack.count - 1], statement);
     }
 
 
@@ -898,11 +917,12 @@ AST_StatementNode *LLparser_parseStatementList() {
     /*              ZPRACOVÁNÍ CHYB A UVOLNĚNÍ ZDROJŮ TÉTO FUNKCE             */
     /***                                                                    ***/
 
-    // Úroveň 0: hodnota řetězce aktuálního terminálu
+    // Úroveň 0: hodnota řetězce aktuálního terminálu; všechny otevřené bloky
     parseStatementList_errorHandle:
+        LLparser_destroyBlockStack(&stack);
         parser_freeCurrentTerminalValue();
         return PARSING_ERROR;
-} // LLaprser_parseStatementList()
+} // LLparser_parseStatementList()
 
 /**
  * @brief Analyzuje neterminál @c \<STATEMENT>, který reprezentuje jeden příkaz
@@ -913,7 +933,8 @@ AST_StatementNode *LLparser_parseStatement() {
     LLRuleSet rule = RULE_UNDEFINED;
     LLtable_findRule(currentTerminal.LLterminal, NT_STATEMENT, &rule);
 
-    // Na neterminál <STATEMENT> lze aplikovat šest různých pravidel
+    // Na neterminál <STATEMENT> lze aplikovat pět jednoduchých pravidel (příkazy
+    // "if" a "while" zpracovává se zásobníkem bloků LLparser_parseStatementList())
     switch(rule) {
         // <STATEMENT> -> <VAR_DEF> ;
         case STATEMENT_1:
@@ -927,14 +948,6 @@ AST_StatementNode *LLparser_parseStatement() {
         case STATEMENT_3:
             return LLparser_parseRuleStatement3();
 
-        // <STATEMENT> -> <IF>
-        case STATEMENT_4:
-            return LLparser_parseRuleStatement4();
-
-        // <STATEMENT> -> <WHILE>
-        case STATEMENT_5:
-            return LLparser_parseRuleStatement5();
-
         // <STATEMENT> -> return [precedence_expression] ;
         case STATEMENT_6:
             return LLparser_parseRuleStatement6();
@@ -1262,127 +1275,6 @@ AST_ExprNode *LLparser_parseThrowAway() {
     return precParser_parse(NT_THROW_AWAY);
 } // LLparser_parseThrowAway()
 
-/**
- * @brief Analyzuje neterminál @c \<IF>, který reprezentuje podmíněný
- *        příkaz @c if.
- */
-AST_IfNode *LLparser_parseIf() {
-    // Očekávaným terminálem je "if"
-    if(LLparser_isNotExpectedTerminal(T_IF)) {
-        goto parseIf_errorLevel_0;  // ošetření chyb na konci funkce
-    }
-
-    // Žádáme o další token
-    parser_getNextToken(POKE_SCANNER);
-
-    // Očekávaným terminálem je "("
-    if(LLparser_isNotExpectedTerminal(T_LEFT_BRACKET)) {
-        goto parseIf_errorLevel_0;  // ošetření chyb na konci funkce
-    }
-
-    // Žádáme o další token
-    parser_getNextToken(POKE_SCANNER);
-
-    // Analyzujeme výraz (podmínku if) - předáváme řízení precedenčnímu synt. analyzátoru
-    AST_ExprNode *condition = precParser_parse(NT_IF);
-
-    if(parser_errorWatcher(IS_PARSING_ERROR)) {
-        goto parseIf_errorLevel_0;  // ošetření chyb na konci funkce
-    }
-
-    // Očekávaným terminálem je ")"
-    if(LLparser_isNotExpectedTerminal(T_RIGHT_BRACKET)) {
-        goto parseIf_errorLevel_1;  // ošetření chyb na konci funkce
-    }
-
-    // Žádáme o další token
-    parser_getNextToken(POKE_SCANNER);
-
-    // Analyzujeme neterminál <NULL_COND>
-    AST_VarNode *nullCond = LLparser_parseNullCond();
-
-    if(parser_errorWatcher(IS_PARSING_ERROR)) {
-        goto parseIf_errorLevel_1;  // ošetření chyb na konci funkce
-    }
-
-    // Analyzujeme neterminál <SEQUENCE>
-    AST_StatementNode *thenBranch = LLparser_parseSequence(nullCond == NULL);
-
-    if(parser_errorWatcher(IS_PARSING_ERROR)) {
-        if(frameStack_pop() == FRAME_STACK_POP_GLOBAL) {
-            parser_errorWatcher(SET_ERROR_INTERNAL);
-        }
-        goto parseIf_errorLevel_2;  // ošetření chyb na konci funkce
-    }
-
-    // Popneme rámec pro "if" blok
-    if(frameStack_pop() == FRAME_STACK_POP_GLOBAL) {
-        parser_errorWatcher(SET_ERROR_INTERNAL);
-        goto parseIf_errorLevel_2;  // ošetření chyb na konci funkce
-    }
-
-    // Očekávaným terminálem je "else"
-    if(LLparser_isNotExpectedTerminal(T_ELSE)) {
-        goto parseIf_errorLevel_3;  // ošetření chyb na konci funkce
-    }
-
-    // Žádáme o další token
-    parser_getNextToken(POKE_SCANNER);
-
-    // Analyzujeme neterminál <SEQUENCE>
-    AST_StatementNode *elseBranch = LLparser_parseSequence(true);
-
-    if(parser_errorWatcher(IS_PARSING_ERROR)) {
-        if(frameStack_pop() == FRAME_STACK_POP_GLOBAL) {
-            parser_errorWatcher(SET_ERROR_INTERNAL);
-        }
-        goto parseIf_errorLevel_4;  // ošetření chyb na konci funkce
-    }
-
-    // Popneme rámec pro "else" blok
-    if(frameStack_pop() == FRAME_STACK_POP_GLOBAL) {
-        parser_errorWatcher(SET_ERROR_INTERNAL);
-        goto parseIf_errorLevel_4;  // ošetření chyb na konci funkce
-    }
-
-    // Vytvoříme a inicializujeme uzel pro "if" příkaz
-    AST_IfNode *ifNode = (AST_IfNode *)AST_createNode(AST_IF_NODE);
-    if(parser_errorWatcher(IS_PARSING_ERROR)) {
-        goto parseIf_errorLevel_4;  // ošetření chyb na konci funkce
-    }
-
-    AST_initNewIfNode(ifNode, condition, nullCond, thenBranch, elseBranch);
-
-    // Vracíme uzel pro konstrukci "if"
-    return ifNode;
-
-
-    /***                                                                    ***/
-    /*              ZPRACOVÁNÍ CHYB A UVOLNĚNÍ ZDROJŮ TÉTO FUNKCE             */
-    /***                                                                    ***/
-
-    // Úroveň 4: seznam uzlů příkazů větve "else"
-    parseIf_errorLevel_4:
-        AST_destroyStatementList(elseBranch);
-
-    // Úroveň 3: seznam uzlů příkazů větve "then"
-    parseIf_errorLevel_3:
-        AST_destroyStatementList(thenBranch);
-
-    // Úroveň 2: uzel volitelnou nullable podmínku
-    parseIf_errorLevel_2:
-        AST_destroyNode(AST_VAR_NODE, nullCond);
-
-    // Úroveň 1: uzel pro výraz podmínky příkazu "if"
-    parseIf_errorLevel_1:
-        AST_destroyNode(AST_EXPR_NODE, condition);
-
-    // Úroveň 0: hodnota řetězce aktuálního terminálu
-    parseIf_errorLevel_0:
-        parser_freeCurrentTerminalValue();
-        return PARSING_ERROR;
-} // LLparser_parseIf()
-
 /**
  * @brief Analyzuje neterminál @c \<NT_NULL_COND>, který reprezentuje případnou
  *        null podmínku.
@@ -1533,97 +1425,6 @@ AST_StatementNode *LLparser_parseSequence(bool createFrame) {
         return PARSING_ERROR;
 } // LLparser_parseSequence()
 
-/**
- * @brief Analyzuje neterminál @c \<WHILE>, který reprezentuje cyklus @c while.
- */
-AST_WhileNode *LLparser_parseWhile() {
-    // Očekávaným terminálem je "while"
-    if(LLparser_isNotExpectedTerminal(T_WHILE)) {
-        goto parseWhile_errorLevel_0;  // ošetření chyb na konci funkce
-    }
-
-    // Žádáme o další token
-    parser_getNextToken(POKE_SCANNER);
-
-    // Očekávaným terminálem je "("
-    if(LLparser_isNotExpectedTerminal(T_LEFT_BRACKET)) {
-        goto parseWhile_errorLevel_0;  // ošetření chyb na konci funkce
-    }
-
-    // Žádáme od další token
-    parser_getNextToken(POKE_SCANNER);
-
-    // Analyzujeme výraz (podmínku while) - předáváme řízení precedenčnímu synt. analyzátoru
-    AST_ExprNode *condition = precParser_parse(NT_WHILE);
-
-    if(parser_errorWatcher(IS_PARSING_ERROR)) {
-        goto parseWhile_errorLevel_0;  // ošetření chyb na konci funkce
-    }
-
-    // Očekávaným terminálem je ")"
-    if(LLparser_isNotExpectedTerminal(T_RIGHT_BRACKET)) {
-        goto parseWhile_errorLevel_1;  // ošetření chyb na konci funkce
-    }
-
-    // Žádáme o další token
-    parser_getNextToken(POKE_SCANNER);
-
-    // Analyzujeme neterminál <NULL_COND>
-    AST_VarNode *nullCond = LLparser_parseNullCond();
-
-    if(parser_errorWatcher(IS_PARSING_ERROR)) {
-        goto parseWhile_errorLevel_1;  // ošetření chyb na konci funkce
-    }
-
-    // Analyzujeme neterminál <SEQUENCE>
-    AST_StatementNode *body = LLparser_parseSequence(nullCond == NULL);
-
-    if(parser_errorWatcher(IS_PARSING_ERROR)) {
-        if(frameStack_pop() == FRAME_STACK_POP_GLOBAL) {
-            parser_errorWatcher(SET_ERROR_INTERNAL);
-        }
-        goto parseWhile_errorLevel_2;  // ošetření chyb na konci funkce
-    }
-
-    // Popneme rámec pro 'while' blok
-    if(frameStack_pop() == FRAME_STACK_POP_GLOBAL) {
-        parser_errorWatcher(SET_ERROR_INTERNAL);
-        goto parseWhile_errorLevel_3;  // ošetření chyb na konci funkce
-    }
-
-    // Vytvoříme a inicializujeme uzel pro příkaz "while"
-    AST_WhileNode *whileNode = (AST_WhileNode *)AST_createNode(AST_WHILE_NODE);
-
-    if(whileNode == NULL) {
-        goto parseWhile_errorLevel_3;  // ošetření chyb na konci funkce
-    }
-
-    AST_initNewWhileNode(whileNode, condition, nullCond, body);
-
-    return whileNode;
-
-    /***                                                                    ***/
-    /*              ZPRACOVÁNÍ CHYB A UVOLNĚNÍ ZDROJŮ TÉTO FUNKCE             */
-    /***                                                                    ***/
-
-    // Úroveň 3: seznam uzlů příkazů těla cyklu "while"
-    parseWhile_errorLevel_3:
-        AST_destroyStatementList(body);
-
-    // Úroveň 2: uzel pro volitelnou nullable podmínku
-    parseWhile_errorLevel_2:
-        AST_destroyNode(AST_VAR_NODE, nullCond);
-
-    // Úroveň 1: uzel pro výraz v podmínce cyklu "while"
-    parseWhile_errorLevel_1:
-        AST_destroyNode(AST_EXPR_NODE, condition);
-
-    // Úroveň 0: hodnota řetězce aktuálního terminálu
-    parseWhile_errorLevel_0:
-        parser_freeCurrentTerminalValue();
-        return PARSING_ERROR;
-} // LLparser_parseWhile()
-
 /**
  * @brief Analyzuje neterminál @c \<ARGUMENTS>, který reprezentuje seznam
  *        argumentů funkce.
@@ -1894,82 +1695,6 @@ AST_StatementNode *LLparser_parseRuleStatement3() {
         return PARSING_ERROR;
 } // LLparser_parseRuleStatement3()
 
-/**
- * @brief Analyzuje pravidlo `<STATEMENT> -> <IF>`.
- */
-AST_StatementNode *LLparser_parseRuleStatement4() {
-    // Analyzujeme neterminál <IF>
-    AST_IfNode *ifNode = LLparser_parseIf();
-
-    if(parser_errorWatcher(IS_PARSING_ERROR)) {
-        goto parseRuleStatement4_errorHandle;  // ošetření chyb na konci funkce
-    }
-
-    // Vytvoříme a inicializujeme uzel pro příkaz
-    AST_StatementNode *statementNode = (AST_StatementNode *)AST_createNode(AST_STATEMENT_NODE);
-
-    if(parser_errorWatcher(IS_PARSING_ERROR)) {
-        AST_destroyNode(AST_IF_NODE, ifNode);
-        goto parseRuleStatement4_errorHandle;  // ošetření chyb na konci funkce
-    }
-
-    AST_initNewStatementNode(statementNode, frameStack.top->frameID, \
-                             AST_STATEMENT_IF, ifNode);
-
-    return statementNode;
-
-
-    /***                                                                    ***/
-    /*              ZPRACOVÁNÍ CHYB A UVOLNĚNÍ ZDROJŮ TÉTO FUNKCE             */
-    /***                                                                    ***/
-
-    // Úroveň 0: hodnota řetězce aktuálního terminálu
-    parseRuleStatement4_errorHandle:
-        parser_freeCurrentTerminalValue();
-        return PARSING_ERROR;
-} // LLparser_parseRuleStatement4()
-
-/**
- * @brief Analyzuje pravidlo `<STATEMENT> -> <WHILE>`.
- */
-AST_StatementNode *LLparser_parseRuleStatement5() {
-    // Analyzujeme neterminál <WHILE>
-    AST_WhileNode *whileNode = LLparser_parseWhile();
-
-    if(parser_errorWatcher(IS_PARSING_ERROR)) {
-        goto parseRuleStatement5_errorLevel_1;  // ošetření chyb na konci funkce
-    }
-
-    // Vytvoříme a inicializujeme uzel pro příkaz
-    AST_StatementNode *statementNode = (AST_StatementNode *)AST_createNode(AST_STATEMENT_NODE);
-
-    if(parser_errorWatcher(IS_PARSING_ERROR)) {
-        goto parseRuleStatement5_errorLevel_2;  // ošetření chyb na konci funkce
-    }
-
-    AST_initNewStatementNode(statementNode, frameStack.top->frameID, \
-                             AST_STATEMENT_WHILE, whileNode);
-
-    return statementNode;
-
-
-    /***                                                                    ***/
-    /*              ZPRACOVÁNÍ CHYB A UVOLNĚNÍ ZDROJŮ TÉTO FUNKCE             */
-    /***                                                                    ***/
-
-    // Úroveň 2: seznam uzlů příkazů
-    parseRuleStatement5_errorLevel_2:
-        AST_destroyStatementList(statementNode);
-
-    // Úroveň 1: uzel příkaz cyklu while
-    parseRuleStatement5_errorLevel_1:
-        AST_destroyNode(AST_WHILE_NODE, whileNode);
-
-    // parseRuleStatement5_errorLevel_0
-        parser_freeCurrentTerminalValue();
-        return PARSING_ERROR;
-} // LLparser_parseRuleStatement5()
-
 /**
  * @brief Analyzuje pravidlo `<STATEMENT> -> return [precedence_expression] ;`.
  */
@@ -2309,6 +2034,253 @@ AST_StatementNode *LLparser_parseRuleStatementRest2(DString **identifier) {
 } // LLparser_parseRuleStatementRest2()
 
 
+/*******************************************************************************
+ *                                                                             *
+ *         IMPLEMENTACE INTERNÍCH FUNKCÍ PRO ZÁSOBNÍK BLOKŮ PŘÍKAZŮ            *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Analyzuje začátek příkazu `if` nebo `while` až po "{" jeho bloku.
+ */
+bool LLparser_openBlock(LLparser_BlockStack *stack, LLRuleSet rule) {
+    bool isIf = (rule == STATEMENT_4);
+
+    // Další fáze překladu procházejí AST rekurzivně, hlubší zanoření by
+    // vyčerpalo jejich zásobník volání
+    if(stack->count > LLPARSER_MAX_NESTING_DEPTH) {
+        parser_errorWatcher(SET_ERROR_INTERNAL);
+        return false;
+    }
+
+    // Blok vložíme na zásobník hned, jeho části pak při chybě uvolní volající
+    if(!LLparser_pushBlock(stack, isIf ? LL_BLOCK_IF_THEN : LL_BLOCK_WHILE)) {
+        return false;
+    }
+
+    LLparser_Block *block = &stack->blocks[stack->count - 1];
+
+    // Očekávaným terminálem je "if", resp. "while"
+    if(LLparser_isNotExpectedTerminal(isIf ? T_IF : T_WHILE)) {
+        return false;
+    }
+
+    // Žádáme o další token
+    parser_getNextToken(POKE_SCANNER);
+
+    // Očekávaným terminálem je "("
+    if(LLparser_isNotExpectedTerminal(T_LEFT_BRACKET)) {
+        return false;
+    }
+
+    // Žádáme o další token
+    parser_getNextToken(POKE_SCANNER);
+
+    // Analyzujeme výraz podmínky - předáváme řízení precedenčnímu synt. analyzátoru
+    block->condition = precParser_parse(isIf ? NT_IF : NT_WHILE);
+
+    if(parser_errorWatcher(IS_PARSING_ERROR)) {
+        return false;
+    }
+
+    // Očekávaným terminálem je ")"
+    if(LLparser_isNotExpectedTerminal(T_RIGHT_BRACKET)) {
+        return false;
+    }
+
+    // Žádáme o další token
+    parser_getNextToken(POKE_SCANNER);
+
+    // Analyzujeme neterminál <NULL_COND>
+    block->nullCond = LLparser_parseNullCond();
+
+    if(parser_errorWatcher(IS_PARSING_ERROR)) {
+        return false;
+    }
+
+    // Null podmínka už rámec bloku vytvořila
+    block->framePushed = (block->nullCond != NULL);
+
+    // Otevřeme blok <SEQUENCE>
+    return LLparser_openSequence(block, block->nullCond == NULL);
+} // LLparser_openBlock()
+
+/**
+ * @brief Analyzuje "{" na začátku bloku a případně vytvoří jeho rámec.
+ */
+bool LLparser_openSequence(LLparser_Block *block, bool createFrame) {
+    // Očekávaným terminálem je "{"
+    if(LLparser_isNotExpectedTerminal(T_LEFT_CURLY_BRACKET)) {
+        return false;
+    }
+
+    // Žádáme o další token
+    parser_getNextToken(POKE_SCANNER);
+
+    // Pushneme nový rámec na zásobník rámců
+    if(createFrame) {
+        frameStack_push(NOT_FUNCTION);
+        block->framePushed = true;
+    }
+
+    return true;
+} // LLparser_openSequence()
+
+/**
+ * @brief Analyzuje "}" na konci bloku na vrcholu zásobníku bloků.
+ */
+bool LLparser_closeBlock(LLparser_BlockStack *stack) {
+    LLparser_Block *block = &stack->blocks[stack->count - 1];
+
+    // Očekávaným terminálem je "}"
+    if(LLparser_isNotExpectedTerminal(T_RIGHT_CURLY_BRACKET)) {
+        return false;
+    }
+
+    // Žádáme o další token
+    parser_getNextToken(POKE_SCANNER);
+
+    // Popneme rámec bloku
+    block->framePushed = false;
+    if(frameStack_pop() == FRAME_STACK_POP_GLOBAL) {
+        parser_errorWatcher(SET_ERROR_INTERNAL);
+        return false;
+    }
+
+    // Po větvi "then" následuje "else" <SEQUENCE>, blok zůstává na zásobníku
+    if(block->kind == LL_BLOCK_IF_THEN) {
+        block->kind = LL_BLOCK_IF_ELSE;
+        block->thenBranch = block->first;
+        block->first = NULL;
+        block->last = NULL;
+
+        // Očekávaným terminálem je "else"
+        if(LLparser_isNotExpectedTerminal(T_ELSE)) {
+            return false;
+        }
+
+        // Žádáme o další token
+        parser_getNextToken(POKE_SCANNER);
+
+        return LLparser_openSequence(block, true);
+    }
+
+    // Vytvoříme a inicializujeme uzel pro příkaz "if", resp. "while"
+    AST_NodeType nodeType = AST_WHILE_NODE;
+    AST_StatementType statementType = AST_STATEMENT_WHILE;
+    void *node = NULL;
+
+    if(block->kind == LL_BLOCK_IF_ELSE) {
+        AST_IfNode *ifNode = (AST_IfNode *)AST_createNode(AST_IF_NODE);
+        if(parser_errorWatcher(IS_PARSING_ERROR)) {
+            return false;
+        }
+
+        AST_initNewIfNode(ifNode, block->condition, block->nullCond, \
+                          block->thenBranch, block->first);
+        nodeType = AST_IF_NODE;
+        statementType = AST_STATEMENT_IF;
+        node = ifNode;
+    }
+    else {
+        AST_WhileNode *whileNode = (AST_WhileNode *)AST_createNode(AST_WHILE_NODE);
+        if(parser_errorWatcher(IS_PARSING_ERROR)) {
+            return false;
+        }
+
+        AST_initNewWhileNode(whileNode, block->condition, block->nullCond, block->first);
+        node = whileNode;
+    }
+
+    // Části bloku nyní vlastní nový uzel, blok odstraníme ze zásobníku
+    stack->count--;
+
+    // Vytvoříme a inicializujeme uzel pro příkaz
+    AST_StatementNode *statementNode = (AST_StatementNode *)AST_createNode(AST_STATEMENT_NODE);
+
+    if(parser_errorWatcher(IS_PARSING_ERROR)) {
+        AST_destroyNode(nodeType, node);
+        return false;
+    }
+
+    AST_initNewStatementNode(statementNode, frameStack.top->frameID, statementType, node);
+
+    // Příkaz připojíme k seznamu příkazů nadřazeného bloku
+    LLparser_appendStatement(&stack->blocks[stack->count - 1], statementNode);
+
+    return true;
+} // LLparser_closeBlock()
+
+/**
+ * @brief Vloží na zásobník bloků nový prázdný blok.
+ */
+bool LLparser_pushBlock(LLparser_BlockStack *stack, LLparser_BlockKind kind) {
+    // Pokud došla kapacita zásobníku, tak jej rozšíříme
+    if(stack->count == stack->allocated) {
+        size_t allocated = (stack->allocated == 0) ? LLPARSER_BLOCK_STACK_INIT_SIZE : \
+                           stack->allocated * LLPARSER_BLOCK_STACK_EXPAND_FACTOR;
+        LLparser_Block *blocks = realloc(stack->blocks, allocated * sizeof(LLparser_Block));
+
+        if(blocks == NULL) {
+            parser_errorWatcher(SET_ERROR_INTERNAL);
+            return false;
+        }
+
+        stack->blocks = blocks;
+        stack->allocated = allocated;
+    }
+
+    LLparser_Block *block = &stack->blocks[stack->count++];
+    block->kind = kind;
+    block->first = NULL;
+    block->last = NULL;
+    block->condition = NULL;
+    block->nullCond = NULL;
+    block->thenBranch = NULL;
+    block->framePushed = false;
+
+    return true;
+} // LLparser_pushBlock()
+
+/**
+ * @brief Připojí příkaz na konec seznamu příkazů bloku.
+ */
+void LLparser_appendStatement(LLparser_Block *block, AST_StatementNode *statement) {
+    if(block->first == NULL) {
+        block->first = statement;
+    }
+    else {
+        block->last->next = statement;
+    }
+
+    block->last = statement;
+} // LLparser_appendStatement()
+
+/**
+ * @brief Uvolní všechny otevřené bloky zásobníku bloků včetně jejich uzlů.
+ */
+void LLparser_destroyBlockStack(LLparser_BlockStack *stack) {
+    // Bloky uvolňujeme od vrcholu, rámce tak popujeme ve správném pořadí
+    for(size_t i = stack->count; i > 0; i--) {
+        LLparser_Block *block = &stack->blocks[i - 1];
+
+        AST_destroyStatementList(block->first);
+        AST_destroyStatementList(block->thenBranch);
+        AST_destroyNode(AST_VAR_NODE, block->nullCond);
+        AST_destroyNode(AST_EXPR_NODE, block->condition);
+
+        if(block->framePushed) {
+            frameStack_pop();
+        }
+    }
+
+    free(stack->blocks);
+    stack->blocks = NULL;
+    stack->count = 0;
+    stack->allocated = 0;
+} // LLparser_destroyBlockStack()
+
+
 /*******************************************************************************
  *                                                                             *
  *             IMPLEMENTACE POMOCNÝCH INTERNÍCH FUNKCÍ LL PARSERU              *
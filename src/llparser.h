@@ -45,6 +45,63 @@
 
 #define PARSING_SYNTAX_ERROR NULL    /**< Slouží k propagaci chyby syntaxe návratovými hodnotami při rekurzivním sestupu.  */
 
+#define LLPARSER_BLOCK_STACK_INIT_SIZE     16  /**< Počáteční kapacita zásobníku bloků příkazů.  */
+#define LLPARSER_BLOCK_STACK_EXPAND_FACTOR 2   /**< Násobek rozšíření zásobníku bloků příkazů.   */
+#define LLPARSER_MAX_NESTING_DEPTH         1000 /**< Nejvyšší hloubka zanoření příkazů "if" a "while". */
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                             VÝČTOVÉ DATOVÉ TYPY                             *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Druh otevřeného bloku příkazů na zásobníku bloků.
+ */
+typedef enum LLparser_BlockKind {
+    LL_BLOCK_SEQUENCE = 0,  /**< Blok, jehož "}" zpracuje volající (např. tělo funkce) */
+    LL_BLOCK_IF_THEN  = 1,  /**< Větev "then" podmíněného příkazu "if"                 */
+    LL_BLOCK_IF_ELSE  = 2,  /**< Větev "else" podmíněného příkazu "if"                 */
+    LL_BLOCK_WHILE    = 3,  /**< Tělo cyklu "while"                                    */
+} LLparser_BlockKind;
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                             DEFINICE STRUKTUR                               *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Otevřený blok příkazů, jehož analýza ještě neskončila.
+ *
+ * @details Blok uchovává rozpracovaný seznam svých příkazů a části příkazu
+ *          "if" nebo "while", které byly analyzovány před otevřením bloku.
+ *          Při chybě je blok vlastníkem všech těchto uzlů.
+ */
+typedef struct LLparser_Block {
+    LLparser_BlockKind kind;            /**< Druh bloku                                     */
+    AST_StatementNode *first;           /**< První příkaz seznamu příkazů bloku             */
+    AST_StatementNode *last;            /**< Poslední příkaz seznamu příkazů bloku          */
+    AST_ExprNode *condition;            /**< Podmínka příkazu "if", resp. "while"           */
+    AST_VarNode *nullCond;              /**< Případná null podmínka                         */
+    AST_StatementNode *thenBranch;      /**< Uzavřená větev "then" (jen pro větev "else")   */
+    bool framePushed;                   /**< Blok má na zásobníku rámců vlastní rámec       */
+} LLparser_Block;
+
+/**
+ * @brief Zásobník otevřených bloků příkazů.
+ *
+ * @details Nahrazuje rekurzi přes vnořené příkazy "if" a "while", hloubka
+ *          zanoření tak neomezuje zásobník volání parseru.
+ */
+typedef struct LLparser_BlockStack {
+    LLparser_Block *blocks;             /**< Pole bloků (vrchol je na konci)    */
+    size_t count;                       /**< Počet otevřených bloků             */
+    size_t allocated;                   /**< Kapacita pole bloků                */
+} LLparser_BlockStack;
+
 
 /*******************************************************************************
  *                                                                             *
@@ -252,10 +309,13 @@ AST_DataType LLparser_parseDataType();
  * @brief Analyzuje neterminál @c \<STATEMENT_LIST>, který reprezentuje
  *        seznam příkazů.
  *
- * @details Funkce rekurzivně parsuje jednotlivé příkazy pomocí volání
- *          @c LLparser_parseStatement() a vytváří z nich propojený seznam
- *          uzlů typu @c AST_StatementNode. Pokud je seznam prázdný, funkce
- *          vrací @c NULL.
+ * @details Funkce je prediktivní analyzátor řízený LL tabulkou s explicitním
+ *          zásobníkem bloků. Jednoduché příkazy analyzuje voláním
+ *          @c LLparser_parseStatement(), příkazy @c if a @c while otevírají
+ *          vnořený blok na zásobníku bloků a po jeho "}" se z nich vytvoří
+ *          uzel příkazu. Délka seznamu ani hloubka zanoření tak nezvětšují
+ *          zásobník volání. Vrací propojený seznam uzlů typu
+ *          @c AST_StatementNode, pokud je seznam prázdný, vrací @c NULL.
  * @note
  * Neterminál se může dále rozvíjet na:
  * - `<STATEMENT_LIST> -> <STATEMENT> <STATEMENT_LIST>`
@@ -270,11 +330,12 @@ AST_StatementNode *LLparser_parseStatementList();
  * @brief Analyzuje neterminál @c \<STATEMENT>, který reprezentuje jeden příkaz
  *        programu.
  *
- * @details Funkce zpracovává různé typy příkazů, jako je definice proměnné,
- *          přiřazení, volání funkce, podmíněný příkaz @c if, cyklus @c while,
- *          návratový příkaz @c return nebo volání vestavěných funkcí @c ifj.
- *          Na základě aktuálního tokenu a LL tabulky rozhoduje, které pravidlo
- *          aplikovat a volá příslušnou funkci pro analýzy.
+ * @details Funkce zpracovává jednoduché příkazy, jako je definice proměnné,
+ *          přiřazení, volání funkce, návratový příkaz @c return nebo volání
+ *          vestavěných funkcí @c ifj. Na základě aktuálního tokenu a LL
+ *          tabulky rozhoduje, které pravidlo aplikovat a volá příslušnou
+ *          funkci pro analýzy. Příkazy @c if a @c while obsahují vnořené
+ *          bloky, a proto je zpracovává @c LLparser_parseStatementList().
  * @note
  * Neterminál se může dále rozvíjet na:
  * - `<STATEMENT> -> <VAR_DEF> ;`
@@ -383,23 +444,6 @@ AST_StatementNode *LLparser_parseStatementRest(DString **identifier);
  */
 AST_ExprNode *LLparser_parseThrowAway();
 
-/**
- * @brief Analyzuje neterminál @c \<IF>, který reprezentuje podmíněný
- *        příkaz @c if.
- *
- * @details Funkce zpracovává konstrukci podmíněného příkazu @c if, včetně podmínky,
- *          případné null podmínky a těla příkazu. Podmínka je zpracována pomocí
- *          precedenčního parseru. Funkce také spravuje rámce pro bloky kódu
- *          v @c if a @c else větvích. Vytváří AST uzel typu @c AST_IfNode.
- * @note
- * Neterminál se může dále rozvíjet na:
- * - `<IF> -> if ( [precedence_expr] ) <NULL_COND> <SEQUENCE> else <SEQUENCE>`
- *
- * @return Ukazatel na AST uzel konstrukce @c if typu @c AST_IfNode,
- *         nebo @c PARSING_ERROR při chybě.
- */
-AST_IfNode *LLparser_parseIf();
-
 /**
  * @brief Analyzuje neterminál @c \<NT_NULL_COND>, který reprezentuje případnou
  *        null podmínku.
@@ -440,22 +484,6 @@ AST_VarNode *LLparser_parseNullCond();
  */
 AST_StatementNode *LLparser_parseSequence(bool createFrame);
 
-/**
- * @brief Analyzuje neterminál @c \<WHILE>, který reprezentuje cyklus @c while.
- *
- * @details Funkce zpracovává konstrukci cyklu @c while, včetně podmínky,
- *          případné null podmínky a těla cyklu. Podmínka je zpracována pomocí
- *          precedenčního parseru. Spravuje rámce pro tělo cyklu a vytváří AST
- *          uzel typu @c AST_WhileNode.
- * @note
- * Neterminál se může dále rozvíjet na:
- * - `<WHILE> -> while ( [precedence_expr] ) <NULL_COND> <SEQUENCE>`
- *
- * @return Ukazatel na AST uzel konstrukce @c while typu @c AST_WhileNode,
- *         nebo @c PARSING_ERROR při chybě.
- */
-AST_WhileNode *LLparser_parseWhile();
-
 /**
  * @brief Analyzuje neterminál @c \<ARGUMENTS>, který reprezentuje seznam
  *        argumentů funkce.
@@ -519,30 +547,6 @@ AST_StatementNode *LLparser_parseRuleStatement2();
  */
 AST_StatementNode *LLparser_parseRuleStatement3();
 
-/**
- * @brief Analyzuje pravidlo `<STATEMENT> -> <IF>`.
- *
- * @details Funkce zpracovává podmíněný příkaz @c if voláním @c LLparser_parseIf().
- *          Vytváří AST uzel typu @c AST_StatementNode pro příkaz obsahující
- *          konstrukci @c if.
- *
- * @return Ukazatel na AST uzel příkazu typu @c AST_StatementNode,
- *         nebo @c PARSING_ERROR při chybě.
- */
-AST_StatementNode *LLparser_parseRuleStatement4();
-
-/**
- * @brief Analyzuje pravidlo `<STATEMENT> -> <WHILE>`.
- *
- * @details Funkce zpracovává cyklus @c while voláním @c LLparser_parseWhile().
- *          Vytváří AST uzel typu @c AST_StatementNode pro příkaz obsahující
- *          konstrukci @c while.
- *
- * @return Ukazatel na AST uzel příkazu typu @c AST_StatementNode,
- *         nebo @c PARSING_ERROR při chybě.
- */
-AST_StatementNode *LLparser_parseRuleStatement5();
-
 /**
  * @brief Analyzuje pravidlo `<STATEMENT> -> return [precedence_expression] ;`.
  *
@@ -597,6 +601,82 @@ AST_StatementNode *LLparser_parseRuleStatementRest1(DString **identifier);
  */
 AST_StatementNode *LLparser_parseRuleStatementRest2(DString **identifier);
 
+/*******************************************************************************
+ *                                                                             *
+ *           DEKLARACE INTERNÍCH FUNKCÍ PRO ZÁSOBNÍK BLOKŮ PŘÍKAZŮ             *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Analyzuje začátek příkazu @c if nebo @c while až po "{" jeho bloku.
+ *
+ * @details Vloží na zásobník nový blok a analyzuje podmínku, případnou null
+ *          podmínku a "{" bloku. Seznam příkazů bloku pak pokračuje v
+ *          @c LLparser_parseStatementList(). Zanoření hlubší než
+ *          @c LLPARSER_MAX_NESTING_DEPTH je interní chybou překladače.
+ * @note
+ * Zpracovává začátek pravidel:
+ * - `<IF> -> if ( [precedence_expr] ) <NULL_COND> <SEQUENCE> else <SEQUENCE>`
+ * - `<WHILE> -> while ( [precedence_expr] ) <NULL_COND> <SEQUENCE>`
+ *
+ * @param [in,out] stack Zásobník otevřených bloků
+ * @param [in] rule Pravidlo @c STATEMENT_4 (if), nebo @c STATEMENT_5 (while)
+ *
+ * @return `true`, pokud nedošlo k chybě, jinak `false`. Při chybě zůstávají
+ *         analyzované části na zásobníku bloků.
+ */
+bool LLparser_openBlock(LLparser_BlockStack *stack, LLRuleSet rule);
+
+/**
+ * @brief Analyzuje "{" na začátku bloku a případně vytvoří jeho rámec.
+ *
+ * @param [in,out] block Otevíraný blok
+ * @param [in] createFrame Boolean hodnota určující, zda má být vytvořen nový rámec.
+ *
+ * @return `true`, pokud nedošlo k chybě, jinak `false`.
+ */
+bool LLparser_openSequence(LLparser_Block *block, bool createFrame);
+
+/**
+ * @brief Analyzuje "}" na konci bloku na vrcholu zásobníku bloků.
+ *
+ * @details Po větvi "then" analyzuje "else" a otevře větev "else". Po větvi
+ *          "else" a po těle cyklu vytvoří uzel příkazu @c if, resp. @c while,
+ *          odstraní blok ze zásobníku a příkaz připojí k nadřazenému bloku.
+ *
+ * @param [in,out] stack Zásobník otevřených bloků
+ *
+ * @return `true`, pokud nedošlo k chybě, jinak `false`.
+ */
+bool LLparser_closeBlock(LLparser_BlockStack *stack);
+
+/**
+ * @brief Vloží na zásobník bloků nový prázdný blok.
+ *
+ * @param [in,out] stack Zásobník otevřených bloků
+ * @param [in] kind Druh nového bloku
+ *
+ * @return `true`, pokud se blok podařilo vložit, jinak `false`.
+ */
+bool LLparser_pushBlock(LLparser_BlockStack *stack, LLparser_BlockKind kind);
+
+/**
+ * @brief Připojí příkaz na konec seznamu příkazů bloku.
+ *
+ * @param [in,out] block Blok, ke kterému se příkaz připojí
+ * @param [in] statement Připojovaný příkaz
+ */
+void LLparser_appendStatement(LLparser_Block *block, AST_StatementNode *statement);
+
+/**
+ * @brief Uvolní všechny otevřené bloky zásobníku bloků včetně jejich uzlů.
+ *
+ * @details Popne také rámce, které bloky vytvořily.
+ *
+ * @param [in,out] stack Zásobník otevřených bloků
+ */
+void LLparser_destroyBlockStack(LLparser_BlockStack *stack);
+
 /*******************************************************************************
  *                                                                             *
  *              DEKLARACE POMOCNÝCH INTERNÍCH FUNKCÍ LL PARSERU                *
@@ -0,0 +1,293 @@
+/*******************************************************************************
+ *                                                                             *
+ * Název projektu:   Implementace překladače imperativního jazyka IFJ24        *
+ *                                                                             *
+ * Soubor:           number_literal.c                                          *
+ * Autor:            Farkašovský Lukáš  <xfarkal00>                            *
+ *                                                                             *
+ * Datum:            04.12.2024                                                *
+ * Poslední změna:   04.12.2024                                                *
+ *                                                                             *
+ * Tým:      Tým xkalinj00                                                     *
+ * Členové:  Farkašovský Lukáš    <xfarkal00>                                  *
+ *           Hýža Pavel           <xhyzapa00>                                  *
+ *           Kalina Jan           <xkalinj00>                                  *
+ *           Krejčí David         <xkrejcd00>                                  *
+ *                                                                             *
+ ******************************************************************************/
+/**
+ * @file number_literal.c
+ * @author Farkašovský Lukáš \<xfarkal00>
+ *
+ * @brief Implementace převodu číselných literálů.
+ * @details Rychlá cesta převodu desetinných čísel je přesná, protože mantisa
+ *          i mocnina deseti jsou přesně reprezentovatelné v typu `double`
+ *          a jediná operace IEEE 754 je správně zaokrouhlená.
+ */
+
+#include <string.h>
+#include <float.h>
+#include "number_literal.h"
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                       INICIALIZACE GLOBÁLNÍCH PROMĚNNÝCH                    *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Přesně reprezentovatelné mocniny deseti.
+ */
+static const double numberPowersOfTen[NUMBER_MAX_FAST_EXPONENT + 1] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/**
+ * @brief Hexadecimální číslice ve formátu `%a`.
+ */
+static const char numberHexDigits[] = "0123456789abcdef";
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                        IMPLEMENTACE VEŘEJNÝCH FUNKCÍ                        *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Převede celočíselný literál na hodnotu.
+ */
+bool numberLiteral_parseInt(const char *str, size_t length, int64_t *value) {
+    if(str == NULL || value == NULL || length == 0) {
+        return false;
+    }
+
+    int64_t result = 0;
+    for(size_t i = 0; i < length; i++) {
+        if(str[i] < '0' || str[i] > '9') {
+            return false;
+        }
+
+        // Při přetečení hodnotu nasytíme a pokračujeme v kontrole znaků
+        int64_t digit = str[i] - '0';
+        if(result > (INT64_MAX - digit) / 10) {
+            result = INT64_MAX;
+        }
+        else {
+            result = result * 10 + digit;
+        }
+    }
+
+    *value = result;
+    return true;
+}  // numberLiteral_parseInt()
+
+/**
+ * @brief Převede desetinný literál na hodnotu.
+ */
+bool numberLiteral_parseFloat(const char *str, size_t length, double *value) {
+    if(str == NULL || value == NULL || length == 0) {
+        return false;
+    }
+
+    // Většina literálů je krátká a projde rychlou cestou
+    if(numberLiteral_parseFloatFast(str, length, value)) {
+        return true;
+    }
+
+    // Zbytek převede knihovní funkce, která zároveň ověří tvar literálu
+    char *endptr;
+    double result = strtod(str, &endptr);
+    if(endptr != str + length) {
+        return false;
+    }
+
+    *value = result;
+    return true;
+}  // numberLiteral_parseFloat()
+
+/**
+ * @brief Zapíše hodnotu `f64` v hexadecimálním zápisu.
+ */
+size_t numberLiteral_formatHexFloat(double value, char *buffer) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+
+    char *position = buffer;
+    if(bits >> 63) {
+        *position++ = '-';
+    }
+
+    int biasedExponent = (int)((bits >> 52) & 0x7FF);
+    uint64_t fraction = bits & ((UINT64_C(1) << 52) - 1);
+
+    // Nekonečno a NaN zapisujeme stejně jako knihovní "%a"
+    if(biasedExponent == 0x7FF) {
+        memcpy(position, (fraction != 0) ? "nan" : "inf", 4);
+        return (size_t)(position - buffer) + 3;
+    }
+
+    // Normalizovaná čísla mají skrytou jedničku, denormalizovaná a nula nulu
+    char leading = '1';
+    int exponent = biasedExponent - 1023;
+    if(biasedExponent == 0) {
+        leading = '0';
+        exponent = (fraction != 0) ? -1022 : 0;
+    }
+
+    *position++ = '0';
+    *position++ = 'x';
+    *position++ = leading;
+
+    // Zlomková část má 13 hexadecimálních číslic, koncové nuly vynecháme
+    if(fraction != 0) {
+        int digits = 13;
+        while((fraction & 0xF) == 0) {
+            fraction >>= 4;
+            digits--;
+        }
+
+        *position++ = '.';
+        for(int i = digits - 1; i >= 0; i--) {
+            *position++ = numberHexDigits[(fraction >> (4 * i)) & 0xF];
+        }
+    }
+
+    *position++ = 'p';
+    position += numberLiteral_formatExponent(exponent, position);
+    *position = '\0';
+
+    return (size_t)(position - buffer);
+}  // numberLiteral_formatHexFloat()
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                        IMPLEMENTACE INTERNÍCH FUNKCÍ                        *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Pokusí se převést desetinný literál rychlou cestou.
+ */
+bool numberLiteral_parseFloatFast(const char *str, size_t length, double *value) {
+    // Rychlá cesta spoléhá na výpočty přesně v typu double (ne x87)
+#if FLT_EVAL_METHOD != 0
+    (void)str;
+    (void)length;
+    (void)value;
+    return false;
+#else
+    uint64_t mantissa = 0;
+    int digits = 0;             // Počet platných číslic mantisy
+    int exponent = 0;           // Dekadický exponent mantisy
+    size_t i = 0;
+
+    // Celá část
+    for(; i < length && str[i] >= '0' && str[i] <= '9'; i++) {
+        if(mantissa == 0 && str[i] == '0') {
+            continue;
+        }
+        if(++digits > NUMBER_MAX_FAST_DIGITS) {
+            return false;
+        }
+        mantissa = mantissa * 10 + (uint64_t)(str[i] - '0');
+    }
+    if(i == 0) {
+        return false;
+    }
+
+    // Desetinná část, každá číslice sníží exponent
+    if(i < length && str[i] == '.') {
+        size_t start = ++i;
+        for(; i < length && str[i] >= '0' && str[i] <= '9'; i++) {
+            exponent--;
+            if(mantissa == 0 && str[i] == '0') {
+                continue;
+            }
+            if(++digits > NUMBER_MAX_FAST_DIGITS) {
+                return false;
+            }
+            mantissa = mantissa * 10 + (uint64_t)(str[i] - '0');
+        }
+        if(i == start) {
+            return false;
+        }
+    }
+
+    // Exponent, velké hodnoty stejně nepatří do rychlé cesty
+    if(i < length && (str[i] == 'e' || str[i] == 'E')) {
+        i++;
+        bool negative = false;
+        if(i < length && (str[i] == '+' || str[i] == '-')) {
+            negative = (str[i] == '-');
+            i++;
+        }
+
+        size_t start = i;
+        int explicitExponent = 0;
+        for(; i < length && str[i] >= '0' && str[i] <= '9'; i++) {
+            if(explicitExponent > 1000) {
+                return false;
+            }
+            explicitExponent = explicitExponent * 10 + (str[i] - '0');
+        }
+        if(i == start) {
+            return false;
+        }
+        exponent += negative ? -explicitExponent : explicitExponent;
+    }
+
+    if(i != length) {
+        return false;
+    }
+
+    // Nula je nulou s libovolným exponentem
+    if(mantissa == 0) {
+        *value = 0.0;
+        return true;
+    }
+
+    if(mantissa > NUMBER_MAX_EXACT_MANTISSA ||
+       exponent < -NUMBER_MAX_FAST_EXPONENT || exponent > NUMBER_MAX_FAST_EXPONENT) {
+        return false;
+    }
+
+    if(exponent >= 0) {
+        *value = (double)mantissa * numberPowersOfTen[exponent];
+    }
+    else {
+        *value = (double)mantissa / numberPowersOfTen[-exponent];
+    }
+
+    return true;
+#endif
+}  // numberLiteral_parseFloatFast()
+
+/**
+ * @brief Zapíše dekadický exponent hexadecimálního zápisu včetně znaménka.
+ */
+size_t numberLiteral_formatExponent(int exponent, char *buffer) {
+    char *position = buffer;
+    *position++ = (exponent < 0) ? '-' : '+';
+
+    unsigned magnitude = (unsigned)((exponent < 0) ? -exponent : exponent);
+
+    // Číslice zapíšeme odzadu a poté je otočíme
+    char digits[8];
+    size_t count = 0;
+    do {
+        digits[count++] = (char)('0' + magnitude % 10);
+        magnitude /= 10;
+    } while(magnitude != 0);
+
+    while(count > 0) {
+        *position++ = digits[--count];
+    }
+
+    return (size_t)(position - buffer);
+}  // numberLiteral_formatExponent()
+
+/*** Konec souboru number_literal.c ***/
@@ -0,0 +1,130 @@
+/*******************************************************************************
+ *                                                                             *
+ * Název projektu:   Implementace překladače imperativního jazyka IFJ24        *
+ *                                                                             *
+ * Soubor:           number_literal.h                                          *
+ * Autor:            Farkašovský Lukáš  <xfarkal00>                            *
+ *                                                                             *
+ * Datum:            04.12.2024                                                *
+ * Poslední změna:   04.12.2024                                                *
+ *                                                                             *
+ * Tým:      Tým xkalinj00                                                     *
+ * Členové:  Farkašovský Lukáš    <xfarkal00>                                  *
+ *           Hýža Pavel           <xhyzapa00>                                  *
+ *           Kalina Jan           <xkalinj00>                                  *
+ *           Krejčí David         <xkrejcd00>                                  *
+ *                                                                             *
+ ******************************************************************************/
+/**
+ * @file number_literal.h
+ * @author Farkašovský Lukáš \<xfarkal00>
+ *
+ * @brief Hlavičkový soubor pro převod číselných literálů.
+ * @details Převádí číselné literály přijaté scannerem na hodnoty typu `i32`
+ *          a `f64` a hodnoty `f64` zpět na hexadecimální zápis pro cílový kód.
+ *          Desetinná čísla s nejvýše 19 platnými číslicemi a malým exponentem
+ *          se převádí přesně jediným násobením nebo dělením mocninou deseti
+ *          (Clingerova rychlá cesta), ostatní převede funkce `strtod`.
+ */
+
+#ifndef NUMBER_LITERAL_H_
+/** @cond  */
+#define NUMBER_LITERAL_H_
+/** @endcond  */
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                             DEKLARACE KONSTANT                              *
+ *                                                                             *
+ ******************************************************************************/
+
+#define NUMBER_MAX_FAST_DIGITS 19       /**< Nejvíce platných číslic v 64bitové mantise      */
+#define NUMBER_MAX_FAST_EXPONENT 22     /**< Nejvyšší přesně reprezentovatelná mocnina deseti */
+#define NUMBER_MAX_EXACT_MANTISSA (UINT64_C(1) << 53)   /**< Mez přesně reprezentovatelné mantisy */
+#define NUMBER_HEX_FLOAT_SIZE 32        /**< Velikost bufferu pro hexadecimální zápis `f64`  */
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                         DEKLARACE VEŘEJNÝCH FUNKCÍ                          *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Převede celočíselný literál na hodnotu.
+ *
+ * @details Literál musí tvořit pouze dekadické číslice. Při přetečení je
+ *          výsledkem @c INT64_MAX, což volající rozpozná jako hodnotu mimo
+ *          rozsah typu `i32`.
+ *
+ * @param [in] str Ukazatel na literál
+ * @param [in] length Délka literálu
+ * @param [out] value Převedená hodnota
+ *
+ * @return `true`, pokud je literál platný, jinak `false`.
+ */
+bool numberLiteral_parseInt(const char *str, size_t length, int64_t *value);
+
+/**
+ * @brief Převede desetinný literál na hodnotu.
+ *
+ * @details Literál má tvar `číslice [. číslice] [e|E [+|-] číslice]`.
+ *          Výsledek je vždy správně zaokrouhlený, stejně jako u `strtod`.
+ *
+ * @param [in] str Ukazatel na literál ukončený nulovým znakem
+ * @param [in] length Délka literálu
+ * @param [out] value Převedená hodnota
+ *
+ * @return `true`, pokud je literál platný, jinak `false`.
+ */
+bool numberLiteral_parseFloat(const char *str, size_t length, double *value);
+
+/**
+ * @brief Zapíše hodnotu `f64` v hexadecimálním zápisu.
+ *
+ * @details Výstup je shodný s formátem `%a` standardní knihovny glibc
+ *          (např. `0x1.8p+1` pro hodnotu `3.0`).
+ *
+ * @param [in] value Zapisovaná hodnota
+ * @param [out] buffer Buffer o velikosti alespoň @c NUMBER_HEX_FLOAT_SIZE
+ *
+ * @return Počet zapsaných znaků (bez ukončovacího nulového znaku).
+ */
+size_t numberLiteral_formatHexFloat(double value, char *buffer);
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                         DEKLARACE INTERNÍCH FUNKCÍ                          *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Pokusí se převést desetinný literál rychlou cestou.
+ *
+ * @param [in] str Ukazatel na literál
+ * @param [in] length Délka literálu
+ * @param [out] value Převedená hodnota
+ *
+ * @return `true`, pokud byl literál převeden přesně, jinak `false`.
+ */
+bool numberLiteral_parseFloatFast(const char *str, size_t length, double *value);
+
+/**
+ * @brief Zapíše dekadický exponent hexadecimálního zápisu včetně znaménka.
+ *
+ * @param [in] exponent Zapisovaný exponent
+ * @param [out] buffer Ukazatel na místo zápisu
+ *
+ * @return Počet zapsaných znaků.
+ */
+size_t numberLiteral_formatExponent(int exponent, char *buffer);
+
+#endif // NUMBER_LITERAL_H_
+
+/*** Konec souboru number_literal.h ***/
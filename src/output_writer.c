@@ -0,0 +1,249 @@
+/*******************************************************************************
+ *                                                                             *
+ * Název projektu:   Implementace překladače imperativního jazyka IFJ24        *
+ *                                                                             *
+ * Soubor:           output_writer.c                                           *
+ * Autor:            Farkašovský Lukáš  <xfarkal00>                            *
+ *                                                                             *
+ * Datum:            04.12.2024                                                *
+ * Poslední změna:   04.12.2024                                                *
+ *                                                                             *
+ * Tým:      Tým xkalinj00                                                     *
+ * Členové:  Farkašovský Lukáš    <xfarkal00>                                  *
+ *           Hýža Pavel           <xhyzapa00>                                  *
+ *           Kalina Jan           <xkalinj00>                                  *
+ *           Krejčí David         <xkrejcd00>                                  *
+ *                                                                             *
+ ******************************************************************************/
+/**
+ * @file output_writer.c
+ * @author Farkašovský Lukáš \<xfarkal00>
+ *
+ * @brief Implementace asynchronního výpisu cílového kódu.
+ * @details Generátor zapisuje přes `fprintf()` do proudu vytvořeného funkcí
+ *          `fopencookie()`, jehož funkce zápisu kopíruje data do aktuálního
+ *          bloku. Předání bloku vláknu výpisu je chráněno mutexem, vlákno
+ *          samotné vypisuje blok bez zámku.
+ */
+
+// Kvůli funkci fopencookie()
+#define _GNU_SOURCE
+
+#include <string.h>
+#include <pthread.h>
+
+// Import knihoven překladače
+#include "output_writer.h"
+#include "tac_generator.h"
+#include "settings.h"
+
+
+/**
+ * @brief Stav asynchronního výpisu.
+ */
+typedef struct OutputWriter {
+    bool running;                   /**< Vlákno výpisu běží                         */
+    FILE *stream;                   /**< Proud, do kterého zapisuje generátor       */
+    FILE *target;                   /**< Proud, do kterého zapisuje vlákno výpisu   */
+    char *chunks[OUTPUT_WRITER_CHUNK_COUNT];    /**< Bloky výstupu                  */
+    size_t lengths[OUTPUT_WRITER_CHUNK_COUNT];  /**< Zaplněná délka bloků           */
+    size_t filling;                 /**< Index bloku, do kterého zapisuje generátor */
+    size_t written;                 /**< Index bloku předaného vláknu výpisu        */
+    bool pending;                   /**< Vlákno výpisu má předaný blok k výpisu     */
+    bool finish;                    /**< Generátor už žádný další blok nepředá      */
+    bool failed;                    /**< Některý zápis do cílového proudu selhal    */
+    pthread_t thread;               /**< Vlákno výpisu                              */
+    pthread_mutex_t mutex;          /**< Zámek předávání bloků                      */
+    pthread_cond_t changed;         /**< Změna předaného bloku nebo ukončení        */
+} OutputWriter;
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                       INICIALIZACE GLOBÁLNÍCH PROMĚNNÝCH                    *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Globální stav asynchronního výpisu.
+ */
+static OutputWriter outputWriter;
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                        IMPLEMENTACE VEŘEJNÝCH FUNKCÍ                        *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Spustí vlákno výpisu, pokud je asynchronní výstup zapnut.
+ */
+void outputWriter_init(const char *setting, FILE *target) {
+    outputWriter_finish();
+
+    if(!settings_isEnabled(setting) || target == NULL) {
+        return;
+    }
+
+    outputWriter.chunks[0] = malloc(OUTPUT_WRITER_CHUNK_SIZE);
+    outputWriter.chunks[1] = malloc(OUTPUT_WRITER_CHUNK_SIZE);
+    cookie_io_functions_t functions = { NULL, outputWriter_write, NULL, NULL };
+    outputWriter.stream = fopencookie(NULL, "w", functions);
+
+    if(outputWriter.chunks[0] == NULL || outputWriter.chunks[1] == NULL ||
+       outputWriter.stream == NULL)
+    {
+        if(outputWriter.stream != NULL) {
+            fclose(outputWriter.stream);
+        }
+        free(outputWriter.chunks[0]);
+        free(outputWriter.chunks[1]);
+        return;
+    }
+
+    outputWriter.target = target;
+    outputWriter.lengths[0] = 0;
+    outputWriter.lengths[1] = 0;
+    outputWriter.filling = 0;
+    outputWriter.written = 0;
+    outputWriter.pending = false;
+    outputWriter.finish = false;
+    outputWriter.failed = false;
+    pthread_mutex_init(&outputWriter.mutex, NULL);
+    pthread_cond_init(&outputWriter.changed, NULL);
+
+    if(pthread_create(&outputWriter.thread, NULL, outputWriter_worker, NULL) != 0) {
+        fclose(outputWriter.stream);
+        free(outputWriter.chunks[0]);
+        free(outputWriter.chunks[1]);
+        pthread_mutex_destroy(&outputWriter.mutex);
+        pthread_cond_destroy(&outputWriter.changed);
+        return;
+    }
+
+    outputWriter.running = true;
+    TAC_output = outputWriter.stream;
+}  // outputWriter_init()
+
+/**
+ * @brief Předá vláknu výpisu zbylá data, počká na jejich výpis a vlákno ukončí.
+ */
+bool outputWriter_finish() {
+    if(!outputWriter.running) {
+        return true;
+    }
+
+    // Zavřením proudu se do bloku zapíše i obsah bufferu proudu
+    TAC_output = NULL;
+    fclose(outputWriter.stream);
+    if(outputWriter.lengths[outputWriter.filling] > 0) {
+        outputWriter_handOff();
+    }
+
+    pthread_mutex_lock(&outputWriter.mutex);
+    outputWriter.finish = true;
+    pthread_cond_broadcast(&outputWriter.changed);
+    pthread_mutex_unlock(&outputWriter.mutex);
+    pthread_join(outputWriter.thread, NULL);
+
+    free(outputWriter.chunks[0]);
+    free(outputWriter.chunks[1]);
+    pthread_mutex_destroy(&outputWriter.mutex);
+    pthread_cond_destroy(&outputWriter.changed);
+    outputWriter.running = false;
+
+    return !outputWriter.failed;
+}  // outputWriter_finish()
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                        IMPLEMENTACE INTERNÍCH FUNKCÍ                        *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Zapíše data z proudu generátoru do bloku výstupu.
+ */
+ssize_t outputWriter_write(void *cookie, const char *data, size_t size) {
+    (void)cookie;
+
+    size_t remaining = size;
+    while(remaining > 0) {
+        size_t *length = &outputWriter.lengths[outputWriter.filling];
+        size_t count = OUTPUT_WRITER_CHUNK_SIZE - *length;
+        if(count > remaining) {
+            count = remaining;
+        }
+
+        memcpy(outputWriter.chunks[outputWriter.filling] + *length, data, count);
+        *length += count;
+        data += count;
+        remaining -= count;
+
+        // Plný blok předáme vláknu výpisu a pokračujeme do druhého bloku
+        if(*length == OUTPUT_WRITER_CHUNK_SIZE) {
+            outputWriter_handOff();
+        }
+    }
+
+    return (ssize_t)size;
+}  // outputWriter_write()
+
+/**
+ * @brief Předá rozpracovaný blok vláknu výpisu.
+ */
+void outputWriter_handOff() {
+    pthread_mutex_lock(&outputWriter.mutex);
+
+    // Druhý blok může generátor použít až po jeho výpisu
+    while(outputWriter.pending) {
+        pthread_cond_wait(&outputWriter.changed, &outputWriter.mutex);
+    }
+
+    outputWriter.written = outputWriter.filling;
+    outputWriter.pending = true;
+    outputWriter.filling = (outputWriter.filling + 1) % OUTPUT_WRITER_CHUNK_COUNT;
+    outputWriter.lengths[outputWriter.filling] = 0;
+
+    pthread_cond_broadcast(&outputWriter.changed);
+    pthread_mutex_unlock(&outputWriter.mutex);
+}  // outputWriter_handOff()
+
+/**
+ * @brief Hlavní funkce vlákna výpisu.
+ */
+void *outputWriter_worker(void *argument) {
+    (void)argument;
+
+    pthread_mutex_lock(&outputWriter.mutex);
+    while(true) {
+        while(!outputWriter.pending && !outputWriter.finish) {
+            pthread_cond_wait(&outputWriter.changed, &outputWriter.mutex);
+        }
+        if(!outputWriter.pending) {
+            break;
+        }
+
+        // Blok vypisujeme bez zámku, generátor mezitím plní druhý blok
+        size_t index = outputWriter.written;
+        pthread_mutex_unlock(&outputWriter.mutex);
+        size_t length = outputWriter.lengths[index];
+        bool failed = fwrite(outputWriter.chunks[index], 1, length, outputWriter.target) != length;
+        pthread_mutex_lock(&outputWriter.mutex);
+
+        outputWriter.failed = outputWriter.failed || failed;
+        outputWriter.pending = false;
+        pthread_cond_broadcast(&outputWriter.changed);
+    }
+    pthread_mutex_unlock(&outputWriter.mutex);
+
+    if(fflush(outputWriter.target) != 0) {
+        outputWriter.failed = true;
+    }
+
+    return NULL;
+}  // outputWriter_worker()
+
+/*** Konec souboru output_writer.c ***/
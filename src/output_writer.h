@@ -0,0 +1,121 @@
+/*******************************************************************************
+ *                                                                             *
+ * Název projektu:   Implementace překladače imperativního jazyka IFJ24        *
+ *                                                                             *
+ * Soubor:           output_writer.h                                           *
+ * Autor:            Farkašovský Lukáš  <xfarkal00>                            *
+ *                                                                             *
+ * Datum:            04.12.2024                                                *
+ * Poslední změna:   04.12.2024                                                *
+ *                                                                             *
+ * Tým:      Tým xkalinj00                                                     *
+ * Členové:  Farkašovský Lukáš    <xfarkal00>                                  *
+ *           Hýža Pavel           <xhyzapa00>                                  *
+ *           Kalina Jan           <xkalinj00>                                  *
+ *           Krejčí David         <xkrejcd00>                                  *
+ *                                                                             *
+ ******************************************************************************/
+/**
+ * @file output_writer.h
+ * @author Farkašovský Lukáš \<xfarkal00>
+ *
+ * @brief Hlavičkový soubor pro asynchronní výpis cílového kódu.
+ * @details Pokud je nastavena proměnná prostředí @c OUTPUT_WRITER_ENV (na
+ *          jinou hodnotu než `0`), generátor nezapisuje cílový kód přímo na
+ *          standardní výstup. Kód se skládá do bloků o velikosti
+ *          @c OUTPUT_WRITER_CHUNK_SIZE a plné bloky vypisuje samostatné
+ *          vlákno. Bloky jsou dva: do jednoho zapisuje generátor, druhý
+ *          vypisuje vlákno. Generátor tak čeká jen tehdy, když zaplní blok
+ *          dříve, než vlákno vypíše ten předchozí, a paměť je omezena na dva
+ *          bloky.
+ */
+
+#ifndef OUTPUT_WRITER_H_
+/** @cond  */
+#define OUTPUT_WRITER_H_
+/** @endcond  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <sys/types.h>
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                             DEKLARACE KONSTANT                              *
+ *                                                                             *
+ ******************************************************************************/
+
+#define OUTPUT_WRITER_ENV "IFJ24_ASYNC_OUTPUT"  /**< Proměnná prostředí zapínající vlákno výpisu */
+#define OUTPUT_WRITER_CHUNK_SIZE (1024 * 1024)  /**< Velikost jednoho bloku výstupu v bajtech    */
+#define OUTPUT_WRITER_CHUNK_COUNT 2             /**< Počet bloků výstupu                         */
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                         DEKLARACE VEŘEJNÝCH FUNKCÍ                          *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Spustí vlákno výpisu, pokud je asynchronní výstup zapnut.
+ *
+ * @details Generátor cílového kódu bude v aktuálním vlákně zapisovat do
+ *          proudu, jehož data vypisuje vlákno výpisu do @p target. Pokud se
+ *          proud nebo vlákno nepodaří vytvořit, kód se vypisuje přímo.
+ *
+ * @param [in] setting Hodnota proměnné @c OUTPUT_WRITER_ENV, nebo `NULL`
+ * @param [in] target Proud, do kterého vlákno výpisu zapisuje
+ */
+void outputWriter_init(const char *setting, FILE *target);
+
+/**
+ * @brief Předá vláknu výpisu zbylá data, počká na jejich výpis a vlákno ukončí.
+ *
+ * @details Generátor poté opět zapisuje přímo na standardní výstup. Pokud
+ *          vlákno výpisu neběží, nic neprovádí.
+ *
+ * @return `true`, pokud byla všechna data vypsána, jinak `false`.
+ */
+bool outputWriter_finish();
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                         DEKLARACE INTERNÍCH FUNKCÍ                          *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Zapíše data z proudu generátoru do bloku výstupu.
+ *
+ * @details Funkce zápisu proudu vytvořeného funkcí `fopencookie()`.
+ *
+ * @param [in] cookie Nepoužitý ukazatel proudu
+ * @param [in] data Ukazatel na zapisovaná data
+ * @param [in] size Délka dat
+ *
+ * @return Počet zapsaných bajtů.
+ */
+ssize_t outputWriter_write(void *cookie, const char *data, size_t size);
+
+/**
+ * @brief Předá rozpracovaný blok vláknu výpisu.
+ *
+ * @details Pokud vlákno ještě vypisuje předchozí blok, počká na jeho dokončení.
+ */
+void outputWriter_handOff();
+
+/**
+ * @brief Hlavní funkce vlákna výpisu.
+ *
+ * @param [in] argument Nepoužitý argument vlákna
+ *
+ * @return Vždy `NULL`.
+ */
+void *outputWriter_worker(void *argument);
+
+#endif // OUTPUT_WRITER_H_
+
+/*** Konec souboru output_writer.h ***/
@@ -28,6 +28,7 @@
  */
 
 #include "parser_common.h"
+#include "scanner_pipeline.h"
 
 
 /*******************************************************************************
@@ -39,7 +40,27 @@
 /**
  * @brief Globální proměnná pro aktuální token, který je zpracováván.
  */
-Terminal currentTerminal = { T_UNDEFINED, T_PREC_UNDEFINED, NULL };  // Počíteční inicializace
+Terminal currentTerminal = { T_UNDEFINED, T_PREC_UNDEFINED, NULL, TOKEN_FLAG_NONE };  // Počíteční inicializace
+
+/**
+ * @brief Položka tabulky klasifikace tokenů vygenerovaná ze seznamu.
+ */
+#define PARSER_TOKEN_KIND_ENTRY(token, ll, prec, flags) [token] = { ll, prec, flags },
+
+/**
+ * @brief Tabulka klasifikace tokenů indexovaná typem tokenu.
+ *
+ * @note Index `0` neodpovídá žádnému typu tokenu.
+ */
+const TokenKind parser_tokenKinds[PARSER_TOKEN_KIND_COUNT] = {
+    [0] = { T_UNDEFINED, T_PREC_UNDEFINED, TOKEN_FLAG_NONE },
+    PARSER_TOKEN_KINDS(PARSER_TOKEN_KIND_ENTRY)
+};
+
+// Seznam musí pokrývat všechny typy tokenů (duplicitní položku odhalí překladač)
+#define PARSER_TOKEN_KIND_ONE(token, ll, prec, flags) + 1
+_Static_assert(0 PARSER_TOKEN_KINDS(PARSER_TOKEN_KIND_ONE) == TOKEN_COMMENT,
+               "PARSER_TOKEN_KINDS must list every TokenType");
 
 /**
  * @brief Globální kořen abstraktního syntaktického stromu.
@@ -59,13 +80,14 @@ AST_ProgramNode *ASTroot = NULL;  // Počíteční inicializace
  */
 void parser_getNextToken(bool state) {
     // Statická proměnná pro uchování lookahead terminálu
-    static Terminal lookaheadTerminal = { T_UNDEFINED, T_PREC_UNDEFINED, NULL };
+    static Terminal lookaheadTerminal = { T_UNDEFINED, T_PREC_UNDEFINED, NULL, TOKEN_FLAG_NONE };
 
     // Resetování statické proměnné, kdyby po předchozím běhu zůstala stále v paměti
     if(state == RESET_LOOKAHEAD) {
         lookaheadTerminal.LLterminal = T_UNDEFINED;
         lookaheadTerminal.PrecTerminal = T_PREC_UNDEFINED;
         lookaheadTerminal.value = NULL;
+        lookaheadTerminal.flags = TOKEN_FLAG_NONE;
         return;
     }
 
@@ -101,6 +123,11 @@ bool parser_errorWatcherInternal(ParserErrorState state, const char *file, \
     // Statická proměnná pro zaznamení první chyby
     static ErrorType firstError = SUCCESS;
 
+    // Chyby z vlákna scanneru převezme parser až spolu s příslušným tokenem
+    if(scannerPipeline_deferError(state)) {
+        return false;
+    }
+
     // Většinou jdeo nastavení chybového flagu a první chyby, pokud se o ní jedná
     switch(state) {
         // Resetování statické proměnné, kdyby po předchozím běhu zůstala stále v paměti
@@ -236,22 +263,20 @@ inline void parser_updateFirstError(ParserErrorState state, ErrorType *error) {
  *        terminálu.
  */
 Terminal parser_pokeScanner() {
-    // Počáteční inicializace mapovaných hodnot a návratové struktury funkce
-    LLTerminals llType = T_UNDEFINED;
-    PrecTerminals precType = T_PREC_UNDEFINED;
-    Terminal terminal = { T_UNDEFINED, T_PREC_UNDEFINED, NULL };
+    // Požádáme scanner o další token (při teplé cache jej přečteme ze souboru)
+    Token receivedToken = tokenCache_getNextToken();
 
-    // Požádáme scanner o další token
-    Token receivedToken = scanner_getNextToken();
+    // Token započítáme do hashe právě parsované funkce pro inkrementální překlad
+    incremental_observeToken(receivedToken);
 
-    // Namapujeme typ tokenu na příslušný tym LL a precedenčního terminálu
-    parser_mapTokenToLLTerminal(receivedToken.type, &llType);
-    parser_mapTokenToPrecTerminal(receivedToken.type, &precType);
+    // Typ tokenu klasifikujeme jediným vyhledáním v tabulce
+    TokenKind kind = parser_tokenKinds[0];
+    if(receivedToken.type > 0 && (size_t)receivedToken.type < PARSER_TOKEN_KIND_COUNT) {
+        kind = parser_tokenKinds[receivedToken.type];
+    }
 
     // Inicializujeme návratovou hodnotu obdrženými hodnotami
-    terminal.LLterminal = llType;
-    terminal.PrecTerminal = precType;
-    terminal.value = receivedToken.value;  // jako value se využije přímo value Tokenu
+    Terminal terminal = { kind.LLterminal, kind.PrecTerminal, receivedToken.value, kind.flags };
 
     return terminal;
 } // parser_pokeScanner()
@@ -263,296 +288,6 @@ Terminal parser_pokeScanner() {
  *                                                                             *
  ******************************************************************************/
 
-/**
- * @brief Namapuje typ tokenu na typ LL terminálu.
- */
-void parser_mapTokenToLLTerminal(TokenType tokenType, LLTerminals *terminalType) {
-    // Ověření platnosti předaného ukazatele
-    if(terminalType == NULL) {
-        parser_errorWatcher(SET_ERROR_INTERNAL);
-    }
-
-    // Mapujeme typ Tokenu na typ LL Terminálu
-    switch(tokenType) {
-        // Mapování: TOKEN_IDENTIFIER -> T_ID
-        case TOKEN_IDENTIFIER:
-            *terminalType = T_ID;
-            break;
-
-        // Mapování: TOKEN_K_import -> T_IMPORT
-        case TOKEN_K_import:
-            *terminalType = T_IMPORT;
-            break;
-
-        // Mapování: TOKEN_K_ifj -> T_IFJ
-        case TOKEN_K_ifj:
-            *terminalType = T_IFJ;
-            break;
-
-        // Mapování: TOKEN_K_pub -> T_PUB
-        case TOKEN_K_pub:
-            *terminalType = T_PUB;
-            break;
-
-        // Mapování: TOKEN_K_fn -> T_FN
-        case TOKEN_K_fn:
-            *terminalType = T_FN;
-            break;
-
-        // Mapování: TOKEN_K_const -> T_CONST
-        case TOKEN_K_const:
-            *terminalType = T_CONST;
-            break;
-
-        // Mapování: TOKEN_K_var -> T_VAR
-        case TOKEN_K_var:
-            *terminalType = T_VAR;
-            break;
-
-        // Mapování: TOKEN_K_if -> T_IF
-        case TOKEN_K_if:
-            *terminalType = T_IF;
-            break;
-
-        // Mapování: TOKEN_K_else -> T_ELSE
-        case TOKEN_K_else:
-            *terminalType = T_ELSE;
-            break;
-
-        // Mapování: TOKEN_K_while -> T_WHILE
-        case TOKEN_K_while:
-            *terminalType = T_WHILE;
-            break;
-
-        // Mapování: TOKEN_K_return -> T_RETURN
-        case TOKEN_K_return:
-            *terminalType = T_RETURN;
-            break;
-
-        // Mapování: TOKEN_EQUALITY_SIGN -> T_ASSIGNMENT
-        case TOKEN_EQUALITY_SIGN:
-            *terminalType = T_ASSIGNMENT;
-            break;
-
-        // Mapování: TOKEN_K_i32 -> T_INT
-        case TOKEN_K_i32:
-            *terminalType = T_INT;
-            break;
-
-        // Mapování: TOKEN_K_Qi32 -> T_INT_OR_NULL
-        case TOKEN_K_Qi32:
-            *terminalType = T_INT_OR_NULL;
-            break;
-
-        // Mapování: TOKEN_K_f64 -> T_FLOAT
-        case TOKEN_K_f64:
-            *terminalType = T_FLOAT;
-            break;
-
-        // Mapování: TOKEN_K_Qf64 -> T_FLOAT_OR_NULL
-        case TOKEN_K_Qf64:
-            *terminalType = T_FLOAT_OR_NULL;
-            break;
-
-        // Mapování: TOKEN_K_u8 -> T_STRING
-        case TOKEN_K_u8:
-            *terminalType = T_STRING;
-            break;
-
-        // Mapování: TOKEN_K_Qu8 -> T_STRING_OR_NULL
-        case TOKEN_K_Qu8:
-            *terminalType = T_STRING_OR_NULL;
-            break;
-
-        // Mapování: TOKEN_K_void -> T_VOID
-        case TOKEN_K_void:
-            *terminalType = T_VOID;
-            break;
-
-        // Mapování: TOKEN_K_underscore -> T_DUMP
-        case TOKEN_K_underscore:
-            *terminalType = T_DUMP;
-            break;
-
-        // Mapování: TOKEN_PERIOD -> T_DOT
-        case TOKEN_PERIOD:
-            *terminalType = T_DOT;
-            break;
-
-        // Mapování: TOKEN_COMMA -> T_COMMA
-        case TOKEN_COMMA:
-            *terminalType = T_COMMA;
-            break;
-
-        // Mapování: TOKEN_COLON -> T_COLON
-        case TOKEN_COLON:
-            *terminalType = T_COLON;
-            break;
-
-        // Mapování: TOKEN_SEMICOLON -> T_SEMICOLON
-        case TOKEN_SEMICOLON:
-            *terminalType = T_SEMICOLON;
-            break;
-
-        // Mapování: TOKEN_VERTICAL_BAR -> T_PIPE
-        case TOKEN_VERTICAL_BAR:
-            *terminalType = T_PIPE;
-            break;
-
-        // Mapování: TOKEN_LEFT_PARENTHESIS -> T_LEFT_BRACKET
-        case TOKEN_LEFT_PARENTHESIS:
-            *terminalType = T_LEFT_BRACKET;
-            break;
-
-        // Mapování: TOKEN_RIGHT_PARENTHESIS -> T_RIGHT_BRACKET
-        case TOKEN_RIGHT_PARENTHESIS:
-            *terminalType = T_RIGHT_BRACKET;
-            break;
-
-        // Mapování: TOKEN_LEFT_CURLY_BRACKET -> T_LEFT_CURLY_BRACKET
-        case TOKEN_LEFT_CURLY_BRACKET:
-            *terminalType = T_LEFT_CURLY_BRACKET;
-            break;
-
-        // Mapování: TOKEN_RIGHT_CURLY_BRACKET -> T_RIGHT_CURLY_BRACKET
-        case TOKEN_RIGHT_CURLY_BRACKET:
-            *terminalType = T_RIGHT_CURLY_BRACKET;
-            break;
-
-        // Mapování: TOKEN_EOF -> T_EOF
-        case TOKEN_EOF:
-            *terminalType = T_EOF;
-            break;
-
-        // Pro jakýkoliv jiný typ tokenu není LL terminál definován
-        default:
-            *terminalType = T_UNDEFINED;  // Korektní, neznačí syntaktickou chybu
-            break;
-    } // switch()
-} // parser_mapTokenToLLTerminal()
-
-/**
- * @brief Namapuje typ tokenu na typ precedenčního terminálu.
- */
-void parser_mapTokenToPrecTerminal(TokenType tokenType, PrecTerminals *terminal) {
-    // Ověření platnosti předaného ukazatele
-    if(terminal == NULL) {
-        parser_errorWatcher(SET_ERROR_INTERNAL);
-    }
-
-    switch(tokenType) {
-        // Mapování: TOKEN_IDENTIFIER -> T_PREC_ID
-        case TOKEN_IDENTIFIER:
-            *terminal = T_PREC_ID;
-            break;
-
-        // Mapování: TOKEN_INT -> T_PREC_INT_LITERAL
-        case TOKEN_INT:
-            *terminal = T_PREC_INT_LITERAL;
-            break;
-
-        // Mapování: TOKEN_FLOAT -> T_PREC_FLOAT_LITERAL
-        case TOKEN_FLOAT:
-            *terminal = T_PREC_FLOAT_LITERAL;
-            break;
-
-        // Mapování: TOKEN_STRING -> T_PREC_STRING_LITERAL
-        case TOKEN_STRING:
-            *terminal = T_PREC_STRING_LITERAL;
-            break;
-
-        // Mapování: TOKEN_K_null -> T_PREC_NULL_LITERAL
-        case TOKEN_K_null:
-            *terminal = T_PREC_NULL_LITERAL;
-            break;
-
-        // Mapování: TOKEN_K_ifj -> T_PREC_IFJ
-        case TOKEN_K_ifj:
-            *terminal = T_PREC_IFJ;
-            break;
-
-        // Mapování: TOKEN_PERIOD -> T_PREC_DOT
-        case TOKEN_PERIOD:
-            *terminal = T_PREC_DOT;
-            break;
-
-        // Mapování: TOKEN_LEFT_PARENTHESIS -> T_PREC_LEFT_BRACKET
-        case TOKEN_LEFT_PARENTHESIS:
-            *terminal = T_PREC_LEFT_BRACKET;
-            break;
-
-        // Mapování: TOKEN_RIGHT_PARENTHESIS -> T_PREC_RIGHT_BRACKET nebo T_PREC_DOLLAR
-        case TOKEN_RIGHT_PARENTHESIS:
-            *terminal = T_PREC_RIGHT_BRACKET;
-            break;
-
-        // Mapování: TOKEN_PLUS -> T_PREC_PLUS
-        case TOKEN_PLUS:
-            *terminal = T_PREC_PLUS;
-            break;
-
-        // Mapování: TOKEN_MINUS -> T_PREC_MINUS
-        case TOKEN_MINUS:
-            *terminal = T_PREC_MINUS;
-            break;
-
-        // Mapování: TOKEN_ASTERISK -> T_PREC_MULTIPLICATION
-        case TOKEN_ASTERISK:
-            *terminal = T_PREC_MULTIPLICATION;
-            break;
-
-        // Mapování: TOKEN_SLASH -> T_PREC_DIVISION
-        case TOKEN_SLASH:
-            *terminal = T_PREC_DIVISION;
-            break;
-
-        // Mapování: TOKEN_EQUAL_TO -> T_PREC_IDENTITY
-        case TOKEN_EQUAL_TO:
-            *terminal = T_PREC_IDENTITY;
-            break;
-
-        // Mapování: TOKEN_NOT_EQUAL_TO -> T_PREC_NOT_EQUAL
-        case TOKEN_NOT_EQUAL_TO:
-            *terminal = T_PREC_NOT_EQUAL;
-            break;
-
-        // Mapování: TOKEN_LESS_THAN -> T_PREC_LESS_THAN
-        case TOKEN_LESS_THAN:
-            *terminal = T_PREC_LESS_THAN;
-            break;
-
-        // Mapování: TOKEN_GREATER_THAN -> T_PREC_GREATER_THAN
-        case TOKEN_GREATER_THAN:
-            *terminal = T_PREC_GREATER_THAN;
-            break;
-
-        // Mapování: TOKEN_LESS_EQUAL_THAN -> T_PREC_LESS_THAN_OR_EQUAL
-        case TOKEN_LESS_EQUAL_THAN:
-            *terminal = T_PREC_LESS_THAN_OR_EQUAL;
-            break;
-
-        // Mapování: TOKEN_GREATER_EQUAL_THAN -> T_PREC_GREATER_THAN_OR_EQUAL
-        case TOKEN_GREATER_EQUAL_THAN:
-            *terminal = T_PREC_GREATER_THAN_OR_EQUAL;
-            break;
-
-        // Mapování: TOKEN_COMMA -> T_PREC_COMMA nebo T_PREC_DOLLAR
-        case TOKEN_COMMA:
-            *terminal = T_PREC_COMMA;
-            break;
-
-        // Mapování: TOKEN_SEMICOLON -> T_PREC_DOLLAR
-        case TOKEN_SEMICOLON:
-            *terminal = T_PREC_DOLLAR;
-            break;
-
-        // Pro jakýkoliv jiný typ tokenu není LL terminál definován
-        default:
-            *terminal = T_PREC_UNDEFINED;  // Korektní, neznačí syntaktickou chybu
-            break;
-    } // switch()
-} // parser_mapTokenToPrecTerminal()
-
 /**
  * @brief Namapuje typ datového typu AST na typ návratového typu tabulky symbolů.
  */
@@ -43,6 +43,8 @@
 
 // Import modulu: Scanner
 #include "scanner.h"
+#include "token_cache.h"
+#include "incremental.h"
 
 // Import modulu: Abstraktní syntaktický strom (AST)
 #include "ast_nodes.h"
@@ -70,6 +72,9 @@
 // Cover konstanta pro návratovou hodnotu NULL ve významu chyby
 #define PARSING_ERROR   NULL        /**<  Návratovvá hodnota NULL označující, že nastala chyba při parsování.  */
 
+// Velikost tabulky klasifikace tokenů (indexováno typem tokenu)
+#define PARSER_TOKEN_KIND_COUNT (TOKEN_COMMENT + 1)  /**<  Počet položek tabulky @c parser_tokenKinds.  */
+
 
 /*******************************************************************************
  *                                                                             *
@@ -122,6 +127,65 @@
             } while(false)
     #endif
 
+/**
+ * @brief Seznam klasifikace všech typů tokenů pro LL i precedenční parser.
+ *
+ * @details Každá položka `X(token, LL terminál, precedenční terminál, příznaky)`
+ *          popisuje jeden typ tokenu. Ze seznamu se při překladu generuje
+ *          tabulka @c parser_tokenKinds, takže mapování tokenů na oba druhy
+ *          terminálů je na jediném místě. Seznam musí obsahovat všechny typy
+ *          tokenů, což ověřuje statická aserce v souboru parser_common.c.
+ *
+ * @param X Makro aplikované na každou položku seznamu.
+ */
+#define PARSER_TOKEN_KINDS(X) \
+    X(TOKEN_IDENTIFIER,          T_ID,                  T_PREC_ID,                    TOKEN_FLAG_STARTS_EXPRESSION) \
+    X(TOKEN_INT,                 T_UNDEFINED,           T_PREC_INT_LITERAL,           TOKEN_FLAG_STARTS_EXPRESSION) \
+    X(TOKEN_FLOAT,               T_UNDEFINED,           T_PREC_FLOAT_LITERAL,         TOKEN_FLAG_STARTS_EXPRESSION) \
+    X(TOKEN_STRING,              T_UNDEFINED,           T_PREC_STRING_LITERAL,        TOKEN_FLAG_STARTS_EXPRESSION) \
+    X(TOKEN_LEFT_PARENTHESIS,    T_LEFT_BRACKET,        T_PREC_LEFT_BRACKET,          TOKEN_FLAG_STARTS_EXPRESSION) \
+    X(TOKEN_RIGHT_PARENTHESIS,   T_RIGHT_BRACKET,       T_PREC_RIGHT_BRACKET,         TOKEN_FLAG_NONE) \
+    X(TOKEN_ASTERISK,            T_UNDEFINED,           T_PREC_MULTIPLICATION,        TOKEN_FLAG_BINARY_OPERATOR) \
+    X(TOKEN_PLUS,                T_UNDEFINED,           T_PREC_PLUS,                  TOKEN_FLAG_BINARY_OPERATOR) \
+    X(TOKEN_COMMA,               T_COMMA,               T_PREC_COMMA,                 TOKEN_FLAG_NONE) \
+    X(TOKEN_MINUS,               T_UNDEFINED,           T_PREC_MINUS,                 TOKEN_FLAG_BINARY_OPERATOR) \
+    X(TOKEN_COLON,               T_COLON,               T_PREC_UNDEFINED,             TOKEN_FLAG_NONE) \
+    X(TOKEN_SEMICOLON,           T_SEMICOLON,           T_PREC_DOLLAR,                TOKEN_FLAG_NONE) \
+    X(TOKEN_LEFT_CURLY_BRACKET,  T_LEFT_CURLY_BRACKET,  T_PREC_UNDEFINED,             TOKEN_FLAG_NONE) \
+    X(TOKEN_VERTICAL_BAR,        T_PIPE,                T_PREC_UNDEFINED,             TOKEN_FLAG_NONE) \
+    X(TOKEN_RIGHT_CURLY_BRACKET, T_RIGHT_CURLY_BRACKET, T_PREC_UNDEFINED,             TOKEN_FLAG_NONE) \
+    X(TOKEN_PERIOD,              T_DOT,                 T_PREC_DOT,                   TOKEN_FLAG_NONE) \
+    X(TOKEN_EQUALITY_SIGN,       T_ASSIGNMENT,          T_PREC_UNDEFINED,             TOKEN_FLAG_NONE) \
+    X(TOKEN_SLASH,               T_UNDEFINED,           T_PREC_DIVISION,              TOKEN_FLAG_BINARY_OPERATOR) \
+    X(TOKEN_EQUAL_TO,            T_UNDEFINED,           T_PREC_IDENTITY,              TOKEN_FLAG_BINARY_OPERATOR) \
+    X(TOKEN_NOT_EQUAL_TO,        T_UNDEFINED,           T_PREC_NOT_EQUAL,             TOKEN_FLAG_BINARY_OPERATOR) \
+    X(TOKEN_LESS_THAN,           T_UNDEFINED,           T_PREC_LESS_THAN,             TOKEN_FLAG_BINARY_OPERATOR) \
+    X(TOKEN_LESS_EQUAL_THAN,     T_UNDEFINED,           T_PREC_LESS_THAN_OR_EQUAL,    TOKEN_FLAG_BINARY_OPERATOR) \
+    X(TOKEN_GREATER_THAN,        T_UNDEFINED,           T_PREC_GREATER_THAN,          TOKEN_FLAG_BINARY_OPERATOR) \
+    X(TOKEN_GREATER_EQUAL_THAN,  T_UNDEFINED,           T_PREC_GREATER_THAN_OR_EQUAL, TOKEN_FLAG_BINARY_OPERATOR) \
+    X(TOKEN_EOF,                 T_EOF,                 T_PREC_UNDEFINED,             TOKEN_FLAG_NONE) \
+    X(TOKEN_K_const,             T_CONST,               T_PREC_UNDEFINED,             TOKEN_FLAG_KEYWORD) \
+    X(TOKEN_K_var,               T_VAR,                 T_PREC_UNDEFINED,             TOKEN_FLAG_KEYWORD) \
+    X(TOKEN_K_i32,               T_INT,                 T_PREC_UNDEFINED,             TOKEN_FLAG_KEYWORD) \
+    X(TOKEN_K_f64,               T_FLOAT,               T_PREC_UNDEFINED,             TOKEN_FLAG_KEYWORD) \
+    X(TOKEN_K_u8,                T_STRING,              T_PREC_UNDEFINED,             TOKEN_FLAG_KEYWORD) \
+    X(TOKEN_K_Qi32,              T_INT_OR_NULL,         T_PREC_UNDEFINED,             TOKEN_FLAG_KEYWORD) \
+    X(TOKEN_K_Qf64,              T_FLOAT_OR_NULL,       T_PREC_UNDEFINED,             TOKEN_FLAG_KEYWORD) \
+    X(TOKEN_K_Qu8,               T_STRING_OR_NULL,      T_PREC_UNDEFINED,             TOKEN_FLAG_KEYWORD) \
+    X(TOKEN_K_pub,               T_PUB,                 T_PREC_UNDEFINED,             TOKEN_FLAG_KEYWORD) \
+    X(TOKEN_K_fn,                T_FN,                  T_PREC_UNDEFINED,             TOKEN_FLAG_KEYWORD) \
+    X(TOKEN_K_void,              T_VOID,                T_PREC_UNDEFINED,             TOKEN_FLAG_KEYWORD) \
+    X(TOKEN_K_return,            T_RETURN,              T_PREC_UNDEFINED,             TOKEN_FLAG_KEYWORD) \
+    X(TOKEN_K_null,              T_UNDEFINED,           T_PREC_NULL_LITERAL,          TOKEN_FLAG_KEYWORD | TOKEN_FLAG_STARTS_EXPRESSION) \
+    X(TOKEN_K_if,                T_IF,                  T_PREC_UNDEFINED,             TOKEN_FLAG_KEYWORD) \
+    X(TOKEN_K_else,              T_ELSE,                T_PREC_UNDEFINED,             TOKEN_FLAG_KEYWORD) \
+    X(TOKEN_K_while,             T_WHILE,               T_PREC_UNDEFINED,             TOKEN_FLAG_KEYWORD) \
+    X(TOKEN_K_import,            T_IMPORT,              T_PREC_UNDEFINED,             TOKEN_FLAG_KEYWORD) \
+    X(TOKEN_K_underscore,        T_DUMP,                T_PREC_UNDEFINED,             TOKEN_FLAG_KEYWORD) \
+    X(TOKEN_K_ifj,               T_IFJ,                 T_PREC_IFJ,                   TOKEN_FLAG_KEYWORD | TOKEN_FLAG_STARTS_EXPRESSION) \
+    X(TOKEN_UNINITIALIZED,       T_UNDEFINED,           T_PREC_UNDEFINED,             TOKEN_FLAG_NONE) \
+    X(TOKEN_COMMENT,             T_UNDEFINED,           T_PREC_UNDEFINED,             TOKEN_FLAG_NONE)
+
 /*******************************************************************************
  *                                                                             *
  *                             VÝČTOVÉ DATOVÉ TYPY                             *
@@ -147,6 +211,16 @@ typedef enum ParserErrorState {
     CALL_ERROR_HANDLE               = 8,    /**< Zavolá funkci pro řízení chybových stavů `error_handle()` */
 } ParserErrorState;
 
+/**
+ * @brief Příznaky typu tokenu z tabulky @c parser_tokenKinds.
+ */
+typedef enum TokenFlags {
+    TOKEN_FLAG_NONE              = 0,       /**< Token nemá žádný příznak. */
+    TOKEN_FLAG_STARTS_EXPRESSION = 1,       /**< Tokenem může začínat výraz (operand nebo levá závorka). */
+    TOKEN_FLAG_BINARY_OPERATOR   = 2,       /**< Token je binárním operátorem výrazu. */
+    TOKEN_FLAG_KEYWORD           = 4,       /**< Token je klíčovým slovem. */
+} TokenFlags;
+
 
 /*******************************************************************************
  *                                                                             *
@@ -166,8 +240,21 @@ typedef struct Terminal {
     LLTerminals   LLterminal;       /**< Typ LL terminálu pro LL parser. */
     PrecTerminals PrecTerminal;     /**< Typ precedenčního terminálu pro precedenční parser. */
     DString       *value;           /**< Hodnota aktuálního tokenu jako dynamický řetězec `DString`. */
+    unsigned      flags;            /**< Příznaky typu tokenu (kombinace @c TokenFlags). */
 } Terminal;
 
+/**
+ * @brief Klasifikace jednoho typu tokenu.
+ *
+ * @details Položka tabulky @c parser_tokenKinds, ze které parser při převzetí
+ *          tokenu vyplní strukturu @c Terminal.
+ */
+typedef struct TokenKind {
+    LLTerminals   LLterminal;       /**< Typ LL terminálu. */
+    PrecTerminals PrecTerminal;     /**< Typ precedenčního terminálu. */
+    unsigned      flags;            /**< Příznaky typu tokenu (kombinace @c TokenFlags). */
+} TokenKind;
+
 
 /*******************************************************************************
  *                                                                             *
@@ -186,6 +273,15 @@ typedef struct Terminal {
  */
 extern Terminal currentTerminal;
 
+/**
+ * @brief Tabulka klasifikace tokenů indexovaná typem tokenu.
+ *
+ * @details Tabulka je generována ze seznamu @c PARSER_TOKEN_KINDS. Typy,
+ *          které nejsou terminálem LL, resp. precedenčního parseru, mají
+ *          hodnotu @c T_UNDEFINED, resp. @c T_PREC_UNDEFINED.
+ */
+extern const TokenKind parser_tokenKinds[PARSER_TOKEN_KIND_COUNT];
+
 /**
  * @brief Globální kořen abstraktního syntaktického stromu.
  *
@@ -332,32 +428,6 @@ Terminal parser_pokeScanner();
  *                                                                             *
  ******************************************************************************/
 
-/**
- * @brief Namapuje typ tokenu na typ LL terminálu.
- *
- * @details Funkce @c parser_mapTokenToLLTerminal() převede typ tokenu získaného
- *          ze scanneru na odpovídající typ LL terminálu, který je použit v
- *          LL parseru. Pokud je ukazatel @c terminalType @c NULL.
- *
- * @param [in] tokenType Typ tokenu získaný ze scanneru (`TokenType`).
- * @param [out] terminalType Ukazatel na proměnnou typu @c LLTerminals,
- *                           kam bude uložen výsledek.
- */
-void parser_mapTokenToLLTerminal(TokenType tokenType, LLTerminals *terminalType);
-
-/**
- * @brief Namapuje typ tokenu na typ precedenčního terminálu.
- *
- * @details Funkce @c parser_mapTokenToPrecTerminal() převede typ tokenu na typ
- *          precedenčního terminálu pro použití v precedenčním parseru.
- *          Pokud je ukazatel @c terminalType @c NULL.
- *
- * @param [in] tokenType Typ tokenu získaný ze scanneru (`TokenType`).
- * @param [out] terminalType Ukazatel na proměnnou typu @c PrecTerminals,
- *                           kam bude uložen výsledek.
- */
-void parser_mapTokenToPrecTerminal(TokenType tokenType, PrecTerminals *terminalType);
-
 /**
  * @brief Namapuje typ datového typu AST na typ návratového typu tabulky symbolů.
  *
@@ -0,0 +1,484 @@
+/*******************************************************************************
+ *                                                                             *
+ * Název projektu:   Implementace překladače imperativního jazyka IFJ24        *
+ *                                                                             *
+ * Soubor:           pratt_parser.c                                            *
+ * Autor:            Jan Kalina   <xkalinj00>                                  *
+ *                                                                             *
+ * Datum:            04.12.2024                                                *
+ * Poslední změna:   04.12.2024                                                *
+ *                                                                             *
+ * Tým:      Tým xkalinj00                                                     *
+ * Členové:  Farkašovský Lukáš    <xfarkal00>                                  *
+ *           Hýža Pavel           <xhyzapa00>                                  *
+ *           Kalina Jan           <xkalinj00>                                  *
+ *           Krejčí David         <xkrejcd00>                                  *
+ *                                                                             *
+ ******************************************************************************/
+/**
+ * @file pratt_parser.c
+ * @author Jan Kalina \<xkalinj00>
+ *
+ * @brief Implementace syntaktické analýzy výrazů metodou Pratt.
+ * @details Každá funkce analyzuje jednu část výrazu a vrací hotový podstrom
+ *          AST. Při chybě funkce uvolní vše, co sama vytvořila, a vrátí `NULL`;
+ *          hodnotu aktuálního terminálu uvolní až @c prattParser_parse().
+ *          Hodnotu tokenu, kterou převzal uzel AST, analyzátor v aktuálním
+ *          terminálu hned vynuluje, aby nebyla uvolněna dvakrát.
+ */
+
+// Import submodulů parseru
+#include "pratt_parser.h"
+#include "precedence_parser.h"
+#include "settings.h"
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                       INICIALIZACE GLOBÁLNÍCH PROMĚNNÝCH                    *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Příznak, že výrazy analyzuje analyzátor metodou Pratt.
+ */
+static bool prattParser_enabled = false;
+
+/**
+ * @brief Binární operátory indexované vstupním precedenčním terminálem.
+ *
+ * @details Síly odpovídají precedenční tabulce. `==` a `!=` se zprava vážou
+ *          silou relačních operátorů, takže `a == b < c` je `(a == b) < c`.
+ *          `<=` a `>=` se naopak zprava vážou slaběji, takže relační operátor
+ *          za nimi se posune: `a <= b < c` je `a <= (b < c)`.
+ */
+static const PrattParser_Operator prattParser_operators[PREC_TERMINAL_COUNT] = {
+    [T_PREC_PLUS]                  = { PRATT_POWER_ADDITIVE,       PRATT_POWER_ADDITIVE,       AST_OP_ADD           },
+    [T_PREC_MINUS]                 = { PRATT_POWER_ADDITIVE,       PRATT_POWER_ADDITIVE,       AST_OP_SUBTRACT      },
+    [T_PREC_MULTIPLICATION]        = { PRATT_POWER_MULTIPLICATIVE, PRATT_POWER_MULTIPLICATIVE, AST_OP_MULTIPLY      },
+    [T_PREC_DIVISION]              = { PRATT_POWER_MULTIPLICATIVE, PRATT_POWER_MULTIPLICATIVE, AST_OP_DIVIDE        },
+    [T_PREC_IDENTITY]              = { PRATT_POWER_EQUALITY,       PRATT_POWER_RELATIONAL,     AST_OP_EQUAL         },
+    [T_PREC_NOT_EQUAL]             = { PRATT_POWER_EQUALITY,       PRATT_POWER_RELATIONAL,     AST_OP_NOT_EQUAL     },
+    [T_PREC_LESS_THAN]             = { PRATT_POWER_RELATIONAL,     PRATT_POWER_RELATIONAL,     AST_OP_LESS_THAN     },
+    [T_PREC_GREATER_THAN]          = { PRATT_POWER_RELATIONAL,     PRATT_POWER_RELATIONAL,     AST_OP_GREATER_THAN  },
+    [T_PREC_LESS_THAN_OR_EQUAL]    = { PRATT_POWER_RELATIONAL,     PRATT_POWER_EQUALITY,       AST_OP_LESS_EQUAL    },
+    [T_PREC_GREATER_THAN_OR_EQUAL] = { PRATT_POWER_RELATIONAL,     PRATT_POWER_EQUALITY,       AST_OP_GREATER_EQUAL },
+}; // PrattParser_Operator prattParser_operators[]
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                        IMPLEMENTACE VEŘEJNÝCH FUNKCÍ                        *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Zapne analýzu výrazů metodou Pratt, pokud to nastavení požaduje.
+ */
+void prattParser_init(const char *setting) {
+    prattParser_enabled = settings_isEnabled(setting);
+} // prattParser_init()
+
+/**
+ * @brief Zjistí, zda výrazy analyzuje analyzátor metodou Pratt.
+ */
+bool prattParser_isEnabled() {
+    return prattParser_enabled;
+} // prattParser_isEnabled()
+
+/**
+ * @brief Analyzuje výraz metodou Pratt.
+ */
+AST_ExprNode *prattParser_parse(LLNonTerminals fromNonTerminal) {
+    // Zkontrolujeme, že v kontextu NEterminálu neparsujeme prázdný výraz
+    if(precParser_parsingEmptyExpression(fromNonTerminal)) {
+        return NULL;
+    }
+
+    // Namapujeme aktuální "dollar" terminál
+    PrattParser_Context context = { CURRENT_DOLLAR_UNDEFINED, 0 };
+    precTable_getDollarTerminalFromContext(fromNonTerminal, &context.dollar);
+
+    // Analyzujeme výraz s nejslabší vazbou (jako za "dollar" na dně zásobníku)
+    AST_ExprNode *result = NULL;
+    if(!parser_errorWatcher(IS_PARSING_ERROR)) {
+        result = prattParser_parseExpression(&context, PRATT_POWER_NONE);
+    }
+
+    // Výraz musí končit "dollar" terminálem, pravá závorka navíc je chybou
+    if(result != NULL && prattParser_inTerminal(&context) != T_PREC_DOLLAR) {
+        parser_errorWatcher(SET_ERROR_SYNTAX);
+    }
+
+    // Při chybě uvolníme výraz i hodnotu aktuálního terminálu
+    if(parser_errorWatcher(IS_PARSING_ERROR)) {
+        AST_destroyNode(AST_EXPR_NODE, result);
+        parser_freeCurrentTerminalValue();
+        return PARSING_ERROR;
+    }
+
+    return result;
+} // prattParser_parse()
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                        IMPLEMENTACE INTERNÍCH FUNKCÍ                        *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Analyzuje výraz, jehož operátory se vážou silou větší než @p minPower.
+ */
+AST_ExprNode *prattParser_parseExpression(PrattParser_Context *context, unsigned char minPower) {
+    AST_ExprNode *left = prattParser_parseOperand(context, minPower);
+
+    // Operátory s vyšší silou připojujeme zleva, dokud nenarazíme na slabší
+    while(left != NULL) {
+        const PrattParser_Operator *operator = prattParser_getOperator(prattParser_inTerminal(context));
+        if(operator->leftPower <= minPower) {
+            break;
+        }
+
+        if(!prattParser_advance()) {
+            AST_destroyNode(AST_EXPR_NODE, left);
+            return NULL;
+        }
+
+        // Pravý operand obsahuje jen operátory vázající silněji než tento
+        AST_ExprNode *right = prattParser_parseExpression(context, operator->rightPower);
+        if(right == NULL) {
+            AST_destroyNode(AST_EXPR_NODE, left);
+            return NULL;
+        }
+
+        // Vytvoření a inicializace AST uzlu pro binární operaci
+        AST_BinOpNode *binOpNode = (AST_BinOpNode *)AST_createNode(AST_BIN_OP_NODE);
+        if(parser_errorWatcher(IS_PARSING_ERROR)) {
+            AST_destroyNode(AST_EXPR_NODE, left);
+            AST_destroyNode(AST_EXPR_NODE, right);
+            return NULL;
+        }
+
+        AST_initNewBinOpNode(binOpNode, operator->binOp, left, right);
+        left = prattParser_wrapExpression(AST_EXPR_BINARY_OP, AST_BIN_OP_NODE, binOpNode);
+    } // while()
+
+    return left;
+} // prattParser_parseExpression()
+
+/**
+ * @brief Analyzuje operand výrazu.
+ */
+AST_ExprNode *prattParser_parseOperand(PrattParser_Context *context, unsigned char minPower) {
+    PrecTerminals inTerminal = prattParser_inTerminal(context);
+
+    switch(inTerminal) {
+        // Proměnná nebo volání uživatelské funkce
+        case T_PREC_ID:
+            return prattParser_parseIdentifier(context);
+
+        // Literál (tj. i32, f64, []u8, null)
+        case T_PREC_INT_LITERAL:
+        case T_PREC_FLOAT_LITERAL:
+        case T_PREC_STRING_LITERAL:
+        case T_PREC_NULL_LITERAL: {
+            // Převod literálu může skončit chybou (např. přetečení i32)
+            AST_NodeType nodeType = SN_WITHOUT_AST_TYPE;
+            AST_VarNode *literal = precStack_createOperandNode(inTerminal, &nodeType);
+            if(parser_errorWatcher(IS_PARSING_ERROR)) {
+                AST_destroyNode(AST_LITERAL_NODE, literal);
+                return NULL;
+            }
+            currentTerminal.value = NULL;
+
+            if(!prattParser_advance()) {
+                AST_destroyNode(AST_LITERAL_NODE, literal);
+                return NULL;
+            }
+
+            if(!prattParser_canFollowOperand(prattParser_inTerminal(context))) {
+                parser_errorWatcher(SET_ERROR_SYNTAX);
+                AST_destroyNode(AST_LITERAL_NODE, literal);
+                return NULL;
+            }
+
+            return prattParser_wrapExpression(AST_EXPR_LITERAL, AST_LITERAL_NODE, literal);
+        } // case T_PREC_*_LITERAL
+
+        // Volání vestavěné funkce
+        case T_PREC_IFJ:
+            return prattParser_parseBuiltInCall(context);
+
+        // Výraz v závorkách
+        case T_PREC_LEFT_BRACKET:
+            return prattParser_parseBrackets(context);
+
+        default:
+            break;
+    } // switch()
+
+    // Operátor, který by precedenční analyzátor posunul, přeskočíme i s jeho operandem
+    const PrattParser_Operator *operator = prattParser_getOperator(inTerminal);
+    if(operator->leftPower > minPower && prattParser_advance()) {
+        AST_destroyNode(AST_EXPR_NODE, prattParser_parseExpression(context, operator->rightPower));
+    }
+
+    // Na místě operandu nesmí být operátor ani jiný terminál
+    parser_errorWatcher(SET_ERROR_SYNTAX);
+    return NULL;
+} // prattParser_parseOperand()
+
+/**
+ * @brief Analyzuje proměnnou nebo volání uživatelské funkce.
+ */
+AST_ExprNode *prattParser_parseIdentifier(PrattParser_Context *context) {
+    // Vytvoříme uzel pro identifikátor, který převezme hodnotu tokenu
+    AST_NodeType nodeType = SN_WITHOUT_AST_TYPE;
+    AST_VarNode *variable = precStack_createOperandNode(T_PREC_ID, &nodeType);
+    if(variable != NULL) {
+        currentTerminal.value = NULL;
+    }
+
+    if(parser_errorWatcher(IS_PARSING_ERROR) || !prattParser_advance()) {
+        AST_destroyNode(AST_VAR_NODE, variable);
+        return NULL;
+    }
+
+    // Levá závorka za identifikátorem značí volání funkce
+    PrecTerminals inTerminal = prattParser_inTerminal(context);
+    if(inTerminal == T_PREC_LEFT_BRACKET) {
+        return prattParser_parseFunCall(context, variable, IS_USER_FUNCTION);
+    }
+
+    if(!prattParser_canFollowOperand(inTerminal)) {
+        parser_errorWatcher(SET_ERROR_SYNTAX);
+        AST_destroyNode(AST_VAR_NODE, variable);
+        return NULL;
+    }
+
+    return prattParser_createVariable(variable);
+} // prattParser_parseIdentifier()
+
+/**
+ * @brief Analyzuje volání vestavěné funkce `ifj . id (...)`.
+ */
+AST_ExprNode *prattParser_parseBuiltInCall(PrattParser_Context *context) {
+    // Za "ifj" musí následovat tečka a identifikátor
+    if(!prattParser_advance()) {
+        return NULL;
+    }
+    if(prattParser_inTerminal(context) != T_PREC_DOT) {
+        parser_errorWatcher(SET_ERROR_SYNTAX);
+        return NULL;
+    }
+
+    if(!prattParser_advance()) {
+        return NULL;
+    }
+    if(prattParser_inTerminal(context) != T_PREC_ID) {
+        parser_errorWatcher(SET_ERROR_SYNTAX);
+        return NULL;
+    }
+
+    // Vytvoříme uzel pro identifikátor vestavěné funkce
+    AST_NodeType nodeType = SN_WITHOUT_AST_TYPE;
+    AST_VarNode *idNode = precStack_createOperandNode(T_PREC_ID, &nodeType);
+    if(idNode != NULL) {
+        currentTerminal.value = NULL;
+    }
+
+    if(parser_errorWatcher(IS_PARSING_ERROR) || !prattParser_advance()) {
+        AST_destroyNode(AST_VAR_NODE, idNode);
+        return NULL;
+    }
+
+    // Vestavěnou funkci lze ve výrazu pouze volat
+    if(prattParser_inTerminal(context) != T_PREC_LEFT_BRACKET) {
+        parser_errorWatcher(SET_ERROR_SYNTAX);
+        AST_destroyNode(AST_VAR_NODE, idNode);
+        return NULL;
+    }
+
+    return prattParser_parseFunCall(context, idNode, IS_BUILT_IN_FUNCTION);
+} // prattParser_parseBuiltInCall()
+
+/**
+ * @brief Analyzuje argumenty volání funkce a vytvoří uzel volání.
+ */
+AST_ExprNode *prattParser_parseFunCall(PrattParser_Context *context, AST_VarNode *idNode, \
+                                       bool isBuiltIn)
+{
+    // Dočasně předáváme řízení LL analyzátoru a parsujeme neterminál <ARGUMENTS>
+    parser_getNextToken(POKE_SCANNER);
+    AST_ArgOrParamNode *arguments = LLparser_parseArguments();
+
+    // Žádáme scanner o token za pravou závorkou
+    parser_getNextToken(POKE_SCANNER);
+
+    if(parser_errorWatcher(IS_PARSING_ERROR)) {
+        AST_destroyArgOrParamList(arguments);
+        AST_destroyNode(AST_VAR_NODE, idNode);
+        return NULL;
+    }
+
+    // Závorky za voláním precedenční analyzátor přijme, ale výraz nezredukuje
+    PrecTerminals inTerminal = prattParser_inTerminal(context);
+    if(inTerminal == T_PREC_LEFT_BRACKET) {
+        AST_destroyNode(AST_EXPR_NODE, prattParser_parseBrackets(context));
+        inTerminal = T_PREC_UNDEFINED;
+    }
+
+    if(!prattParser_canFollowOperand(inTerminal)) {
+        parser_errorWatcher(SET_ERROR_SYNTAX);
+        AST_destroyArgOrParamList(arguments);
+        AST_destroyNode(AST_VAR_NODE, idNode);
+        return NULL;
+    }
+
+    // Vytvoření AST uzlu pro volání funkce
+    AST_FunCallNode *funCallNode = (AST_FunCallNode *)AST_createNode(AST_FUN_CALL_NODE);
+    if(parser_errorWatcher(IS_PARSING_ERROR)) {
+        AST_destroyArgOrParamList(arguments);
+        AST_destroyNode(AST_VAR_NODE, idNode);
+        return NULL;
+    }
+
+    // Identifikátor předáme uzlu pro volání, uzel pro identifikátor již nepotřebujeme
+    AST_initNewFunCallNode(funCallNode, idNode->identifier, isBuiltIn, arguments);
+    free(idNode);
+
+    return prattParser_wrapExpression(AST_EXPR_FUN_CALL, AST_FUN_CALL_NODE, funCallNode);
+} // prattParser_parseFunCall()
+
+/**
+ * @brief Analyzuje výraz v závorkách.
+ */
+AST_ExprNode *prattParser_parseBrackets(PrattParser_Context *context) {
+    // Vstupujeme do nové úrovně zanoření
+    context->bracketDepth++;
+
+    if(!prattParser_advance()) {
+        return NULL;
+    }
+
+    // Prázdné závorky precedenční analyzátor odmítne až u následujícího tokenu
+    if(prattParser_inTerminal(context) == T_PREC_RIGHT_BRACKET) {
+        prattParser_advance();
+        parser_errorWatcher(SET_ERROR_SYNTAX);
+        return NULL;
+    }
+
+    AST_ExprNode *inner = prattParser_parseExpression(context, PRATT_POWER_NONE);
+    if(inner == NULL) {
+        return NULL;
+    }
+
+    // Vnořený výraz musí být ukončen pravou závorkou
+    if(prattParser_inTerminal(context) != T_PREC_RIGHT_BRACKET) {
+        parser_errorWatcher(SET_ERROR_SYNTAX);
+        AST_destroyNode(AST_EXPR_NODE, inner);
+        return NULL;
+    }
+
+    // Vystupujeme z úrovně zanoření
+    context->bracketDepth--;
+
+    if(!prattParser_advance()) {
+        AST_destroyNode(AST_EXPR_NODE, inner);
+        return NULL;
+    }
+
+    if(!prattParser_canFollowOperand(prattParser_inTerminal(context))) {
+        parser_errorWatcher(SET_ERROR_SYNTAX);
+        AST_destroyNode(AST_EXPR_NODE, inner);
+        return NULL;
+    }
+
+    // Závorky do AST nepřidávají žádný uzel
+    return inner;
+} // prattParser_parseBrackets()
+
+/**
+ * @brief Vytvoří výraz s proměnnou a ověří, že je proměnná definována.
+ */
+AST_ExprNode *prattParser_createVariable(AST_VarNode *variable) {
+    // Zkontrolujeme, že se nesnažíme použít proměnnou mimo její rozsah platnosti
+    SymtableItem *foundItem = NULL;
+    FrameStack_result res = frameStack_findItem(variable->identifier, &foundItem);
+
+    if(res != FRAME_STACK_SUCCESS) {
+        if(res == FRAME_STACK_ITEM_DOESNT_EXIST) {
+            parser_errorWatcher(SET_ERROR_SEM_UNDEF);
+        }
+        else {
+            parser_errorWatcher(SET_ERROR_INTERNAL);
+        }
+
+        AST_destroyNode(AST_VAR_NODE, variable);
+        return NULL;
+    }
+
+    // Pokud proměnná nalezena byla, označíme ji jako použitou
+    foundItem->used = true;
+
+    // Nastavíme správné ID proměnné
+    variable->frameID = frameStack_getId(variable->identifier);
+
+    return prattParser_wrapExpression(AST_EXPR_VARIABLE, AST_VAR_NODE, variable);
+} // prattParser_createVariable()
+
+/**
+ * @brief Obalí uzel AST uzlem pro výraz.
+ */
+AST_ExprNode *prattParser_wrapExpression(AST_ExprType exprType, AST_NodeType nodeType, void *node) {
+    AST_ExprNode *exprNode = (AST_ExprNode *)AST_createNode(AST_EXPR_NODE);
+
+    // Pokud došlo při tvorbě uzlu k chybě, uvolníme obalovaný uzel
+    if(parser_errorWatcher(IS_PARSING_ERROR)) {
+        AST_destroyNode(nodeType, node);
+        return NULL;
+    }
+
+    AST_initNewExprNode(exprNode, exprType, node);
+    return exprNode;
+} // prattParser_wrapExpression()
+
+/**
+ * @brief Načte další token.
+ */
+bool prattParser_advance() {
+    parser_getNextToken(POKE_SCANNER);
+    return !parser_errorWatcher(IS_PARSING_ERROR);
+} // prattParser_advance()
+
+/**
+ * @brief Vrátí vstupní precedenční terminál pro aktuální terminál.
+ */
+PrecTerminals prattParser_inTerminal(PrattParser_Context *context) {
+    PrecTerminals inTerminal = T_PREC_UNDEFINED;
+    precParser_mapInTerminalToDollar(context->bracketDepth, context->dollar, &inTerminal);
+    return inTerminal;
+} // prattParser_inTerminal()
+
+/**
+ * @brief Vrátí binární operátor odpovídající vstupnímu terminálu.
+ */
+const PrattParser_Operator *prattParser_getOperator(PrecTerminals terminal) {
+    // Terminál mimo tabulku (např. T_PREC_UNDEFINED) není operátorem
+    if(terminal < 0 || terminal >= PREC_TERMINAL_COUNT) {
+        return &prattParser_operators[T_PREC_DOLLAR];
+    }
+
+    return &prattParser_operators[terminal];
+} // prattParser_getOperator()
+
+/**
+ * @brief Zjistí, zda může terminál následovat za dokončeným operandem.
+ */
+bool prattParser_canFollowOperand(PrecTerminals terminal) {
+    return terminal == T_PREC_RIGHT_BRACKET || terminal == T_PREC_DOLLAR || \
+           prattParser_getOperator(terminal)->leftPower != PRATT_POWER_NONE;
+} // prattParser_canFollowOperand()
+
+/*** Konec souboru pratt_parser.c ***/
@@ -0,0 +1,257 @@
+/*******************************************************************************
+ *                                                                             *
+ * Název projektu:   Implementace překladače imperativního jazyka IFJ24        *
+ *                                                                             *
+ * Soubor:           pratt_parser.h                                            *
+ * Autor:            Jan Kalina   <xkalinj00>                                  *
+ *                                                                             *
+ * Datum:            04.12.2024                                                *
+ * Poslední změna:   04.12.2024                                                *
+ *                                                                             *
+ * Tým:      Tým xkalinj00                                                     *
+ * Členové:  Farkašovský Lukáš    <xfarkal00>                                  *
+ *           Hýža Pavel           <xhyzapa00>                                  *
+ *           Kalina Jan           <xkalinj00>                                  *
+ *           Krejčí David         <xkrejcd00>                                  *
+ *                                                                             *
+ ******************************************************************************/
+/**
+ * @file pratt_parser.h
+ * @author Jan Kalina \<xkalinj00>
+ *
+ * @brief Hlavičkový soubor pro syntaktickou analýzu výrazů metodou Pratt.
+ * @details Alternativa k precedenčnímu syntaktickému analyzátoru se stejným
+ *          rozhraním @c precParser_parse(). Pokud je nastavena proměnná
+ *          prostředí @c PRATT_PARSER_ENV (na jinou hodnotu než `0`), výrazy
+ *          analyzuje rekurzivní sestup s vazebními silami operátorů
+ *          (precedence climbing). Uzly AST vznikají přímo při sestupu, bez
+ *          precedenčního zásobníku, handle a vyhledávání redukčních pravidel.
+ *
+ *          Vazební síly odpovídají precedenční tabulce: terminál @c b na
+ *          vstupu se posune za operátor @c a na vrcholu právě tehdy, když
+ *          levá síla @c b je větší než pravá síla @c a. Analyzátor proto
+ *          vytváří stejné stromy jako precedenční analyzátor a chyby hlásí
+ *          u stejného tokenu.
+ */
+
+#ifndef PRATT_PARSER_H_
+/** @cond  */
+#define PRATT_PARSER_H_
+/** @endcond  */
+
+// Import submodulů parseru
+#include "parser_common.h"
+#include "precedence_table.h"
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                              DEFINICE KONSTANT                              *
+ *                                                                             *
+ ******************************************************************************/
+
+#define PRATT_PARSER_ENV "IFJ24_PRATT_PARSER"   /**< Proměnná prostředí zapínající analyzátor metodou Pratt */
+
+#define PRATT_POWER_NONE            0   /**< Vazební síla terminálu, který není binárním operátorem */
+#define PRATT_POWER_EQUALITY        10  /**< Vazební síla operátorů `==` a `!=` zleva               */
+#define PRATT_POWER_RELATIONAL      11  /**< Vazební síla relačních operátorů                       */
+#define PRATT_POWER_ADDITIVE        20  /**< Vazební síla operátorů `+` a `-`                       */
+#define PRATT_POWER_MULTIPLICATIVE  30  /**< Vazební síla operátorů `*` a `/`                       */
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                             DEFINICE STRUKTUR                               *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Binární operátor pro analýzu metodou Pratt.
+ *
+ * @details Operátor se váže k levému operandu silou @c leftPower a jeho pravý
+ *          operand se analyzuje s minimální silou @c rightPower. Shodné síly
+ *          dávají levou asociativitu.
+ */
+typedef struct PrattParser_Operator {
+    unsigned char leftPower;        /**< Vazební síla operátoru zleva (`0` pro ne-operátor) */
+    unsigned char rightPower;       /**< Vazební síla operátoru zprava                      */
+    AST_BinOpType binOp;            /**< Typ binární operace v AST                          */
+} PrattParser_Operator;
+
+/**
+ * @brief Kontext analýzy jednoho výrazu.
+ */
+typedef struct PrattParser_Context {
+    DollarTerminals dollar;         /**< Kontextový "dollar" terminál výrazu        */
+    int bracketDepth;               /**< Aktuální úroveň zanoření závorek           */
+} PrattParser_Context;
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                         DEKLARACE VEŘEJNÝCH FUNKCÍ                          *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Zapne analýzu výrazů metodou Pratt, pokud to nastavení požaduje.
+ *
+ * @param [in] setting Hodnota proměnné @c PRATT_PARSER_ENV, nebo `NULL`
+ */
+void prattParser_init(const char *setting);
+
+/**
+ * @brief Zjistí, zda výrazy analyzuje analyzátor metodou Pratt.
+ *
+ * @return `true`, pokud je analýza metodou Pratt zapnuta, jinak `false`.
+ */
+bool prattParser_isEnabled();
+
+/**
+ * @brief Analyzuje výraz metodou Pratt.
+ *
+ * @details Rozhraní i chování odpovídá @c precParser_parse(): výraz končí
+ *          kontextovým "dollar" terminálem, který zůstane aktuálním
+ *          terminálem, a prázdný výraz v kontextu argumentů nebo příkazu
+ *          vrací `NULL` bez chyby.
+ *
+ * @param [in] fromNonTerminal NEterminál, ze kterého bylo předáno řízení.
+ *
+ * @return Ukazatel na kořen AST výrazu, nebo `PARSING_ERROR` při chybě.
+ */
+AST_ExprNode *prattParser_parse(LLNonTerminals fromNonTerminal);
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                         DEKLARACE INTERNÍCH FUNKCÍ                          *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Analyzuje výraz, jehož operátory se vážou silou větší než @p minPower.
+ *
+ * @param [in,out] context Kontext analyzovaného výrazu
+ * @param [in] minPower Pravá vazební síla operátoru před výrazem
+ *
+ * @return Ukazatel na AST uzel výrazu, nebo `NULL` při chybě.
+ */
+AST_ExprNode *prattParser_parseExpression(PrattParser_Context *context, unsigned char minPower);
+
+/**
+ * @brief Analyzuje operand výrazu.
+ *
+ * @details Operátor na místě operandu precedenční analyzátor posune na
+ *          zásobník a chybu ohlásí až při neúspěšné redukci. Analyzátor proto
+ *          takový operátor přeskočí, analyzuje jeho pravý operand a teprve
+ *          poté ohlásí syntaktickou chybu.
+ *
+ * @param [in,out] context Kontext analyzovaného výrazu
+ * @param [in] minPower Pravá vazební síla operátoru před operandem
+ *
+ * @return Ukazatel na AST uzel operandu, nebo `NULL` při chybě.
+ */
+AST_ExprNode *prattParser_parseOperand(PrattParser_Context *context, unsigned char minPower);
+
+/**
+ * @brief Analyzuje proměnnou nebo volání uživatelské funkce.
+ *
+ * @param [in,out] context Kontext analyzovaného výrazu
+ *
+ * @return Ukazatel na AST uzel výrazu, nebo `NULL` při chybě.
+ */
+AST_ExprNode *prattParser_parseIdentifier(PrattParser_Context *context);
+
+/**
+ * @brief Analyzuje volání vestavěné funkce `ifj . id (...)`.
+ *
+ * @param [in,out] context Kontext analyzovaného výrazu
+ *
+ * @return Ukazatel na AST uzel výrazu, nebo `NULL` při chybě.
+ */
+AST_ExprNode *prattParser_parseBuiltInCall(PrattParser_Context *context);
+
+/**
+ * @brief Analyzuje argumenty volání funkce a vytvoří uzel volání.
+ *
+ * @details Aktuálním terminálem je levá závorka za identifikátorem funkce.
+ *          Argumenty analyzuje LL analyzátor stejně jako při precedenční
+ *          analýze.
+ *
+ * @param [in,out] context Kontext analyzovaného výrazu
+ * @param [in] idNode Uzel s identifikátorem funkce (funkce jej uvolní)
+ * @param [in] isBuiltIn Příznak vestavěné funkce
+ *
+ * @return Ukazatel na AST uzel výrazu, nebo `NULL` při chybě.
+ */
+AST_ExprNode *prattParser_parseFunCall(PrattParser_Context *context, AST_VarNode *idNode, \
+                                       bool isBuiltIn);
+
+/**
+ * @brief Analyzuje výraz v závorkách.
+ *
+ * @param [in,out] context Kontext analyzovaného výrazu
+ *
+ * @return Ukazatel na AST uzel vnořeného výrazu, nebo `NULL` při chybě.
+ */
+AST_ExprNode *prattParser_parseBrackets(PrattParser_Context *context);
+
+/**
+ * @brief Vytvoří výraz s proměnnou a ověří, že je proměnná definována.
+ *
+ * @param [in] variable Uzel proměnné (při chybě jej funkce uvolní)
+ *
+ * @return Ukazatel na AST uzel výrazu, nebo `NULL` při chybě.
+ */
+AST_ExprNode *prattParser_createVariable(AST_VarNode *variable);
+
+/**
+ * @brief Obalí uzel AST uzlem pro výraz.
+ *
+ * @param [in] exprType Typ výrazu
+ * @param [in] nodeType Typ obaleného uzlu (pro uvolnění při chybě)
+ * @param [in] node Obalovaný uzel
+ *
+ * @return Ukazatel na AST uzel výrazu, nebo `NULL` při chybě.
+ */
+AST_ExprNode *prattParser_wrapExpression(AST_ExprType exprType, AST_NodeType nodeType, void *node);
+
+/**
+ * @brief Načte další token.
+ *
+ * @return `true`, pokud nedošlo k chybě, jinak `false`.
+ */
+bool prattParser_advance();
+
+/**
+ * @brief Vrátí vstupní precedenční terminál pro aktuální terminál.
+ *
+ * @param [in] context Kontext analyzovaného výrazu
+ *
+ * @return Vstupní terminál, u kterého jsou ukončující terminály výrazu
+ *         namapovány na @c T_PREC_DOLLAR.
+ */
+PrecTerminals prattParser_inTerminal(PrattParser_Context *context);
+
+/**
+ * @brief Vrátí binární operátor odpovídající vstupnímu terminálu.
+ *
+ * @param [in] terminal Vstupní precedenční terminál
+ *
+ * @return Ukazatel na operátor; pro terminál, který není binárním operátorem,
+ *         má operátor vazební sílu @c PRATT_POWER_NONE.
+ */
+const PrattParser_Operator *prattParser_getOperator(PrecTerminals terminal);
+
+/**
+ * @brief Zjistí, zda může terminál následovat za dokončeným operandem.
+ *
+ * @param [in] terminal Vstupní precedenční terminál
+ *
+ * @return `true` pro binární operátor, pravou závorku a "dollar" terminál.
+ */
+bool prattParser_canFollowOperand(PrecTerminals terminal);
+
+#endif // PRATT_PARSER_H_
+
+/*** Konec souboru pratt_parser.h ***/
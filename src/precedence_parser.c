@@ -30,6 +30,7 @@
 
 // Import submodulů parseru
 #include "precedence_parser.h"
+#include "pratt_parser.h"
 
 
 /*******************************************************************************
@@ -42,6 +43,11 @@
  * @brief Spustí precedenční syntaktickou analýzu.
  */
 AST_ExprNode *precParser_parse(LLNonTerminals fromNonTerminal) {
+    // Pokud je zapnut analyzátor metodou Pratt, předáme mu celý výraz
+    if(prattParser_isEnabled()) {
+        return prattParser_parse(fromNonTerminal);
+    }
+
     // Zkontrolujeme, že v kontextu NEterminálu neparsujeme prázdný výraz
     if(precParser_parsingEmptyExpression(fromNonTerminal)) {
         return NULL;
@@ -339,7 +345,7 @@ void precParser_chooseReductionRule(ReductionRule *rule) {
         distanceFromTop++;
 
         // Posun na další zásobníkový uzel (symbol)
-        stackNode = stackNode->next;
+        stackNode = precStack_peek(distanceFromTop);
     } // while()
 
     // Vyhledáme pravidlo v tabulce redukčních pravidel
@@ -544,17 +550,16 @@ bool precParser_applyRemainingReductions(PrecTerminals *topTerminal) {
  */
 void precParser_reduceVarOrLit(AST_NodeType nodeType) {
     // Popnutí uzlu s proměnnou/literálem ze zásobníku
-    PrecStackNode *stackNode = precStack_pop();
+    PrecStackNode stackNode = precStack_pop();
 
-    // Popnutí a uvolnění handle
-    PrecStackNode *handleNode = precStack_pop();
-    free(handleNode);
+    // Popnutí handle
+    precStack_pop();
 
     // Do pomocné proměnné dereferncujeme uzel pro proměnnou/literál
-    AST_VarNode *variable = (AST_VarNode *)stackNode->node;
+    AST_VarNode *variable = (AST_VarNode *)stackNode.node;
 
     if(variable == NULL) {
-        precStack_freeNode(stackNode);  // uvolníme zásobníkový a AST uzel pro id/literál
+        precStack_freeNode(&stackNode); // uvolníme AST uzel pro id/literál
         parser_errorWatcher(SET_ERROR_INTERNAL);
         return;
     }
@@ -564,7 +569,7 @@ void precParser_reduceVarOrLit(AST_NodeType nodeType) {
 
     // Pokud došlo při tvorbě uzlu k chybě, ukončíme funkci
     if(parser_errorWatcher(IS_PARSING_ERROR)) {
-        precStack_freeNode(stackNode);  // uvolníme zásobníkový a AST uzel pro id/literál
+        precStack_freeNode(&stackNode); // uvolníme AST uzel pro id/literál
         return;
     }
 
@@ -582,7 +587,7 @@ void precParser_reduceVarOrLit(AST_NodeType nodeType) {
                 parser_errorWatcher(SET_ERROR_INTERNAL);
             }
 
-            precStack_freeNode(stackNode);              // Uvolníme zásobníkový uzel včetně AST uzlu
+            precStack_freeNode(&stackNode);             // Uvolníme AST uzel pro proměnnou
             AST_destroyNode(AST_EXPR_NODE, exprNode);   // Uvolníme vytvořený AST uzel pro výraz
             return;
         }
@@ -594,21 +599,18 @@ void precParser_reduceVarOrLit(AST_NodeType nodeType) {
         variable->frameID = frameStack_getId(variable->identifier);
 
         // Nyní můžeme inicializovat uzel pro výraz obsahující proměnnou
-        AST_initNewExprNode(exprNode, AST_EXPR_VARIABLE, stackNode->node);
+        AST_initNewExprNode(exprNode, AST_EXPR_VARIABLE, stackNode.node);
     }
     // Jinak incializujeme uzel pro výraz obsahující literál
     else if(nodeType == AST_LITERAL_NODE) {
-        AST_initNewExprNode(exprNode, AST_EXPR_LITERAL, stackNode->node);
+        AST_initNewExprNode(exprNode, AST_EXPR_LITERAL, stackNode.node);
     }
     else {
-        precStack_freeNode(stackNode);
+        precStack_freeNode(&stackNode);
         parser_errorWatcher(SET_ERROR_INTERNAL);
         return;
     } // if-ifelse-else()
 
-    // Uvolnění popnutého uzlu, protože jeho AST uzel byl již použit
-    free(stackNode);
-
     // Pushnutí nového uzlu pro neterminál "E" na zásobník s AST uzlem pro výraz
     precStack_pushPrecNonTerminal(PREC_STACK_NT_EXPRESSION, AST_EXPR_NODE, exprNode);
 
@@ -623,35 +625,29 @@ void precParser_reduceVarOrLit(AST_NodeType nodeType) {
  */
 void precParser_reduceBinOp(AST_BinOpType binOp) {
     // Popnutí pravého operandu E
-    PrecStackNode *rightNode = precStack_pop();
+    PrecStackNode rightNode = precStack_pop();
 
-    // Popnutí a uvolnění operátoru
-    PrecStackNode *opNode = precStack_pop();
-    free(opNode);
+    // Popnutí operátoru
+    precStack_pop();
 
     // Popnutí levého operandu 'E'
-    PrecStackNode *leftNode = precStack_pop();
+    PrecStackNode leftNode = precStack_pop();
 
-    // Popnutí a uvolnění handle
-    PrecStackNode *handleNode = precStack_pop();
-    free(handleNode);
+    // Popnutí handle
+    precStack_pop();
 
     // Vytvoření a inicializace AST uzlu pro binární operaci
     AST_BinOpNode *binOpNode = (AST_BinOpNode *)AST_createNode(AST_BIN_OP_NODE);
 
     // Pokud došlo při tvorbě uzlu k chybě, ukončíme funkci
     if(parser_errorWatcher(IS_PARSING_ERROR)) {
-        precStack_freeNode(leftNode);   // uvolníme zásobníkový a AST uzel pro levý operand
-        precStack_freeNode(rightNode);  // uvolníme zásobníkový a AST uzel pro pravý operand
+        precStack_freeNode(&leftNode);  // uvolníme AST uzel pro levý operand
+        precStack_freeNode(&rightNode); // uvolníme AST uzel pro pravý operand
         return;
     }
 
     // Inicializujeme nový uzel pro binární operaci levým a pravým operandem
-    AST_initNewBinOpNode(binOpNode, binOp, leftNode->node, rightNode->node);
-
-    // Uvolnění popnutých uzlů, protože jejich AST uzly byly již použity
-    free(leftNode);
-    free(rightNode);
+    AST_initNewBinOpNode(binOpNode, binOp, leftNode.node, rightNode.node);
 
     // Vytvoření a inicializace AST uzlu pro výraz s binární operací
     AST_ExprNode *exprNode = (AST_ExprNode *)AST_createNode(AST_EXPR_NODE);
@@ -678,26 +674,20 @@ void precParser_reduceBinOp(AST_BinOpType binOp) {
  * @brief Aplikuje redukci pro výraz v závorkách `E -> ( E )`.
  */
 void precParser_reduceIntoBrackets() {
-    // Popnutí a uvolnění ')'
-    PrecStackNode *rightBracket = precStack_pop();
-    free(rightBracket);
+    // Popnutí ')'
+    precStack_pop();
 
     // Popnutí 'E'
-    PrecStackNode *innerNode = precStack_pop();
+    PrecStackNode innerNode = precStack_pop();
 
-    // Popnutí a uvolnění '('
-    PrecStackNode *leftBracket = precStack_pop();
-    free(leftBracket);
+    // Popnutí '('
+    precStack_pop();
 
-    // Popnutí a uvolnění handle
-    PrecStackNode *handleNode = precStack_pop();
-    free(handleNode);
+    // Popnutí handle
+    precStack_pop();
 
     // Pushnutí E zpět na zásobník bez změny (pouze jsme odstranili závorky okolo)
-    precStack_pushPrecNonTerminal(PREC_STACK_NT_EXPRESSION, innerNode->nodeType, innerNode->node);
-
-    // Uvolníme původní StackNode pro výraz E (funkce výše vytvořila nový)
-    free(innerNode);
+    precStack_pushPrecNonTerminal(PREC_STACK_NT_EXPRESSION, innerNode.nodeType, innerNode.node);
 } // precParser_reduceIntoBrackets()
 
 /**
@@ -706,46 +696,41 @@ void precParser_reduceIntoBrackets() {
  */
 void precParser_reduceFunCall(bool isBuiltIn) {
     // Popnutí '<ARG_LIST>'
-    PrecStackNode *argumentsNode = precStack_pop();
+    PrecStackNode argumentsNode = precStack_pop();
 
     // Popnutí 'id'
-    PrecStackNode *varNode = precStack_pop();
+    PrecStackNode varNode = precStack_pop();
 
     // Pokud se jedná o vestavěnou funkci, popneme dva zásobníkové uzly navíc
     if(isBuiltIn) {
-        // Popnutí a uvolnění '.'
-        PrecStackNode *dot = precStack_pop();
-        free(dot);
+        // Popnutí '.'
+        precStack_pop();
 
-        // Popnutí a uvolnění 'ifj'
-        PrecStackNode *ifj = precStack_pop();
-        free(ifj);
+        // Popnutí 'ifj'
+        precStack_pop();
     }
 
-    // Popnutí a uvolnění handle
-    PrecStackNode *handleNode = precStack_pop();
-    free(handleNode);
+    // Popnutí handle
+    precStack_pop();
 
     // Vytvoření AST uzlu pro volání funkce
     AST_FunCallNode *funCallNode = (AST_FunCallNode *)AST_createNode(AST_FUN_CALL_NODE);
 
     // Pokud došlo při tvorbě uzlu k chybě, ukončíme funkci
     if(parser_errorWatcher(IS_PARSING_ERROR)) {
-        precStack_freeNode(argumentsNode);  // Uvolníme zaábníkový uzel se seznamem argumentů
-        precStack_freeNode(varNode);        // Uvolníme zásobníkový uzel s AST uzle pro id
+        precStack_freeNode(&argumentsNode); // Uvolníme seznam argumentů
+        precStack_freeNode(&varNode);       // Uvolníme AST uzel pro id
         return;
     }
 
     // Do pomocné proměnné dereferencujeme AST uzel pro identifikátor
-    AST_VarNode *idNode = (AST_VarNode *)varNode->node;
+    AST_VarNode *idNode = (AST_VarNode *)varNode.node;
 
     // Inicializujeme nový uzel pro volání funkce
-    AST_initNewFunCallNode(funCallNode, idNode->identifier, isBuiltIn, argumentsNode->node);
+    AST_initNewFunCallNode(funCallNode, idNode->identifier, isBuiltIn, argumentsNode.node);
 
-    // Uvolnění popnutých uzlů, protože jejich AST uzly byly již použity
+    // Uvolnění AST uzlu pro id, protože jeho identifikátor převzalo volání funkce
     free(idNode);
-    free(varNode);
-    free(argumentsNode);
 
     // Vytvoření AST uzlu pro výraz
     AST_ExprNode *exprNode = (AST_ExprNode *)AST_createNode(AST_EXPR_NODE);
@@ -789,9 +774,9 @@ inline bool precParser_parsingEmptyExpression(LLNonTerminals fromNonTerminal) {
 inline bool precParser_shouldEndRuleSelecetion(unsigned char distanceFromTop, \
                                                PrecStackNode *stackNode)
 {
-    return (stackNode->symbol != PREC_STACK_SYM_DOLLAR && \
-            distanceFromTop < MAX_SYMBOLS_TO_REDUCE && \
-            stackNode != NULL);
+    return (stackNode != NULL && \
+            stackNode->symbol != PREC_STACK_SYM_DOLLAR && \
+            distanceFromTop < MAX_SYMBOLS_TO_REDUCE);
 } // precParser_shouldEndRuleSelecetion()
 
 /**
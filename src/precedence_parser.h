@@ -364,7 +364,7 @@ bool precParser_parsingEmptyExpression(LLNonTerminals fromNonTerminal);
  *          od vrcholu zásobníku a typu aktuálního zásobníkového uzlu.
  *
  * @param [in] distanceFromTop Vzdálenost od vrcholu zásobníku.
- * @param [in] stackNode Ukazatel na aktuální zásobníkový uzel.
+ * @param [in] stackNode Ukazatel na aktuální zásobníkový uzel (`NULL` za dnem zásobníku).
  *
  * @return @c True, pokud by mělo procházení zásobníku skončit, jinak @c false.
  */
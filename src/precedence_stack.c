@@ -63,8 +63,13 @@ void precStackList_create() {
             return;
         }
 
-        // Počáteční inicializace prvního zásobníku v seznamu na NULL
-        precStackList->stack = NULL;
+        // Počáteční inicializace seznamu bez zásobníků (pole se alokují až při prvním push)
+        precStackList->nodes = NULL;
+        precStackList->length = 0;
+        precStackList->allocated = 0;
+        precStackList->bases = NULL;
+        precStackList->count = 0;
+        precStackList->basesAllocated = 0;
     }
 } // precStackList_create()
 
@@ -73,8 +78,10 @@ void precStackList_create() {
  */
 void precStackList_destroy() {
     if(precStackList != NULL) {
-        free(precStackList);        // Uvvolnění paměti pro seznam zásobníků
-        precStackList = NULL;       // Uvedení do neinicializovaného stavu
+        free(precStackList->nodes);     // Uvolnění pole uzlů všech zásobníků
+        free(precStackList->bases);     // Uvolnění pole počátečních indexů zásobníků
+        free(precStackList);            // Uvvolnění paměti pro seznam zásobníků
+        precStackList = NULL;           // Uvedení do neinicializovaného stavu
     }
 } // precStackList_destroy()
 
@@ -87,19 +94,23 @@ void precStackList_push() {
         return;
     }
 
-    // Vytvoření nového precedenčního zásobníku a kontrola úspěchu alokace
-    PrecStack *newStack = (PrecStack *)malloc(sizeof(PrecStack));
-    if(newStack == NULL) {
-        parser_errorWatcher(SET_ERROR_INTERNAL);
-        return;
-    }
+    // Pokud došla kapacita pole počátečních indexů, tak jej rozšíříme
+    if(precStackList->count == precStackList->basesAllocated) {
+        size_t allocated = (precStackList->basesAllocated == 0) ? PREC_STACK_LIST_INIT_SIZE : \
+                           precStackList->basesAllocated * PREC_STACK_EXPAND_FACTOR;
+        size_t *bases = realloc(precStackList->bases, allocated * sizeof(size_t));
+
+        if(bases == NULL) {
+            parser_errorWatcher(SET_ERROR_INTERNAL);
+            return;
+        }
 
-    // Inicializujem nový zásobník jako prázdný
-    newStack->top = NULL;
+        precStackList->bases = bases;
+        precStackList->basesAllocated = allocated;
+    }
 
-    // Přidání nového zásobníku do seznamu zásobníků
-    newStack->next = precStackList->stack;
-    precStackList->stack = newStack;
+    // Nový zásobník začíná na konci pole uzlů
+    precStackList->bases[precStackList->count++] = precStackList->length;
 
     // Inicializace nového zásobníku - push počátečního "dollar" symbolu
     precStack_pushPrecTerminal(T_PREC_DOLLAR, SN_WITHOUT_AST_TYPE, SN_WITHOUT_AST_PTR);
@@ -110,31 +121,32 @@ void precStackList_push() {
  */
 void precStackList_pop() {
     // Kontrola, že seznam a zásobníků a jeho vrchol existují
-    if(precStackList == NULL || precStackList->stack == NULL) {
+    if(precStackList == NULL || precStackList->count == 0) {
         return;
     }
 
-    // Nastavíme nový vrchol seznamu zásobníků
-    PrecStack *topStack = precStackList->stack;
-    precStackList->stack = topStack->next;
-
-    precStack_dispose(topStack);    // Uvolní zásobníka a zásobníkové uzly bez AST uzlů
+    // Zkrácením pole na počáteční index zásobníku odebereme všechny jeho uzly
+    precStackList->length = precStackList->bases[--precStackList->count];
 } // precStackList_pop()
 
 /**
  * @brief Uvolní všechny zásobníky a jejich obsah ze seznamu
- *        pomocí @c precStack_purge() (včetně uvolnění AST uzlů).
+ *        pomocí @c precStack_freeNode() (včetně uvolnění AST uzlů).
  */
 void precStackList_purge() {
-    // Uvolní všechny zásobníky včetně AST uzlů
-    while(precStackList != NULL && precStackList->stack != NULL) {
-        precStack_purge(precStackList->stack);
+    if(precStackList == NULL) {
+        return;
     }
 
-    if(precStackList != NULL) {
-        free(precStackList);
-        precStackList = NULL;
+    // Uvolní AST uzly ve všech zásobnících, od vrcholu pole k jeho dnu
+    while(precStackList->length > 0) {
+        precStack_freeNode(&precStackList->nodes[--precStackList->length]);
     }
+
+    precStackList->count = 0;
+
+    // Uvolní samotný seznam zásobníků
+    precStackList_destroy();
 } // precStackList_purge()
 
 /**
@@ -142,7 +154,7 @@ void precStackList_purge() {
  */
 void precStack_pushPrecTerminal(PrecTerminals terminal, AST_NodeType type, void *node) {
     // Pokud není precStack alokovaný, nic se neděje
-    if(precStackList == NULL || precStackList->stack == NULL) {
+    if(precStackList == NULL || precStackList->count == 0) {
         return;
     }
 
@@ -150,20 +162,15 @@ void precStack_pushPrecTerminal(PrecTerminals terminal, AST_NodeType type, void
     PrecStackSymbol stackSymbol = PREC_STACK_SYM_UNEDFINED;
     precStack_mapPrecTerminalToStackSymbol(terminal, &stackSymbol);
 
-    // Vytvoříme nový uzel zásobníku
-    PrecStackNode *newStackNode = precStack_createStackNode();
-
-    // Inicializace nové zásobníkového uzlu pro terminál
-    if(newStackNode != NULL) {
-        newStackNode->symbolType = STACK_NODE_TYPE_TERMINAL;
-        newStackNode->symbol = stackSymbol;
-        newStackNode->nodeType = type;
-        newStackNode->node = node;
-        newStackNode->next = precStack_top();
+    // Inicializace nového zásobníkového uzlu pro terminál a jeho vložení na vrchol
+    PrecStackNode newStackNode = {
+        .symbolType = STACK_NODE_TYPE_TERMINAL,
+        .symbol = stackSymbol,
+        .nodeType = type,
+        .node = node,
+    };
 
-        // Nastavení nového uzlu jako vrcholu zásobníku
-        precStackList->stack->top = newStackNode;
-    }
+    precStack_pushNode(newStackNode);
 } // precStack_pushPrecTerminal()
 
 /**
@@ -171,7 +178,7 @@ void precStack_pushPrecTerminal(PrecTerminals terminal, AST_NodeType type, void
  */
 void precStack_pushPrecNonTerminal(PrecStackNonTerminals symbol, AST_NodeType type, void *node) {
     // Pokud není precStack alokovaný, nic se neděje
-    if(precStackList == NULL || precStackList->stack == NULL) {
+    if(precStackList == NULL || precStackList->count == 0) {
         return;
     }
 
@@ -179,181 +186,171 @@ void precStack_pushPrecNonTerminal(PrecStackNonTerminals symbol, AST_NodeType ty
     PrecStackSymbol stackSymbol = PREC_STACK_SYM_UNEDFINED;
     precStack_mapStackNonTerminalToStackSymbol(symbol, &stackSymbol);
 
-    // Vytvoříme nový uzel zásobníku
-    PrecStackNode *newStackNode = precStack_createStackNode();
-
     // Inicializace nové zásobníkového uzlu pro neterminál
-    if(newStackNode != NULL) {
-        // Nastavení typu symbolu nového uzlu na základě typu neterminálu
-        switch(symbol) {
-            case PREC_STACK_NT_EXPRESSION:
-            case PREC_STACK_NT_ARG_LIST:
-                newStackNode->symbolType = STACK_NODE_TYPE_NONTERMINAL;
-                break;
-            case PREC_STACK_NT_HANDLE:
-                newStackNode->symbolType = STACK_NODE_TYPE_HANDLE;
-                break;
-            default:
-                parser_errorWatcher(SET_ERROR_INTERNAL);
-        }
-
-        // Inicializujeme zbytek nového uzlu
-        newStackNode->symbol = stackSymbol;
-        newStackNode->nodeType = type;
-        newStackNode->node = node;
-        newStackNode->next = precStack_top();
-
-        // Nastavení nového uzlu jako vrcholu zásobníku
-        precStackList->stack->top = newStackNode;
+    PrecStackNode newStackNode = {
+        .symbolType = STACK_NODE_TYPE_UNDEFINED,
+        .symbol = stackSymbol,
+        .nodeType = type,
+        .node = node,
+    };
+
+    // Nastavení typu symbolu nového uzlu na základě typu neterminálu
+    switch(symbol) {
+        case PREC_STACK_NT_EXPRESSION:
+        case PREC_STACK_NT_ARG_LIST:
+            newStackNode.symbolType = STACK_NODE_TYPE_NONTERMINAL;
+            break;
+        case PREC_STACK_NT_HANDLE:
+            newStackNode.symbolType = STACK_NODE_TYPE_HANDLE;
+            break;
+        default:
+            parser_errorWatcher(SET_ERROR_INTERNAL);
     }
+
+    // Vložení nového uzlu na vrchol zásobníku
+    precStack_pushNode(newStackNode);
 } // precStack_pushPrecNonTerminal()
 
 /**
  * @brief Vloží inicializovaný Stack uzel na zásobník, popř. i s AST uzlem.
  */
 void precStack_pushBothStackAndASTNode(PrecTerminals inTerminal) {
-    // Switch specifikující uzel pushnutý na zásbník
-    switch(inTerminal) {
+    // Pro identifikátor nebo literál vytvoříme uzel AST, jinak zůstane bez uzlu
+    AST_NodeType nodeType = SN_WITHOUT_AST_TYPE;
+    void *pushNode = precStack_createOperandNode(inTerminal, &nodeType);
+
+    // Pushnutí uzlu na zásobník
+    precStack_pushPrecTerminal(inTerminal, nodeType, pushNode);
+
+    if(parser_errorWatcher(IS_PARSING_ERROR)) {
+        parser_freeCurrentTerminalValue();
+    }
+} // precStack_pushBothStackAndASTNode()
+
+/**
+ * @brief Vytvoří AST uzel pro identifikátor nebo literál z aktuálního terminálu.
+ */
+void *precStack_createOperandNode(PrecTerminals terminal, AST_NodeType *nodeType) {
+    // Switch specifikující vytvářený uzel
+    switch(terminal) {
         // Pro uzel pro proměnnou
         case T_PREC_ID: {
             // Vytvoření a konkrétní inicializace uzlu pro proměnnou (identifikátor)
-            AST_VarNode *pushNode = (AST_VarNode *)AST_createNode(AST_VAR_NODE);
-            AST_initNewVarNode(pushNode, AST_VAR_NODE, currentTerminal.value,
+            AST_VarNode *node = (AST_VarNode *)AST_createNode(AST_VAR_NODE);
+            AST_initNewVarNode(node, AST_VAR_NODE, currentTerminal.value,
                                frameStack.currentID, AST_LITERAL_NOT_DEFINED,
                                AST_VAL_UNDEFINED);
-
-            // Pushnutí uzlu na zásobník
-            precStack_pushPrecTerminal(inTerminal, AST_VAR_NODE, pushNode);
-            break;
+            *nodeType = AST_VAR_NODE;
+            return node;
         } // case T_PREC_ID
 
         // Pro uzel pro pro literál typu "i32"
         case T_PREC_INT_LITERAL: {
             // Vytvoření a konkrétní inicializace uzlu pro i32 literál
-            AST_VarNode *pushNode = (AST_VarNode *)AST_createNode(AST_LITERAL_NODE);
-            AST_initNewVarNode(pushNode, AST_LITERAL_NODE, AST_ID_UNDEFINED,
+            AST_VarNode *node = (AST_VarNode *)AST_createNode(AST_LITERAL_NODE);
+            AST_initNewVarNode(node, AST_LITERAL_NODE, AST_ID_UNDEFINED,
                                frameStack.currentID, AST_LITERAL_INT,
                                currentTerminal.value);
-
-            // Pushnutí uzlu na zásobník
-            precStack_pushPrecTerminal(inTerminal, AST_LITERAL_NODE, pushNode);
-            break;
+            *nodeType = AST_LITERAL_NODE;
+            return node;
         } // case T_PREC_INT_LITERAL
 
         // Pro uzel pro pro literál typu "f64"
         case T_PREC_FLOAT_LITERAL: {
             // Vytvoření a konkrétní inicializace uzlu pro f64 literál
-            AST_VarNode *pushNode = (AST_VarNode *)AST_createNode(AST_LITERAL_NODE);
-            AST_initNewVarNode(pushNode, AST_LITERAL_NODE, AST_ID_UNDEFINED,
+            AST_VarNode *node = (AST_VarNode *)AST_createNode(AST_LITERAL_NODE);
+            AST_initNewVarNode(node, AST_LITERAL_NODE, AST_ID_UNDEFINED,
                                frameStack.currentID, AST_LITERAL_FLOAT,
                                currentTerminal.value);
-
-            // Pushnutí uzlu na zásobník
-            precStack_pushPrecTerminal(inTerminal, AST_LITERAL_NODE, pushNode);
-            break;
+            *nodeType = AST_LITERAL_NODE;
+            return node;
         } // case T_PREC_FLOAT_LITERAL
 
         // Pro uzel pro pro literál typu "[]u8"
         case T_PREC_STRING_LITERAL: {
             // Vytvoření a konkrétní inicializace uzlu pro []u8 literál
-            AST_VarNode *pushNode = (AST_VarNode *)AST_createNode(AST_LITERAL_NODE);
-            AST_initNewVarNode(pushNode, AST_LITERAL_NODE, AST_ID_UNDEFINED,
+            AST_VarNode *node = (AST_VarNode *)AST_createNode(AST_LITERAL_NODE);
+            AST_initNewVarNode(node, AST_LITERAL_NODE, AST_ID_UNDEFINED,
                                frameStack.currentID, AST_LITERAL_STRING,
                                currentTerminal.value);
-
-            // Pushnutí uzlu na zásobník
-            precStack_pushPrecTerminal(inTerminal, AST_LITERAL_NODE, pushNode);
-            break;
+            *nodeType = AST_LITERAL_NODE;
+            return node;
         } // case T_PREC_STRING_LITERAL
 
         // Pro uzel pro pro literál typu "NULL"
         case T_PREC_NULL_LITERAL: {
             // Vytvoření a konkrétní inicializace uzlu pro null literál
-            AST_VarNode *pushNode = (AST_VarNode *)AST_createNode(AST_LITERAL_NODE);
-            AST_initNewVarNode(pushNode, AST_LITERAL_NODE, AST_ID_UNDEFINED,
+            AST_VarNode *node = (AST_VarNode *)AST_createNode(AST_LITERAL_NODE);
+            AST_initNewVarNode(node, AST_LITERAL_NODE, AST_ID_UNDEFINED,
                                frameStack.currentID, AST_LITERAL_NULL,
                                currentTerminal.value);
-
-            // Pushnutí uzlu na zásobník
-            precStack_pushPrecTerminal(inTerminal, AST_LITERAL_NODE, pushNode);
-            break;
+            *nodeType = AST_LITERAL_NODE;
+            return node;
         } // case T_PREC_NULL_LITERAL
 
-        // Jinak oushujeme terminálový uzel na zásobník bez vytvoření AST uzlu
+        // Jinak terminál AST uzel nemá
         default:
-            precStack_pushPrecTerminal(inTerminal, SN_WITHOUT_AST_TYPE, SN_WITHOUT_AST_PTR);
+            *nodeType = SN_WITHOUT_AST_TYPE;
+            return SN_WITHOUT_AST_PTR;
     } // switch()
-
-    if(parser_errorWatcher(IS_PARSING_ERROR)) {
-        parser_freeCurrentTerminalValue();
-    }
-} // precStack_pushBothStackAndASTNode()
+} // precStack_createOperandNode()
 
 /**
  * @brief Vloží handle za první terminál na zásobníku.
  */
 void precStack_pushHandleAfterFirstTerminal() {
     // Kontrolujeme, že aexstuje seznam zásbníků a vrcholový zásobník
-    if(precStackList == NULL || precStackList->stack == NULL) {
+    if(precStackList == NULL || precStackList->count == 0) {
         parser_errorWatcher(SET_ERROR_INTERNAL);
         return;
     }
 
-    // Připravíme si pomocné ukazatele k průchodu aktuálním zásobníkem
-    PrecStackNode *current = precStack_top();
-    PrecStackNode *prev = NULL;
-
     // Procházáme zásobník, dokud nenajdieme první terminál na zásobníku
-    while(current != NULL && current->symbolType != STACK_NODE_TYPE_TERMINAL) {
-        prev = current;
-        current = current->next;
+    size_t base = precStackList->bases[precStackList->count - 1];
+    size_t index = precStackList->length;
+
+    while(index > base && precStackList->nodes[index - 1].symbolType != STACK_NODE_TYPE_TERMINAL) {
+        index--;
     }
 
     // Pokud jsme žádný nenalezly, nastala interní chyba (nemělo by nikdy nastat)
-    if(current == NULL) {
+    if(index == base) {
         parser_errorWatcher(SET_ERROR_INTERNAL);
+        return;
     }
 
-    // Vytvoření nového uzlu pro handle
-    PrecStackNode *handleNode = precStack_createStackNode();
+    // Zajistíme místo pro handle na konci pole
+    if(!precStack_reserveNode()) {
+        return;
+    }
 
-    // Inicializujeme uzel pro handle
-    if(handleNode != NULL) {
-        handleNode->symbolType = STACK_NODE_TYPE_HANDLE;
-        handleNode->symbol = PREC_STACK_SYM_HANDLE;
-        handleNode->nodeType = SN_WITHOUT_AST_TYPE;
-        handleNode->node = SN_WITHOUT_AST_PTR;
+    // Uzly nad prvním terminálem posuneme o jednu pozici výše
+    PrecStackNode *nodes = precStackList->nodes;
+    memmove(&nodes[index + 1], &nodes[index], (precStackList->length - index) * sizeof(PrecStackNode));
+    precStackList->length++;
 
-        // Vložení handle za první terminál
-        if(prev == NULL) {
-            // Pokud je první terminál na vrcholu zásobníku
-            handleNode->next = precStack_top();
-            precStackList->stack->top = handleNode;
-        }
-        // Pokud je první terminál někde uvnitř zásobníku
-        else {
-            handleNode->next = current;
-            prev->next = handleNode;
-        }
-    }
+    // Vložení handle za první terminál
+    nodes[index].symbolType = STACK_NODE_TYPE_HANDLE;
+    nodes[index].symbol = PREC_STACK_SYM_HANDLE;
+    nodes[index].nodeType = SN_WITHOUT_AST_TYPE;
+    nodes[index].node = SN_WITHOUT_AST_PTR;
 } // precStack_pushHandleAfterFirstTerminal()
 
 /**
- * @brief Odebere uzel AST z globálního precedenčního zásobníku.
+ * @brief Odebere uzel z globálního precedenčního zásobníku.
  */
-PrecStackNode *precStack_pop() {
+PrecStackNode precStack_pop() {
     // Zkontrolujeme, že je co popnout
-    if(precStackList == NULL || precStackList->stack == NULL || precStackList->stack->top == NULL) {
+    if(precStackList == NULL || precStackList->count == 0 || precStack_isEmpty()) {
         parser_errorWatcher(SET_ERROR_INTERNAL);
-        return PARSING_ERROR;
+        return (PrecStackNode){ .symbolType = STACK_NODE_TYPE_UNDEFINED,
+                                .symbol = PREC_STACK_SYM_UNEDFINED,
+                                .nodeType = SN_WITHOUT_AST_TYPE,
+                                .node = SN_WITHOUT_AST_PTR };
     }
 
-    // Aktualizujeme vrcholový uzel aktuálního zásobníku
-    PrecStackNode *node = precStack_top();
-    precStackList->stack->top = node->next;
-
-    // Vracíme ukazatel na vyňatý uzel
-    return node;
+    // Zkrátíme pole a vracíme kopii vyňatého uzlu
+    return precStackList->nodes[--precStackList->length];
 } // precStack_pop()
 
 /**
@@ -362,15 +359,34 @@ PrecStackNode *precStack_pop() {
  */
 inline PrecStackNode* precStack_top() {
     // Kontrola, zda je zásobník alokovaný
-    if(precStackList == NULL || precStackList->stack == NULL) {
+    if(precStackList == NULL || precStackList->count == 0) {
         parser_errorWatcher(SET_ERROR_INTERNAL);
         return PARSING_ERROR;
     }
 
     // Vracíme ukazatel na vrcholový prvek (může být NULL)
-    return precStackList->stack->top;
+    return precStack_peek(0);
 } // precStack_top()
 
+/**
+ * @brief Získá ukazatel na uzel v dané vzdálenosti od vrcholu aktuálního
+ *        zásobníku.
+ */
+PrecStackNode *precStack_peek(size_t distanceFromTop) {
+    // Kontrola, zda je zásobník alokovaný
+    if(precStackList == NULL || precStackList->count == 0) {
+        return NULL;
+    }
+
+    // Uzly pod počátečním indexem patří nadřazeným zásobníkům
+    size_t base = precStackList->bases[precStackList->count - 1];
+    if(precStackList->length - base <= distanceFromTop) {
+        return NULL;
+    }
+
+    return &precStackList->nodes[precStackList->length - 1 - distanceFromTop];
+} // precStack_peek()
+
 /**
  * @brief Uvolní všechny zdroje spojené s uzlem @c PrecStackNode.
  */
@@ -392,9 +408,9 @@ void precStack_freeNode(PrecStackNode *stackNode) {
         }
     }
 
-    // Uvolnění samotného uzlu "PrecStackNode"stackNode
-    free(stackNode);
-    stackNode = NULL;
+    // Uzel již neodkazuje na žádný AST uzel
+    stackNode->nodeType = SN_WITHOUT_AST_TYPE;
+    stackNode->node = SN_WITHOUT_AST_PTR;
 } // precStack_freeNode()
 
 /**
@@ -402,35 +418,38 @@ void precStack_freeNode(PrecStackNode *stackNode) {
  */
 void precStack_getTopPrecTerminal(PrecTerminals *topTerminal) {
     // Kontrolujem platnost přijatého ukazatele a struktur zásobníku
-    if(topTerminal == NULL || precStackList == NULL || precStackList->stack == NULL) {
+    if(topTerminal == NULL || precStackList == NULL || precStackList->count == 0) {
         parser_errorWatcher(SET_ERROR_SYNTAX);
-        *topTerminal = T_PREC_UNDEFINED;
+        if(topTerminal != NULL) {
+            *topTerminal = T_PREC_UNDEFINED;
+        }
         return;
     }
 
-    // Získání vrcholu zásobníku
-    PrecStackNode* stackTopNode = precStack_top();
-
     // Pokud je zásobník prázdný nastala syntaktická chyba
-    if(stackTopNode == NULL) {
+    if(precStack_isEmpty()) {
         parser_errorWatcher(SET_ERROR_SYNTAX);
         *topTerminal = T_PREC_UNDEFINED;
         return;
     }
 
     // Cyklíme, dokud nenajdeme první terminál na zásobníku
-    while(stackTopNode != NULL && stackTopNode->symbolType != STACK_NODE_TYPE_TERMINAL) {
-        stackTopNode = stackTopNode->next;
+    size_t distanceFromTop = 0;
+    PrecStackNode *stackNode = precStack_peek(distanceFromTop);
+
+    while(stackNode != NULL && stackNode->symbolType != STACK_NODE_TYPE_TERMINAL) {
+        stackNode = precStack_peek(++distanceFromTop);
     }
 
     // Pokud nebyl na zásobníku teminál nalezen, nastala interní chyba překladače
-    if(stackTopNode == NULL) {
+    if(stackNode == NULL) {
         parser_errorWatcher(SET_ERROR_INTERNAL);
         *topTerminal = T_PREC_UNDEFINED;
+        return;
     }
 
     // Namapujeme zásobníkový symbol na typ precedenčního terminálu
-    precStack_mapStackSymbolToPrecTerminal(stackTopNode->symbol, topTerminal);
+    precStack_mapStackSymbolToPrecTerminal(stackNode->symbol, topTerminal);
 } // precStack_getTopPrecTerminal()
 
 
@@ -484,101 +503,61 @@ void precStack_getResult(AST_ExprNode **result) {
  *                                                                             *
  ******************************************************************************/
 
-/**
- * @brief Uvolní všechny uzly z globálního precedenčního zásobníku a
- *        inicializuje ho do počátečního stavu.
- */
-void precStack_dispose(PrecStack *stack) {
-    // Kontrola, že zásbník již není prázdný
-    if(stack == NULL) {
-        return;
-    }
-
-    // Sekvenční mazání prvků na zásobníku (bez AST uzlů)
-    while(stack->top != NULL) {
-        // Odložíme si prvek na smazání a jako nový vrchol zásobníku nastavíme následníka
-        PrecStackNode* toDelete = stack->top;
-        stack->top = toDelete->next;
-
-        // Uvolníme paměť pro aktuální vrvcholový prvek
-        free(toDelete);
-    }
-
-    // Uvolníme strukturu zásobníku a zaktualizjeme vrchol seznamu zásobníků
-    PrecStack *nextStack = stack->next;
-    free(stack);
-    precStackList->stack = nextStack;
-} // precStack_dispose()
-
-/**
- * @brief Uvolní všechny uzly z globálního precedenčního zásobníku pomocí
- *        funkce @c precStack_freeNode().
- */
-void precStack_purge(PrecStack *stack) {
-    // Kontrola, že zásobník není prázdný
-    if(stack == NULL) {
-        return;
-    }
-
-    // Sekvenční mazání prvků na zásobníku (včetně AST uzlů)
-    while(stack->top != NULL) {
-        // Uložíme ukazatel na další uzel před uvolněním aktuálního uzlu
-        PrecStackNode* toDelete = stack->top;
-        stack->top = toDelete->next;
-
-        // Uvolníme vrcholový uzel pomocí funkce precStack_freeNode
-        precStack_freeNode(toDelete);
-    }
-
-    // Uvolníme strukturu zásobníku a zaktualizjeme vrchol seznamu zásobníků
-    PrecStack *nextStack = stack->next;
-    free(stack);
-    precStackList->stack = nextStack;
-} // precStack_purge()
-
 /**
  * @brief Zkontroluje, zda je aktuální precedenční zásobník prázdný.
  */
 bool precStack_isEmpty() {
     // Kontrola, zda je zásobník alokovaný
-    if(precStackList == NULL || precStackList->stack == NULL) {
+    if(precStackList == NULL || precStackList->count == 0) {
         parser_errorWatcher(SET_ERROR_INTERNAL);
         return false;
     }
 
-    // Jinak zkontroluj existenci vrchního prvku
-    return (precStackList->stack->top == NULL);
+    // Jinak porovnej délku pole s počátečním indexem aktuálního zásobníku
+    return (precStackList->length == precStackList->bases[precStackList->count - 1]);
 } // precStack_isEmpty()
 
 /**
- * @brief Vytvoří nový zásobníkový uzel typu typu @c PrecStackNode.
+ * @brief Vloží uzel na vrchol aktuálního precedenčního zásobníku.
  */
-PrecStackNode *precStack_createStackNode() {
+bool precStack_pushNode(PrecStackNode stackNode) {
     // Kontrola, zda je zásobník alokovaný
-    if(precStackList == NULL || precStackList->stack == NULL) {
+    if(precStackList == NULL || precStackList->count == 0) {
         parser_errorWatcher(SET_ERROR_INTERNAL);
-        return NULL;
+        return false;
     }
 
-    // Alokujeme paměť pro nový uzel typu "PrecStackNode"
-    PrecStackNode *node = (PrecStackNode *)malloc(sizeof(PrecStackNode));
-
-    // Pokud se alokace nezdařila, hlásíme interní chybu překladače
-    if(node == NULL) {
-        parser_errorWatcher(SET_ERROR_INTERNAL);
-        return NULL;
+    // Zajistíme místo pro nový uzel
+    if(!precStack_reserveNode()) {
+        return false;
     }
 
-    // Počáteční inicializace členů uzlu
-    node->symbolType = STACK_NODE_TYPE_UNDEFINED;
-    node->symbol = PREC_STACK_SYM_UNEDFINED;
-    node->nodeType = SN_WITHOUT_AST_TYPE;
-    node->node = SN_WITHOUT_AST_PTR;
-    node->next = NULL;
+    precStackList->nodes[precStackList->length++] = stackNode;
+
+    return true;
+} // precStack_pushNode()
+
+/**
+ * @brief Zajistí, že pole uzlů pojme alespoň jeden další uzel.
+ */
+bool precStack_reserveNode() {
+    // Pokud došla kapacita pole, tak jej rozšíříme
+    if(precStackList->length == precStackList->allocated) {
+        size_t allocated = (precStackList->allocated == 0) ? PREC_STACK_INIT_SIZE : \
+                           precStackList->allocated * PREC_STACK_EXPAND_FACTOR;
+        PrecStackNode *nodes = realloc(precStackList->nodes, allocated * sizeof(PrecStackNode));
+
+        if(nodes == NULL) {
+            parser_errorWatcher(SET_ERROR_INTERNAL);
+            return false;
+        }
+
+        precStackList->nodes = nodes;
+        precStackList->allocated = allocated;
+    }
 
-    // Vracíme ukazatel na nový uzel typu "PrecStackNode"
-    return node;
-} // precStack_createStackNode()
+    return true;
+} // precStack_reserveNode()
 
 /**
  * @brief Namapuje typ precedenčního terminálu na typ zásobníkového symbolu.
@@ -47,6 +47,10 @@
 #define SN_WITHOUT_AST_PTR  NULL                    /**<  Uzel `PrecStackNode` neobsahuje ukazatel na AST uzel.  */
 #define SN_WITHOUT_AST_TYPE AST_NODE_UNDEFINED      /**<  Uzel `PrecStackNode` nemá definovaný typ AST uzlu.     */
 
+#define PREC_STACK_INIT_SIZE        64      /**<  Počáteční kapacita pole uzlů precedenčních zásobníků      */
+#define PREC_STACK_LIST_INIT_SIZE   8       /**<  Počáteční kapacita pole počátečních indexů zásobníků      */
+#define PREC_STACK_EXPAND_FACTOR    2       /**<  Koeficient rozšíření polí při nedostatku kapacity         */
+
 
 /*******************************************************************************
  *                                                                             *
@@ -131,10 +135,11 @@ typedef enum PrecStackNodeType {
  *
  * @details Tato struktura reprezentuje jeden uzel na precedenčním zásobníku.
  *          Každý uzel obsahuje informace o typu symbolu (terminál/neterminál/handle),
- *          samotný symbol, typ uzlu v AST, ukazatel na uzel AST spojený s tímto
- *          symbolem a ukazatel na další uzel na zásobníku. AST uzly obsahují
- *          pouze zásobníkové uzly obsahující identifikátor, literál nebo
- *          neterminál pro výraz či seznam argumentů funkce.
+ *          samotný symbol, typ uzlu v AST a ukazatel na uzel AST spojený s tímto
+ *          symbolem. AST uzly obsahují pouze zásobníkové uzly obsahující
+ *          identifikátor, literál nebo neterminál pro výraz či seznam argumentů
+ *          funkce. Uzly jsou uloženy za sebou v poli, a proto neobsahují
+ *          ukazatel na další uzel.
  *
  * @note - AST = abstraktní syntaktický strom
  */
@@ -143,33 +148,30 @@ typedef struct PrecStackNode {
     PrecStackSymbol      symbol;           /**< Terminál nebo neterminál uložený v uzlu                     */
     AST_NodeType         nodeType;         /**< Typ AST uzlu                                                */
     void                 *node;            /**< Ukazatel na uzel AST spojený s terminálem nebo neterminálem */
-    struct PrecStackNode *next;            /**< Ukazatel na další uzel na zásobníku                         */
 } PrecStackNode;
 
-/**
- * @brief Struktura reprezentující jeden precedenční zásobník.
- *
- * @details Tato struktura reprezentuje celý precedenční zásobník. Obsahuje
- *          ukazatel na vrchol zásobníku, což umožňuje efektivní provádění
- *          operací push, pop a top.
- */
-typedef struct PrecStack {
-    PrecStackNode *top;             /**< Ukazatel na vrchol zásobníku         */
-    struct PrecStack *next;         /**< Ukazatel na další zásobník v seznamu */
-} PrecStack;
-
 /**
  * @brief Struktura reprezentující seznam precedenčních zásobníků.
  *
- * @details Obsahuje ukazatel na aktuální zásobník používaný během analýzy.
+ * @details Uzly všech precedenčních zásobníků leží v jednom souvislém poli
+ *          @c nodes. Každý zásobník (kontext analýzy jednoho výrazu) začíná
+ *          na indexu uloženém v poli @c bases, kde leží jeho počáteční
+ *          "dollar" symbol. Vnořená analýza výrazu (např. argumentu volání
+ *          funkce) tak nový zásobník nealokuje, ale pouze uloží jeho počáteční
+ *          index. Odebrání zásobníku znamená vrátit délku pole na tento index.
  *
  * @note Nejedná se ani tolik o seznam precedenčních zásobníků než spíše
- *       o zásobník všech aktuálně alokovaných precedenčních zásobníků.
+ *       o zásobník všech aktuálně rozpracovaných precedenčních zásobníků.
  *       Pojem "seznam" jsem zvolil s cílem lépe rozlišit jednotlivé struktury
  *       a příslušné funkce.
  */
 typedef struct PrecStackList {
-    PrecStack *stack;               /**< Ukazatel na aktuální (nejvrchnější) zásobník v seznamu */
+    PrecStackNode *nodes;           /**< Souvislé pole uzlů všech zásobníků                  */
+    size_t length;                  /**< Počet uzlů v poli                                   */
+    size_t allocated;               /**< Kapacita pole uzlů                                  */
+    size_t *bases;                  /**< Počáteční indexy jednotlivých zásobníků v poli uzlů */
+    size_t count;                   /**< Počet zásobníků v seznamu                           */
+    size_t basesAllocated;          /**< Kapacita pole počátečních indexů                    */
 } PrecStackList;
 
 /*******************************************************************************
@@ -198,43 +200,48 @@ extern struct PrecStackList *precStackList;
  * @brief Inicializuje globální seznam precedenčních zásobníků.
  *
  * @details Tato funkce alokuje paměť pro globální seznam precedenčních zásobníků
- *          a inicializuje jej. Pokud se alokace nezdaří, hlásí interní chybu.
+ *          a inicializuje jej jako prázdný. Pole uzlů se alokuje až při
+ *          vložení prvního zásobníku. Pokud se alokace nezdaří, hlásí interní
+ *          chybu.
  */
 void precStackList_create();
 
 /**
  * @brief Uvolní globální strukturu seznamu zásobníků.
  *
- * @details Tato funkce uvolní paměť alokovanou pro globální seznam zásobníků.
- *          Pokud je seznam prázdný, funkce neprovádí žádnou akci.
+ * @details Tato funkce uvolní paměť alokovanou pro globální seznam zásobníků
+ *          včetně pole uzlů (bez uvolnění AST uzlů). Pokud seznam není
+ *          alokovaný, funkce neprovádí žádnou akci.
  */
 void precStackList_destroy();
 
 /**
  * @brief Přidá nový precedenční zásobník na vrchol seznamu a inicializuje jej.
  *
- * @details Tato funkce vytvoří nový precedenční zásobník, inicializuje jej a
- *          přidá jej na vrchol globálního seznamu zásobníků. Pokud se alokace
- *          nezdaří, hlásí interní chybu.
+ * @details Tato funkce uloží aktuální délku pole uzlů jako počáteční index
+ *          nového zásobníku a vloží na něj počáteční "dollar" symbol. Nový
+ *          zásobník se nealokuje, pole se pouze v případě potřeby rozšíří.
+ *          Pokud se rozšíření nezdaří, hlásí interní chybu.
  */
 void precStackList_push();
 
 /**
  * @brief Odebere a uvolní vrcholový zásobník ze seznamu (bez uvolnění AST uzlů).
  *
- * @details Tato funkce odebere vrcholový zásobník ze seznamu a uvolní jeho paměť,
- *          aniž by uvolnila paměť pro uzly abstraktního syntaktického stromu (AST).
- *          Pokud je seznam prázdný, funkce neprovádí žádnou akci.
+ * @details Tato funkce odebere vrcholový zásobník ze seznamu tím, že vrátí
+ *          délku pole uzlů na jeho počáteční index. Paměť pro uzly abstraktního
+ *          syntaktického stromu (AST) neuvolňuje. Pokud je seznam prázdný,
+ *          funkce neprovádí žádnou akci.
  */
 void precStackList_pop();
 
 /**
  * @brief Uvolní všechny zásobníky a jejich obsah ze seznamu
- *        pomocí @c precStack_purge() (včetně uvolnění AST uzlů).
+ *        pomocí @c precStack_freeNode() (včetně uvolnění AST uzlů).
  *
- * @details Tato funkce uvolní všechny zásobníky ze seznamu pomocí funkce
- *          @c precStack_purge(). Pokud je seznam prázdný, funkce neprovádí
- *          žádnou akci.
+ * @details Tato funkce uvolní AST uzly všech uzlů v poli pomocí funkce
+ *          @c precStack_freeNode() a poté uvolní celý seznam zásobníků.
+ *          Pokud seznam není alokovaný, funkce neprovádí žádnou akci.
  */
 void precStackList_purge();
 
@@ -279,44 +286,78 @@ void precStack_pushPrecNonTerminal(PrecStackNonTerminals symbol, AST_NodeType ty
  */
 void precStack_pushBothStackAndASTNode(PrecTerminals inTerminal);
 
+/**
+ * @brief Vytvoří AST uzel pro identifikátor nebo literál z aktuálního terminálu.
+ *
+ * @details Uzel přebírá hodnotu aktuálního terminálu. Funkci využívá jak
+ *          precedenční zásobník, tak analyzátor výrazů metodou Pratt.
+ *
+ * @param [in] terminal Typ terminálu, pro který se uzel vytváří.
+ * @param [out] nodeType Typ vytvořeného uzlu (`AST_VAR_NODE`, `AST_LITERAL_NODE`
+ *                       nebo `SN_WITHOUT_AST_TYPE`).
+ *
+ * @return Ukazatel na vytvořený uzel, nebo `SN_WITHOUT_AST_PTR`, pokud terminál
+ *         není identifikátorem ani literálem.
+ */
+void *precStack_createOperandNode(PrecTerminals terminal, AST_NodeType *nodeType);
+
 /**
  * @brief Vloží handle za první terminál na zásobníku.
  *
  * @details Tato funkce najde první terminál na zásobníku a vloží za něj handle.
- *          Pokud není zásobník alokovaný nebo neobsahuje žádný terminál, hlásí
- *          interní chybu.
+ *          Uzly nad terminálem (nejvýše jeden neterminál) posune v poli o jednu
+ *          pozici výše. Pokud není zásobník alokovaný nebo neobsahuje žádný
+ *          terminál, hlásí interní chybu.
  */
 void precStack_pushHandleAfterFirstTerminal();
 
 /**
- * @brief Odebere uzel AST z globálního precedenčního zásobníku.
+ * @brief Odebere uzel z globálního precedenčního zásobníku.
  *
- * @details Tato funkce odstraní vrcholový element ze zásobníku a vrátí
- *          ukazatel na tento uzel. Pokud je zásobník prázdný, vrátí @c NULL.
+ * @details Tato funkce odstraní vrcholový element ze zásobníku a vrátí jeho
+ *          kopii. Odebraný uzel není třeba uvolňovat, případný AST uzel v něm
+ *          však přechází do vlastnictví volajícího. Pokud je zásobník prázdný,
+ *          hlásí interní chybu a vrátí uzel bez AST uzlu.
  *
- * @return Ukazatel na odebraný uzel, nebo @c NULL pokud je zásobník prázdný.
+ * @return Kopie odebraného uzlu.
  */
-PrecStackNode *precStack_pop();
+PrecStackNode precStack_pop();
 
 /**
  * @brief Získá ukazatel na uzel na vrcholu globálního precedenčního zásobníku
  *        bez jeho odebrání ze zásobníku.
  *
  * @details Tato funkce vrátí ukazatel na vrcholový element zásobníku bez jeho
- *          odstranění. Pokud je zásobník prázdný, hlásí interní chybu.
+ *          odstranění. Ukazatel je platný do dalšího vložení na zásobník.
+ *          Pokud není zásobník alokovaný, hlásí interní chybu.
  *
  * @return Ukazatel na vrcholový uzel zásobníku, nebo @c NULL pokud je zásobník
  *         prázdný.
  */
 PrecStackNode *precStack_top();
 
+/**
+ * @brief Získá ukazatel na uzel v dané vzdálenosti od vrcholu aktuálního
+ *        zásobníku.
+ *
+ * @details Ukazatel je platný do dalšího vložení na zásobník.
+ *
+ * @param [in] distanceFromTop Vzdálenost uzlu od vrcholu (`0` je vrchol).
+ *
+ * @return Ukazatel na uzel, nebo @c NULL, pokud aktuální zásobník tolik uzlů
+ *         nemá.
+ */
+PrecStackNode *precStack_peek(size_t distanceFromTop);
+
 /**
  * @brief Uvolní všechny zdroje spojené s uzlem @c PrecStackNode.
  *
- * @details Tato funkce uvolní všechny zdroje spojené s uzlem @c PrecStackNode,
- *          včetně volání funkce @c AST_destroyNode() pro uvolnění `void *node`.
+ * @details Tato funkce uvolní AST uzel spojený s uzlem @c PrecStackNode pomocí
+ *          funkce @c AST_destroyNode(), resp. @c AST_destroyArgOrParamList().
+ *          Samotný uzel leží v poli zásobníků, a proto se neuvolňuje.
  *
- * @param [in] stackNode Ukazatel na uzel @c PrecStackNode, který má být uvolněn.
+ * @param [in] stackNode Ukazatel na uzel @c PrecStackNode, jehož zdroje mají
+ *                       být uvolněny.
  */
 void precStack_freeNode(PrecStackNode *stackNode);
 
@@ -360,49 +401,36 @@ void precStack_getResult(AST_ExprNode **result);
  ******************************************************************************/
 
 /**
- * @brief Uvolní všechny uzly z globálního precedenčního zásobníku.
+ * @brief Zkontroluje, zda je aktuální precedenční zásobník prázdný.
  *
- * @details Tato funkce uvolní veškerou paměť alokovanou pro uzly zásobníku,
- *          ale obsažené uzly AST nechává alokované.
+ * @details Tato funkce kontroluje, zda je zásobník prázdný tím, že porovná
+ *          délku pole uzlů s počátečním indexem aktuálního zásobníku.
  *
- * @param stack Ukazatel na zásobník, který má být uvolněn.
+ * @return @c true, pokud je zásobník prázdný, jinak @c false.
  */
-void precStack_dispose(PrecStack *stack);
-
+bool precStack_isEmpty();
 
 /**
- * @brief Uvolní všechny uzly z globálního precedenčního zásobníku pomocí
- *        funkce @c precStack_freeNode().
+ * @brief Vloží uzel na vrchol aktuálního precedenčního zásobníku.
  *
- * @details Tato funkce uvolní všechny uzly z globálního precedenčního zásobníku
- *          pomocí funkce @c precStack_freeNode(). Uvolňuje tedy zásobníkové
- *          uzly včetně případných AST uzlů uvnitř nich.
+ * @details Pokud došla kapacita pole uzlů, funkce jej rozšíří. Pokud není
+ *          zásobník alokovaný nebo se rozšíření nezdaří, hlásí interní chybu.
  *
- * @param stack Ukazatel na zásobník, který má být uvolněn.
- */
-void precStack_purge(PrecStack *stack);
-
-/**
- * @brief Zkontroluje, zda je aktuální precedenční zásobník prázdný.
+ * @param [in] stackNode Vkládaný uzel.
  *
- * @details Tato funkce kontroluje, zda je zásobník prázdný tím, že ověří, zda
- *          ukazatel na vrchol zásobníku (top) je @c NULL.
- *
- * @return @c true, pokud je zásobník prázdný, jinak @c false.
+ * @return @c true, pokud byl uzel vložen, jinak @c false.
  */
-bool precStack_isEmpty();
+bool precStack_pushNode(PrecStackNode stackNode);
 
 /**
- * @brief Vytvoří nový zásobníkový uzel typu typu @c PrecStackNode.
+ * @brief Zajistí, že pole uzlů pojme alespoň jeden další uzel.
  *
- * @details Tato funkce alokuje paměť pro nový uzel typu @c PrecStackNode
- *          a inicializuje jeho členy na výchozí hodnoty. Pokud se alokace
- *          paměti nezdaří, funkce hlásí interní chybu a vrácí @c NULL.
+ * @details Pokud došla kapacita pole uzlů, zvětší ji @c PREC_STACK_EXPAND_FACTOR
+ *          krát. Pokud se rozšíření nezdaří, hlásí interní chybu.
  *
- * @return Ukazatel na nově vytvořený uzel typu @c PrecStackNode,
- *         nebo @c NULL v případě chyby alokace.
+ * @return @c true, pokud je v poli volné místo, jinak @c false.
  */
-PrecStackNode *precStack_createStackNode();
+bool precStack_reserveNode();
 
 /**
  * @brief Namapuje typ precedenčního terminálu na typ zásobníkového symbolu.
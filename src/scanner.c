@@ -32,8 +32,44 @@
 
 
 #include "scanner.h"
+#include "scanner_dfa.h"
+#include "scanner_input.h"
 #include "parser_common.h"
 
+/*******************************************************************************
+ *                                                                             *
+ *                          TABULKA TYPŮ ZNAKŮ SCANNERU                        *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Typ znaku (@c CharType) pro každou hodnotu bajtu.
+ *
+ * @details Hodnota `0` označuje řídicí znak, který do jazyka nepatří vůbec
+ *          (ani do komentáře). Ostatní hodnoty odpovídají výčtu @c CharType:
+ *          1 = LETTER, 2 = NUMBER, 3 = WHITESPACE, 4 = NOT_IN_LANGUAGE,
+ *          5 = SIMPLE, 6 = COMPLEX.
+ */
+static const unsigned char scannerCharTypeTable[SCANNER_CHAR_TABLE_SIZE] = {
+    /* 0x00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 0, 0,
+    /* 0x10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    /* 0x20 */ 3, 6, 6, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 6, 6,
+    /* 0x30 */ 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 5, 5, 6, 6, 6, 6,
+    /* 0x40 */ 6, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    /* 0x50 */ 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 6, 6, 6, 4, 1,
+    /* 0x60 */ 4, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    /* 0x70 */ 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 5, 5, 5, 4, 4,
+    /* 0x80 */ 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    /* 0x90 */ 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    /* 0xA0 */ 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    /* 0xB0 */ 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    /* 0xC0 */ 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    /* 0xD0 */ 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    /* 0xE0 */ 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    /* 0xF0 */ 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+};
+
+
 /*******************************************************************************
  *                                                                             *
  *                        IMPLEMENTACE VEŘEJNÝCH FUNKCÍ                        *
@@ -44,7 +80,11 @@
  * @brief Získá jeden Token.
  */
 inline Token scanner_getNextToken() {
+#if SCANNER_USE_DFA
+    return scannerDFA_FSM();
+#else
     return scanner_FSM();
+#endif
 }  // scanner_getNextToken()
 
 
@@ -91,6 +131,11 @@ Token scanner_FSM() {
 
             // Pokud znak je bílý znak
             case WHITESPACE:
+                // Na načteném vstupu přeskočíme všechny další bílé znaky najednou
+                if(scannerInput.buffered) {
+                    scannerInput.position = scannerInput_skipWhitespace(scannerInput.data,
+                                                scannerInput.position, scannerInput.length);
+                }
                 break;
 
             // Pokud znak není v jazyce
@@ -146,138 +191,148 @@ Token scanner_FSM() {
  * @brief Rozhodne o identitě znaku.
  */
 CharType scanner_charIdentity(int c) {
-    // Pokud je c písmeno nebo podtržítko
-    if(isalpha(c) || c == '_') {
-        return LETTER;
-    }
-
-    // Pokud je c číslice
-    else if(isdigit(c)) {
-        return NUMBER;
-    }
-
-    // Pokud je c bílý znak
-    else if(isspace(c)) {
-        return WHITESPACE;
+    // Pokud je c EOF
+    if(c == EOF) {  // c je konec souboru
+        return CHAR_EOF;
     }
 
-    // Pokud je c znak, který nepatří do jazyka
-    else if(c == '#' || c == '$' || c == '%' ||
-            c == '&' || c == ASQ || c == '^' ||
-            c == '`' || c == '~' || c >= ADL) {
+    // Hodnoty nad rozsahem bajtu nepatří do jazyka
+    if(c >= SCANNER_CHAR_TABLE_SIZE) {
         return NOT_IN_LANGUAGE;
     }
 
-    // Pokud je c jednouduchý operátor
-    else if(c == '(' || c == ')' || c == '*' ||
-            c == '+' || c == ',' || c == '-' ||
-            c == ':' || c == ';' || c == '{' ||
-            c == '|' || c == '}') { // c je speciální jednoduchý symbol
-                                    // (special SIMPLE)
-        return SIMPLE;
-    }
-
-    // Pokud je c složitý operátor
-    else if(c == '!' || c == '"' || c == '.' ||
-            c == '/' || c == '<' || c == '=' ||
-            c == '>' || c == '?' || c == '@' ||
-            c == '[' || c == ABS || c == ']') { // c je specialní složitý symbol
-                                                // (special COMPLEX)
-        return COMPLEX;
-    }
-
-    // Pokud je c EOF
-    else if(c == EOF) {  // c je konec souboru
+    // Záporné hodnoty (kromě EOF) nejsou platným znakem
+    if(c < 0) {
+        parser_errorWatcher(SET_ERROR_LEXICAL);
         return CHAR_EOF;
     }
 
-    // Pokud je c není ani jedno z výše uvedených
-    else {
-        // c nespadá do žádné ze skupin znaků, jedná se o chybu
+    // Typ znaku určíme jediným přístupem do tabulky
+    unsigned char type = scannerCharTypeTable[c];
+
+    // Pokud je c řídicí znak, který nespadá do žádné ze skupin, jedná se o chybu
+    if(type == 0) {
         parser_errorWatcher(SET_ERROR_LEXICAL);
         return CHAR_EOF;    // V případě erroru dává smysl sem vložit návratovou
                             // hodnotu EOF
     }
+
+    return (CharType)type;
 }  // scanner_charIdentity()
 
 /**
  * @brief V rámci FSM rozhodne o tom, zda je načtený řetězec znaků klíčovým slovem.
  */
 Token scanner_isKeyword(DString *value) {
-    // Pokud je ve stringu value "const"
-    if     (strcmp(value->str, "const") == 0) {
-        return scanner_stringlessTokenCreate(TOKEN_K_const);
-    }
-
-    // Pokud je ve stringu value "var"
-    else if(strcmp(value->str, "var") == 0) {
-        return scanner_stringlessTokenCreate(TOKEN_K_var);
-    }
-
-    // Pokud je ve stringu value "i32"
-    else if(strcmp(value->str, "i32") == 0) {
-        return scanner_stringlessTokenCreate(TOKEN_K_i32);
-    }
-
-    // Pokud je ve stringu value "f64"
-    else if(strcmp(value->str, "f64") == 0) {
-        return scanner_stringlessTokenCreate(TOKEN_K_f64);
-    }
-
-    // Pokud je ve stringu value "pub"
-    else if(strcmp(value->str, "pub") == 0) {
-        return scanner_stringlessTokenCreate(TOKEN_K_pub);
-    }
-
-    // Pokud je ve stringu value "fn"
-    else if(strcmp(value->str, "fn") == 0) {
-        return scanner_stringlessTokenCreate(TOKEN_K_fn);
-    }
-
-    // Pokud je ve stringu value "void"
-    else if(strcmp(value->str, "void") == 0) {
-        return scanner_stringlessTokenCreate(TOKEN_K_void);
-    }
-
-    // Pokud je ve stringu value "return"
-    else if(strcmp(value->str, "return") == 0) {
-        return scanner_stringlessTokenCreate(TOKEN_K_return);
-    }
+    const char *str = value->str;
+    TokenType keyword = TOKEN_IDENTIFIER;
+
+    /*
+     * Klíčová slova jsou rozlišena podle délky a prvního znaku, takže
+     * identifikátor je porovnán nejvýše s jedním kandidátem (místo postupného
+     * porovnání se všemi 14 klíčovými slovy).
+     */
+    switch(value->length) {
+        case 1:
+            if(str[0] == '_') {
+                keyword = TOKEN_K_underscore;
+            }
+            break;
 
-    // Pokud je ve stringu value "null"
-    else if(strcmp(value->str, "null") == 0) {
+        case 2:
+            if(str[0] == 'f' && str[1] == 'n') {
+                keyword = TOKEN_K_fn;
+            }
+            else if(str[0] == 'i' && str[1] == 'f') {
+                keyword = TOKEN_K_if;
+            }
+            break;
 
-        return scanner_stringlessTokenCreate(TOKEN_K_null);
-    }
-    // Pokud je ve stringu value "if"
-    else if(strcmp(value->str, "if") == 0) {
-        return scanner_stringlessTokenCreate(TOKEN_K_if);
-    }
+        case 3:
+            switch(str[0]) {
+                case 'v':
+                    if(memcmp(str, "var", 3) == 0) {
+                        keyword = TOKEN_K_var;
+                    }
+                    break;
+                case 'f':
+                    if(memcmp(str, "f64", 3) == 0) {
+                        keyword = TOKEN_K_f64;
+                    }
+                    break;
+                case 'p':
+                    if(memcmp(str, "pub", 3) == 0) {
+                        keyword = TOKEN_K_pub;
+                    }
+                    break;
+                case 'i':
+                    if(memcmp(str, "i32", 3) == 0) {
+                        keyword = TOKEN_K_i32;
+                    }
+                    else if(memcmp(str, "ifj", 3) == 0) {
+                        keyword = TOKEN_K_ifj;
+                    }
+                    break;
+                default:
+                    break;
+            }
+            break;
 
-    // Pokud je ve stringu value "else"
-    else if(strcmp(value->str, "else") == 0) {
-        return scanner_stringlessTokenCreate(TOKEN_K_else);
-    }
+        case 4:
+            switch(str[0]) {
+                case 'v':
+                    if(memcmp(str, "void", 4) == 0) {
+                        keyword = TOKEN_K_void;
+                    }
+                    break;
+                case 'n':
+                    if(memcmp(str, "null", 4) == 0) {
+                        keyword = TOKEN_K_null;
+                    }
+                    break;
+                case 'e':
+                    if(memcmp(str, "else", 4) == 0) {
+                        keyword = TOKEN_K_else;
+                    }
+                    break;
+                default:
+                    break;
+            }
+            break;
 
-    // Pokud je ve stringu value "while"
-    else if(strcmp(value->str, "while") == 0) {
-        return scanner_stringlessTokenCreate(TOKEN_K_while);
-    }
+        case 5:
+            switch(str[0]) {
+                case 'c':
+                    if(memcmp(str, "const", 5) == 0) {
+                        keyword = TOKEN_K_const;
+                    }
+                    break;
+                case 'w':
+                    if(memcmp(str, "while", 5) == 0) {
+                        keyword = TOKEN_K_while;
+                    }
+                    break;
+                default:
+                    break;
+            }
+            break;
 
-    // Pokud je ve stringu value "_"
-    else if(strcmp(value->str, "_") == 0) {
-        return scanner_stringlessTokenCreate(TOKEN_K_underscore);
-    }
+        case 6:
+            if(memcmp(str, "return", 6) == 0) {
+                keyword = TOKEN_K_return;
+            }
+            break;
 
-    // Pokud je ve stringu value "ifj"
-    else if(strcmp(value->str, "ifj") == 0) {
-        return scanner_stringlessTokenCreate(TOKEN_K_ifj);
+        default:
+            break;
     }
 
-    // Pokud je ve stringu value jiný řetězec znaků
-    else {
+    // Pokud nejde o klíčové slovo, jedná se o identifikátor
+    if(keyword == TOKEN_IDENTIFIER) {
         return scanner_tokenCreate(TOKEN_IDENTIFIER, value);
     }
+
+    return scanner_stringlessTokenCreate(keyword);
 }  // scanner_isKeyword()
 
 /**
@@ -424,6 +479,16 @@ Token scanner_stateComplexQuotation(Token lexToken, DString *str) {
             --------------------------------------
             */
             case STATE12_DOUBLE_QUOTATION_MARKS:
+                // Na načteném vstupu připojíme úsek až po uvozovku nebo
+                // zpětné lomítko najednou
+                if(scannerInput.buffered) {
+                    size_t end = scannerInput_findStringEnd(scannerInput.data,
+                                     scannerInput.position, scannerInput.length);
+                    DString_appendChars(str, scannerInput.data + scannerInput.position,
+                                        end - scannerInput.position);
+                    scannerInput.position = end;
+                }
+
                 lexChar = scanner_getNextChar();  // Vstup jednoho znaku z STDIN
                 // Pokud lexChar je "
                 if(lexChar == '"') {
@@ -899,6 +964,18 @@ void scanner_stateComplexDoubleSlash() {
     bool lexStopFSM = false;
     // Abstraktně: cykluje, dokud nepřijde příkaz k zastavení FSM
     while(lexStopFSM == false) {
+        // Ověřený vstup neobsahuje neplatné znaky, komentář lze přeskočit
+        // rovnou po konec řádku
+        if(scannerInput.validated) {
+            scannerInput.position = scannerInput_findNewline(scannerInput.data,
+                                        scannerInput.position, scannerInput.length);
+        }
+        // Na neověřeném vstupu přeskočíme běžné znaky komentáře najednou, po
+        // znacích se zpracují až řídicí znaky (konec řádku, tabulátor, ...)
+        else if(scannerInput.buffered) {
+            scannerInput.position = scannerInput_findControl(scannerInput.data,
+                                        scannerInput.position, scannerInput.length);
+        }
 
         lexChar = scanner_getNextChar();  // Vstup jednoho znaku z STDIN
         // Abstraktně: vybírej podle typu znaku
@@ -1498,6 +1575,14 @@ Token scanner_stateLetters(Token lexToken, DString *str) {
  * @brief Získá znak ze vstupu programu.
  */
 inline int scanner_getNextChar() {
+    // Pokud je vstup načten v paměti, čteme z něj
+    if(scannerInput.buffered) {
+        if(scannerInput.position < scannerInput.length) {
+            return (unsigned char)scannerInput.data[scannerInput.position++];
+        }
+        return EOF;
+    }
+
     return getchar();
 } // scanner_getNextChar()
 
@@ -1505,6 +1590,14 @@ inline int scanner_getNextChar() {
  * @brief Vrátí potřebný znak zpět na vstup programu.
  */
 inline void scanner_ungetChar(int c) {
+    // Na načteném vstupu stačí vrátit pozici (EOF pozici neposouvá)
+    if(scannerInput.buffered) {
+        if(c != EOF && scannerInput.position > 0) {
+            scannerInput.position--;
+        }
+        return;
+    }
+
     ungetc(c, stdin);
 } // scanner_ungetChar()
 
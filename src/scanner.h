@@ -63,6 +63,8 @@
 #define HEXA_BASE 16            /**< Základem hexadecimální číslicové soustavy
                                      je číslo `16` */
 #define ASCII_VALUE_MAX 255     /**< Maximální ASCII hodnota */
+#define SCANNER_CHAR_TABLE_SIZE 256 /**< Počet položek tabulky typů znaků
+                                         (jedna pro každou hodnotu bajtu) */
 
 
 /*******************************************************************************
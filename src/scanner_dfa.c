@@ -0,0 +1,546 @@
+/*******************************************************************************
+ *                                                                             *
+ * Název projektu:   Implementace překladače imperativního jazyka IFJ24        *
+ *                                                                             *
+ * Soubor:           scanner_dfa.c                                             *
+ * Autor:            Farkašovský Lukáš  <xfarkal00>                            *
+ *                                                                             *
+ * Datum:            04.12.2024                                                *
+ * Poslední změna:   04.12.2024                                                *
+ *                                                                             *
+ * Tým:      Tým xkalinj00                                                     *
+ * Členové:  Farkašovský Lukáš    <xfarkal00>                                  *
+ *           Hýža Pavel           <xhyzapa00>                                  *
+ *           Kalina Jan           <xkalinj00>                                  *
+ *           Krejčí David         <xkrejcd00>                                  *
+ *                                                                             *
+ ******************************************************************************/
+/**
+ * @file scanner_dfa.c
+ * @author Farkašovský Lukáš \<xfarkal00>
+ *
+ * @brief Implementace tabulkově řízeného lexikálního analyzátoru.
+ * @details Automat čte znaky ze vstupu a podle tabulky přechodů provádí akce
+ *          nad hodnotou tokenu. Tabulky níže jsou výstupem generátoru
+ *          `parsing_table/scanner_dfa_maker.cpp` (`make run` v adresáři
+ *          `parsing_table`) a ručně se neupravují.
+ */
+
+#include "scanner_dfa.h"
+#include "parser_common.h"
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                       VYGENEROVANÉ TABULKY AUTOMATU                         *
+ *                                                                             *
+ ******************************************************************************/
+
+#define SCANNER_DFA_CLASS_COUNT 48
+
+static const uint8_t scannerDFA_classTable[SCANNER_DFA_INPUT_COUNT] = {
+     0,  1,  1,  1,  1,  1,  1,  1,  1,  1,  2,  3,  2,  2,  2,  1,
+     1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+     1,  4,  5,  6,  7,  7,  7,  7,  7,  8,  9, 10, 11, 12, 13, 14,
+    15, 16, 16, 17, 18, 19, 16, 20, 16, 21, 16, 22, 23, 24, 25, 26,
+    27, 28, 29, 29, 29, 29, 29, 29, 30, 30, 30, 30, 30, 30, 30, 30,
+    30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 31, 32, 33,  7,
+    30,  7, 29, 29, 29, 29, 34, 35, 30, 30, 36, 30, 30, 30, 37, 38,
+    39, 40, 30, 41, 30, 42, 43, 30, 30, 44, 30, 30, 45, 46, 47,  7,
+     7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+     7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+     7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+     7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+     7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+     7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+     7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+     7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,
+     7,
+};
+
+static const ScannerDFA_Transition scannerDFA_table[DFA_STATE_COUNT][SCANNER_DFA_CLASS_COUNT] = {
+    /* DFA_START */
+    {
+        { 0,9,25}, { 0,0, 0}, { 0,1, 0}, { 0,1, 0}, { 0,1, 0}, { 7,1, 0}, {31,1, 0}, { 0,0, 0}, 
+        { 0,8, 5}, { 0,8, 6}, { 0,8, 7}, { 0,8, 8}, { 0,8, 9}, { 0,8,10}, { 0,8,16}, {11,1, 0}, 
+        { 2,2, 0}, { 2,2, 0}, { 2,2, 0}, { 2,2, 0}, { 2,2, 0}, { 2,2, 0}, { 0,8,11}, { 0,8,12}, 
+        { 8,1, 0}, {10,1, 0}, { 9,1, 0}, {23,1, 0}, {13,1, 0}, { 1,2, 0}, { 1,2, 0}, {20,1, 0}, 
+        {35,1, 0}, { 0,0, 0}, { 1,2, 0}, { 1,2, 0}, { 1,2, 0}, { 1,2, 0}, { 1,2, 0}, { 1,2, 0}, 
+        { 1,2, 0}, { 1,2, 0}, { 1,2, 0}, { 1,2, 0}, { 1,2, 0}, { 0,8,13}, { 0,8,14}, { 0,8,15}
+    },
+    /* DFA_IDENTIFIER */
+    {
+        { 0,9, 1}, { 0,0, 0}, { 0,8, 1}, { 0,8, 1}, { 0,8, 1}, { 0,9, 1}, { 0,9, 1}, { 0,0, 0}, 
+        { 0,9, 1}, { 0,9, 1}, { 0,9, 1}, { 0,9, 1}, { 0,9, 1}, { 0,9, 1}, { 0,9, 1}, { 0,9, 1}, 
+        { 1,2, 0}, { 1,2, 0}, { 1,2, 0}, { 1,2, 0}, { 1,2, 0}, { 1,2, 0}, { 0,9, 1}, { 0,9, 1}, 
+        { 0,9, 1}, { 0,9, 1}, { 0,9, 1}, { 0,9, 1}, { 0,9, 1}, { 1,2, 0}, { 1,2, 0}, { 0,9, 1}, 
+        { 0,9, 1}, { 0,9, 1}, { 1,2, 0}, { 1,2, 0}, { 1,2, 0}, { 1,2, 0}, { 1,2, 0}, { 1,2, 0}, 
+        { 1,2, 0}, { 1,2, 0}, { 1,2, 0}, { 1,2, 0}, { 1,2, 0}, { 0,9, 1}, { 0,9, 1}, { 0,9, 1}
+    },
+    /* DFA_INT */
+    {
+        { 0,9, 2}, { 0,0, 0}, { 0,8, 2}, { 0,8, 2}, { 0,8, 2}, { 0,9, 2}, { 0,9, 2}, { 0,0, 0}, 
+        { 0,9, 2}, { 0,9, 2}, { 0,9, 2}, { 0,9, 2}, { 0,9, 2}, { 0,9, 2}, { 3,2, 0}, { 0,9, 2}, 
+        { 2,2, 0}, { 2,2, 0}, { 2,2, 0}, { 2,2, 0}, { 2,2, 0}, { 2,2, 0}, { 0,9, 2}, { 0,9, 2}, 
+        { 0,9, 2}, { 0,9, 2}, { 0,9, 2}, { 0,9, 2}, { 0,9, 2}, { 0,0, 0}, { 0,0, 0}, { 0,9, 2}, 
+        { 0,9, 2}, { 0,9, 2}, { 5,2, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,9, 2}, { 0,9, 2}, { 0,9, 2}
+    },
+    /* DFA_FLOAT_PERIOD */
+    {
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 4,2, 0}, { 4,2, 0}, { 4,2, 0}, { 4,2, 0}, { 4,2, 0}, { 4,2, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}
+    },
+    /* DFA_FLOAT */
+    {
+        { 0,9, 3}, { 0,0, 0}, { 0,8, 3}, { 0,8, 3}, { 0,8, 3}, { 0,9, 3}, { 0,9, 3}, { 0,0, 0}, 
+        { 0,9, 3}, { 0,9, 3}, { 0,9, 3}, { 0,9, 3}, { 0,9, 3}, { 0,9, 3}, { 0,9, 3}, { 0,9, 3}, 
+        { 4,2, 0}, { 4,2, 0}, { 4,2, 0}, { 4,2, 0}, { 4,2, 0}, { 4,2, 0}, { 0,9, 3}, { 0,9, 3}, 
+        { 0,9, 3}, { 0,9, 3}, { 0,9, 3}, { 0,9, 3}, { 0,9, 3}, { 0,0, 0}, { 0,0, 0}, { 0,9, 3}, 
+        { 0,9, 3}, { 0,9, 3}, { 5,2, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,9, 3}, { 0,9, 3}, { 0,9, 3}
+    },
+    /* DFA_FLOAT_EXP */
+    {
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 6,2, 0}, { 0,0, 0}, { 6,2, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 6,2, 0}, { 6,2, 0}, { 6,2, 0}, { 6,2, 0}, { 6,2, 0}, { 6,2, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}
+    },
+    /* DFA_FLOAT_EXP_DIGITS */
+    {
+        { 0,9, 3}, { 0,0, 0}, { 0,8, 3}, { 0,8, 3}, { 0,8, 3}, { 0,9, 3}, { 0,9, 3}, { 0,0, 0}, 
+        { 0,9, 3}, { 0,9, 3}, { 0,9, 3}, { 0,9, 3}, { 0,9, 3}, { 0,9, 3}, { 0,9, 3}, { 0,9, 3}, 
+        { 6,2, 0}, { 6,2, 0}, { 6,2, 0}, { 6,2, 0}, { 6,2, 0}, { 6,2, 0}, { 0,9, 3}, { 0,9, 3}, 
+        { 0,9, 3}, { 0,9, 3}, { 0,9, 3}, { 0,9, 3}, { 0,9, 3}, { 0,0, 0}, { 0,0, 0}, { 0,9, 3}, 
+        { 0,9, 3}, { 0,9, 3}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,9, 3}, { 0,9, 3}, { 0,9, 3}
+    },
+    /* DFA_EXCLAMATION */
+    {
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,8,20}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}
+    },
+    /* DFA_LESS */
+    {
+        { 0,9,21}, { 0,9,21}, { 0,9,21}, { 0,9,21}, { 0,9,21}, { 0,9,21}, { 0,9,21}, { 0,9,21}, 
+        { 0,9,21}, { 0,9,21}, { 0,9,21}, { 0,9,21}, { 0,9,21}, { 0,9,21}, { 0,9,21}, { 0,9,21}, 
+        { 0,9,21}, { 0,9,21}, { 0,9,21}, { 0,9,21}, { 0,9,21}, { 0,9,21}, { 0,9,21}, { 0,9,21}, 
+        { 0,9,21}, { 0,8,22}, { 0,9,21}, { 0,9,21}, { 0,9,21}, { 0,9,21}, { 0,9,21}, { 0,9,21}, 
+        { 0,9,21}, { 0,9,21}, { 0,9,21}, { 0,9,21}, { 0,9,21}, { 0,9,21}, { 0,9,21}, { 0,9,21}, 
+        { 0,9,21}, { 0,9,21}, { 0,9,21}, { 0,9,21}, { 0,9,21}, { 0,9,21}, { 0,9,21}, { 0,9,21}
+    },
+    /* DFA_GREATER */
+    {
+        { 0,9,23}, { 0,9,23}, { 0,9,23}, { 0,9,23}, { 0,9,23}, { 0,9,23}, { 0,9,23}, { 0,9,23}, 
+        { 0,9,23}, { 0,9,23}, { 0,9,23}, { 0,9,23}, { 0,9,23}, { 0,9,23}, { 0,9,23}, { 0,9,23}, 
+        { 0,9,23}, { 0,9,23}, { 0,9,23}, { 0,9,23}, { 0,9,23}, { 0,9,23}, { 0,9,23}, { 0,9,23}, 
+        { 0,9,23}, { 0,8,24}, { 0,9,23}, { 0,9,23}, { 0,9,23}, { 0,9,23}, { 0,9,23}, { 0,9,23}, 
+        { 0,9,23}, { 0,9,23}, { 0,9,23}, { 0,9,23}, { 0,9,23}, { 0,9,23}, { 0,9,23}, { 0,9,23}, 
+        { 0,9,23}, { 0,9,23}, { 0,9,23}, { 0,9,23}, { 0,9,23}, { 0,9,23}, { 0,9,23}, { 0,9,23}
+    },
+    /* DFA_EQUAL */
+    {
+        { 0,9,17}, { 0,9,17}, { 0,9,17}, { 0,9,17}, { 0,9,17}, { 0,9,17}, { 0,9,17}, { 0,9,17}, 
+        { 0,9,17}, { 0,9,17}, { 0,9,17}, { 0,9,17}, { 0,9,17}, { 0,9,17}, { 0,9,17}, { 0,9,17}, 
+        { 0,9,17}, { 0,9,17}, { 0,9,17}, { 0,9,17}, { 0,9,17}, { 0,9,17}, { 0,9,17}, { 0,9,17}, 
+        { 0,9,17}, { 0,8,19}, { 0,9,17}, { 0,9,17}, { 0,9,17}, { 0,9,17}, { 0,9,17}, { 0,9,17}, 
+        { 0,9,17}, { 0,9,17}, { 0,9,17}, { 0,9,17}, { 0,9,17}, { 0,9,17}, { 0,9,17}, { 0,9,17}, 
+        { 0,9,17}, { 0,9,17}, { 0,9,17}, { 0,9,17}, { 0,9,17}, { 0,9,17}, { 0,9,17}, { 0,9,17}
+    },
+    /* DFA_SLASH */
+    {
+        { 0,9,18}, { 0,0, 0}, { 0,8,18}, { 0,8,18}, { 0,8,18}, { 0,9,18}, { 0,9,18}, { 0,0, 0}, 
+        { 0,9,18}, { 0,9,18}, { 0,9,18}, { 0,9,18}, { 0,9,18}, { 0,9,18}, { 0,9,18}, {12,1, 0}, 
+        { 0,9,18}, { 0,9,18}, { 0,9,18}, { 0,9,18}, { 0,9,18}, { 0,9,18}, { 0,9,18}, { 0,9,18}, 
+        { 0,9,18}, { 0,9,18}, { 0,9,18}, { 0,9,18}, { 0,9,18}, { 0,9,18}, { 0,9,18}, { 0,9,18}, 
+        { 0,9,18}, { 0,9,18}, { 0,9,18}, { 0,9,18}, { 0,9,18}, { 0,9,18}, { 0,9,18}, { 0,9,18}, 
+        { 0,9,18}, { 0,9,18}, { 0,9,18}, { 0,9,18}, { 0,9,18}, { 0,9,18}, { 0,9,18}, { 0,9,18}
+    },
+    /* DFA_COMMENT */
+    {
+        { 0,9,25}, { 0,0, 0}, {12,1, 0}, { 0,1, 0}, {12,1, 0}, {12,1, 0}, {12,1, 0}, {12,1, 0}, 
+        {12,1, 0}, {12,1, 0}, {12,1, 0}, {12,1, 0}, {12,1, 0}, {12,1, 0}, {12,1, 0}, {12,1, 0}, 
+        {12,1, 0}, {12,1, 0}, {12,1, 0}, {12,1, 0}, {12,1, 0}, {12,1, 0}, {12,1, 0}, {12,1, 0}, 
+        {12,1, 0}, {12,1, 0}, {12,1, 0}, {12,1, 0}, {12,1, 0}, {12,1, 0}, {12,1, 0}, {12,1, 0}, 
+        {12,1, 0}, {12,1, 0}, {12,1, 0}, {12,1, 0}, {12,1, 0}, {12,1, 0}, {12,1, 0}, {12,1, 0}, 
+        {12,1, 0}, {12,1, 0}, {12,1, 0}, {12,1, 0}, {12,1, 0}, {12,1, 0}, {12,1, 0}, {12,1, 0}
+    },
+    /* DFA_AT */
+    {
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, {14,1, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}
+    },
+    /* DFA_AT_I */
+    {
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, {15,1, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}
+    },
+    /* DFA_AT_IM */
+    {
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        {16,1, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}
+    },
+    /* DFA_AT_IMP */
+    {
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, {17,1, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}
+    },
+    /* DFA_AT_IMPO */
+    {
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, {18,1, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}
+    },
+    /* DFA_AT_IMPOR */
+    {
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, {19,1, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}
+    },
+    /* DFA_AT_IMPORT */
+    {
+        { 0,9,42}, { 0,0, 0}, { 0,8,42}, { 0,8,42}, { 0,8,42}, { 0,9,42}, { 0,9,42}, { 0,0, 0}, 
+        { 0,9,42}, { 0,9,42}, { 0,9,42}, { 0,9,42}, { 0,9,42}, { 0,9,42}, { 0,9,42}, { 0,9,42}, 
+        { 0,9,42}, { 0,9,42}, { 0,9,42}, { 0,9,42}, { 0,9,42}, { 0,9,42}, { 0,9,42}, { 0,9,42}, 
+        { 0,9,42}, { 0,9,42}, { 0,9,42}, { 0,9,42}, { 0,9,42}, { 0,0, 0}, { 0,0, 0}, { 0,9,42}, 
+        { 0,9,42}, { 0,9,42}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,9,42}, { 0,9,42}, { 0,9,42}
+    },
+    /* DFA_U8_A */
+    {
+        { 0,0, 0}, { 0,0, 0}, {20,1, 0}, {20,1, 0}, {20,1, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, {21,1, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}
+    },
+    /* DFA_U8_B */
+    {
+        { 0,0, 0}, { 0,0, 0}, {21,1, 0}, {21,1, 0}, {21,1, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, {22,1, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}
+    },
+    /* DFA_U8_C */
+    {
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,8,30}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}
+    },
+    /* DFA_QMARK */
+    {
+        { 0,0, 0}, { 0,0, 0}, {23,1, 0}, {23,1, 0}, {23,1, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, {28,1, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, {26,1, 0}, {24,1, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}
+    },
+    /* DFA_QMARK_I */
+    {
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, {25,1, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}
+    },
+    /* DFA_QMARK_I3 */
+    {
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,8,31}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}
+    },
+    /* DFA_QMARK_F */
+    {
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, {27,1, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}
+    },
+    /* DFA_QMARK_F6 */
+    {
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,8,32}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}
+    },
+    /* DFA_QMARK_U8_A */
+    {
+        { 0,0, 0}, { 0,0, 0}, {28,1, 0}, {28,1, 0}, {28,1, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, {29,1, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}
+    },
+    /* DFA_QMARK_U8_B */
+    {
+        { 0,0, 0}, { 0,0, 0}, {29,1, 0}, {29,1, 0}, {29,1, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, {30,1, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}
+    },
+    /* DFA_QMARK_U8_C */
+    {
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,8,33}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}
+    },
+    /* DFA_STRING */
+    {
+        { 0,0, 0}, {31,2, 0}, {31,2, 0}, {31,2, 0}, {31,2, 0}, {31,2, 0}, { 0,8, 4}, {31,2, 0}, 
+        {31,2, 0}, {31,2, 0}, {31,2, 0}, {31,2, 0}, {31,2, 0}, {31,2, 0}, {31,2, 0}, {31,2, 0}, 
+        {31,2, 0}, {31,2, 0}, {31,2, 0}, {31,2, 0}, {31,2, 0}, {31,2, 0}, {31,2, 0}, {31,2, 0}, 
+        {31,2, 0}, {31,2, 0}, {31,2, 0}, {31,2, 0}, {31,2, 0}, {31,2, 0}, {31,2, 0}, {31,2, 0}, 
+        {32,1, 0}, {31,2, 0}, {31,2, 0}, {31,2, 0}, {31,2, 0}, {31,2, 0}, {31,2, 0}, {31,2, 0}, 
+        {31,2, 0}, {31,2, 0}, {31,2, 0}, {31,2, 0}, {31,2, 0}, {31,2, 0}, {31,2, 0}, {31,2, 0}
+    },
+    /* DFA_STRING_ESCAPE */
+    {
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, {31,2, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        {31,2, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, {31,3, 0}, { 0,0, 0}, 
+        { 0,0, 0}, {31,4, 0}, {31,5, 0}, { 0,0, 0}, {33,1, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}
+    },
+    /* DFA_STRING_HEX_A */
+    {
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        {34,6, 0}, {34,6, 0}, {34,6, 0}, {34,6, 0}, {34,6, 0}, {34,6, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, {34,6, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, {34,6, 0}, {34,6, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}
+    },
+    /* DFA_STRING_HEX_B */
+    {
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        {31,7, 0}, {31,7, 0}, {31,7, 0}, {31,7, 0}, {31,7, 0}, {31,7, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, {31,7, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, {31,7, 0}, {31,7, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}
+    },
+    /* DFA_BACKSLASH */
+    {
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        {36,1, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}
+    },
+    /* DFA_ML_STRING */
+    {
+        { 0,0, 0}, {36,2, 0}, {36,2, 0}, {37,1, 0}, {36,2, 0}, {36,2, 0}, {36,2, 0}, {36,2, 0}, 
+        {36,2, 0}, {36,2, 0}, {36,2, 0}, {36,2, 0}, {36,2, 0}, {36,2, 0}, {36,2, 0}, {36,2, 0}, 
+        {36,2, 0}, {36,2, 0}, {36,2, 0}, {36,2, 0}, {36,2, 0}, {36,2, 0}, {36,2, 0}, {36,2, 0}, 
+        {36,2, 0}, {36,2, 0}, {36,2, 0}, {36,2, 0}, {36,2, 0}, {36,2, 0}, {36,2, 0}, {36,2, 0}, 
+        {36,2, 0}, {36,2, 0}, {36,2, 0}, {36,2, 0}, {36,2, 0}, {36,2, 0}, {36,2, 0}, {36,2, 0}, 
+        {36,2, 0}, {36,2, 0}, {36,2, 0}, {36,2, 0}, {36,2, 0}, {36,2, 0}, {36,2, 0}, {36,2, 0}
+    },
+    /* DFA_ML_STRING_LF */
+    {
+        { 0,9, 4}, { 0,9, 4}, { 0,9, 4}, { 0,9, 4}, {37,1, 0}, { 0,9, 4}, { 0,9, 4}, { 0,9, 4}, 
+        { 0,9, 4}, { 0,9, 4}, { 0,9, 4}, { 0,9, 4}, { 0,9, 4}, { 0,9, 4}, { 0,9, 4}, { 0,9, 4}, 
+        { 0,9, 4}, { 0,9, 4}, { 0,9, 4}, { 0,9, 4}, { 0,9, 4}, { 0,9, 4}, { 0,9, 4}, { 0,9, 4}, 
+        { 0,9, 4}, { 0,9, 4}, { 0,9, 4}, { 0,9, 4}, { 0,9, 4}, { 0,9, 4}, { 0,9, 4}, { 0,9, 4}, 
+        {38,1, 0}, { 0,9, 4}, { 0,9, 4}, { 0,9, 4}, { 0,9, 4}, { 0,9, 4}, { 0,9, 4}, { 0,9, 4}, 
+        { 0,9, 4}, { 0,9, 4}, { 0,9, 4}, { 0,9, 4}, { 0,9, 4}, { 0,9, 4}, { 0,9, 4}, { 0,9, 4}
+    },
+    /* DFA_ML_STRING_LF_BACKSLASH */
+    {
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        {36,3, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, 
+        { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}, { 0,0, 0}
+    }
+};
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                        IMPLEMENTACE VEŘEJNÝCH FUNKCÍ                        *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Tabulkově řízený automat scanneru.
+ */
+Token scannerDFA_FSM() {
+    DString *str = DString_init();
+    if(str == NULL) {
+        parser_errorWatcher(SET_ERROR_INTERNAL);
+        return scanner_init();
+    }
+
+    ScannerDFA_State state = DFA_START;
+    int hexHigh = 0;
+
+    // Cykluj, dokud automat nepřijme token nebo nenarazí na chybu
+    while(true) {
+        int lexChar = scanner_getNextChar();
+        const ScannerDFA_Transition *transition =
+            &scannerDFA_table[state][scannerDFA_charClass(lexChar)];
+
+        switch((ScannerDFA_Action)transition->action) {
+            case DFA_ACTION_SKIP:
+                break;
+
+            case DFA_ACTION_APPEND:
+                DString_appendChar(str, (char)lexChar);
+                break;
+
+            case DFA_ACTION_APPEND_LF:
+                DString_appendChar(str, '\n');
+                break;
+
+            case DFA_ACTION_APPEND_CR:
+                DString_appendChar(str, '\r');
+                break;
+
+            case DFA_ACTION_APPEND_TAB:
+                DString_appendChar(str, '\t');
+                break;
+
+            case DFA_ACTION_HEX_HIGH:
+                hexHigh = scannerDFA_hexDigitValue(lexChar);
+                break;
+
+            case DFA_ACTION_HEX_LOW:
+                DString_appendChar(str, (char)(hexHigh * HEXA_BASE +
+                                               scannerDFA_hexDigitValue(lexChar)));
+                break;
+
+            case DFA_ACTION_ACCEPT:
+                return scannerDFA_acceptToken((TokenType)transition->token, str);
+
+            case DFA_ACTION_ACCEPT_UNGET:
+                scanner_ungetChar(lexChar);
+                return scannerDFA_acceptToken((TokenType)transition->token, str);
+
+            // ERROR - načtený znak nelze v aktuálním stavu přijmout
+            case DFA_ACTION_ERROR:
+            default:
+                parser_errorWatcher(SET_ERROR_LEXICAL);
+                DString_free(str);
+                return scanner_init();
+        }
+
+        state = (ScannerDFA_State)transition->next;
+    }
+}  // scannerDFA_FSM()
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                        IMPLEMENTACE INTERNÍCH FUNKCÍ                        *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Vrátí třídu ekvivalence vstupního znaku.
+ */
+inline uint8_t scannerDFA_charClass(int c) {
+    // Index 0 patří znaku EOF, bajty jsou posunuty o jedna
+    if(c < EOF || c >= SCANNER_DFA_INPUT_COUNT - 1) {
+        return scannerDFA_classTable[0];
+    }
+
+    return scannerDFA_classTable[c + 1];
+}  // scannerDFA_charClass()
+
+/**
+ * @brief Vytvoří přijatý token z načtené hodnoty.
+ */
+Token scannerDFA_acceptToken(TokenType type, DString *str) {
+    switch(type) {
+        // Identifikátor může být klíčovým slovem
+        case TOKEN_IDENTIFIER: {
+            Token token = scanner_isKeyword(str);
+            if(token.value == NULL) {
+                DString_free(str);
+            }
+            return token;
+        }
+
+        // Tokeny s hodnotou
+        case TOKEN_INT:
+        case TOKEN_FLOAT:
+        case TOKEN_STRING:
+            return scanner_tokenCreate(type, str);
+
+        // Ostatní tokeny hodnotu nemají
+        default:
+            DString_free(str);
+            return scanner_stringlessTokenCreate(type);
+    }
+}  // scannerDFA_acceptToken()
+
+/**
+ * @brief Vrátí hodnotu hexadecimální číslice.
+ */
+int scannerDFA_hexDigitValue(int c) {
+    if(isdigit(c)) {
+        return c - '0';
+    }
+
+    return tolower(c) - 'a' + 10;
+}  // scannerDFA_hexDigitValue()
+
+/*** Konec souboru scanner_dfa.c ***/
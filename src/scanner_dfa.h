@@ -0,0 +1,200 @@
+/*******************************************************************************
+ *                                                                             *
+ * Název projektu:   Implementace překladače imperativního jazyka IFJ24        *
+ *                                                                             *
+ * Soubor:           scanner_dfa.h                                             *
+ * Autor:            Farkašovský Lukáš  <xfarkal00>                            *
+ *                                                                             *
+ * Datum:            04.12.2024                                                *
+ * Poslední změna:   04.12.2024                                                *
+ *                                                                             *
+ * Tým:      Tým xkalinj00                                                     *
+ * Členové:  Farkašovský Lukáš    <xfarkal00>                                  *
+ *           Hýža Pavel           <xhyzapa00>                                  *
+ *           Kalina Jan           <xkalinj00>                                  *
+ *           Krejčí David         <xkrejcd00>                                  *
+ *                                                                             *
+ ******************************************************************************/
+/**
+ * @file scanner_dfa.h
+ * @author Farkašovský Lukáš \<xfarkal00>
+ *
+ * @brief Hlavičkový soubor pro tabulkově řízený lexikální analyzátor.
+ * @details Alternativní backend scanneru. Místo ručně psaného automatu
+ *          v `scanner.c` prochází vygenerovanou tabulkou přechodů indexovanou
+ *          stavem a třídou ekvivalence vstupního znaku. Tabulku generuje
+ *          program `parsing_table/scanner_dfa_maker.cpp` ze specifikace
+ *          lexikálních pravidel. Výčty stavů a akcí v tomto souboru sdílí
+ *          generátor i scanner a musí tedy zůstat shodné.
+ */
+
+#ifndef SCANNER_DFA_H_
+/** @cond  */
+#define SCANNER_DFA_H_
+/** @endcond  */
+
+#include <stdint.h>
+#include "scanner.h"
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                             DEKLARACE KONSTANT                              *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Volba backendu scanneru.
+ *
+ * @note Používejte pouze následující hodnoty
+ * - @c true pro použití tabulkově řízeného automatu z `scanner_dfa.c`.
+ * - @c false pro použití ručně psaného automatu z `scanner.c`.
+ */
+#define SCANNER_USE_DFA false
+
+#define SCANNER_DFA_INPUT_COUNT 257 /**< Počet vstupů automatu (EOF a 256 hodnot bajtu) */
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                             VÝČTOVÉ DATOVÉ TYPY                             *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Stavy tabulkově řízeného automatu scanneru.
+ */
+typedef enum ScannerDFA_State {
+    DFA_START = 0,                  /**< Počáteční stav, přeskakuje bílé znaky a komentáře */
+    DFA_IDENTIFIER,                 /**< Identifikátor nebo klíčové slovo                  */
+    DFA_INT,                        /**< Celé číslo                                        */
+    DFA_FLOAT_PERIOD,               /**< Číslo po desetinné tečce                          */
+    DFA_FLOAT,                      /**< Desetinná část čísla                              */
+    DFA_FLOAT_EXP,                  /**< Číslo po znaku exponentu `e`                      */
+    DFA_FLOAT_EXP_DIGITS,           /**< Číslice exponentu                                 */
+    DFA_EXCLAMATION,                /**< Znak `!`                                          */
+    DFA_LESS,                       /**< Znak `<`                                          */
+    DFA_GREATER,                    /**< Znak `>`                                          */
+    DFA_EQUAL,                      /**< Znak `=`                                          */
+    DFA_SLASH,                      /**< Znak `/`                                          */
+    DFA_COMMENT,                    /**< Komentář `//` do konce řádku                      */
+    DFA_AT,                         /**< Znak `@`                                          */
+    DFA_AT_I,                       /**< `@i`                                              */
+    DFA_AT_IM,                      /**< `@im`                                             */
+    DFA_AT_IMP,                     /**< `@imp`                                            */
+    DFA_AT_IMPO,                    /**< `@impo`                                           */
+    DFA_AT_IMPOR,                   /**< `@impor`                                          */
+    DFA_AT_IMPORT,                  /**< `@import`                                         */
+    DFA_U8_A,                       /**< `[`                                               */
+    DFA_U8_B,                       /**< `[]`                                              */
+    DFA_U8_C,                       /**< `[]u`                                             */
+    DFA_QMARK,                      /**< `?`                                               */
+    DFA_QMARK_I,                    /**< `?i`                                              */
+    DFA_QMARK_I3,                   /**< `?i3`                                             */
+    DFA_QMARK_F,                    /**< `?f`                                              */
+    DFA_QMARK_F6,                   /**< `?f6`                                             */
+    DFA_QMARK_U8_A,                 /**< `?[`                                              */
+    DFA_QMARK_U8_B,                 /**< `?[]`                                             */
+    DFA_QMARK_U8_C,                 /**< `?[]u`                                            */
+    DFA_STRING,                     /**< Tělo řetězce `"..."`                              */
+    DFA_STRING_ESCAPE,              /**< Escape sekvence v řetězci                         */
+    DFA_STRING_HEX_A,               /**< První číslice sekvence `\xdd`                     */
+    DFA_STRING_HEX_B,               /**< Druhá číslice sekvence `\xdd`                     */
+    DFA_BACKSLASH,                  /**< Znak `\`                                          */
+    DFA_ML_STRING,                  /**< Řádek víceřádkového řetězce `\\`                  */
+    DFA_ML_STRING_LF,               /**< Začátek řádku po víceřádkovém řetězci             */
+    DFA_ML_STRING_LF_BACKSLASH,     /**< `\` na začátku řádku po víceřádkovém řetězci      */
+    DFA_STATE_COUNT                 /**< Počet stavů automatu                              */
+} ScannerDFA_State;
+
+/**
+ * @brief Akce provedené při přechodu automatu.
+ */
+typedef enum ScannerDFA_Action {
+    DFA_ACTION_ERROR = 0,           /**< Lexikální chyba                                   */
+    DFA_ACTION_SKIP,                /**< Znak se zahodí                                    */
+    DFA_ACTION_APPEND,              /**< Znak se připojí k hodnotě tokenu                  */
+    DFA_ACTION_APPEND_LF,           /**< K hodnotě tokenu se připojí `\n`                  */
+    DFA_ACTION_APPEND_CR,           /**< K hodnotě tokenu se připojí `\r`                  */
+    DFA_ACTION_APPEND_TAB,          /**< K hodnotě tokenu se připojí `\t`                  */
+    DFA_ACTION_HEX_HIGH,            /**< Uloží se horní půlbajt sekvence `\xdd`            */
+    DFA_ACTION_HEX_LOW,             /**< Připojí se znak sekvence `\xdd`                   */
+    DFA_ACTION_ACCEPT,              /**< Token je přijat, znak patří k tokenu              */
+    DFA_ACTION_ACCEPT_UNGET         /**< Token je přijat, znak se vrátí na vstup           */
+} ScannerDFA_Action;
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                             DEKLARACE STRUKTUR                              *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Jeden přechod automatu.
+ */
+typedef struct ScannerDFA_Transition {
+    uint8_t next;       /**< Následující stav (@c ScannerDFA_State)              */
+    uint8_t action;     /**< Prováděná akce (@c ScannerDFA_Action)               */
+    uint8_t token;      /**< Typ přijatého tokenu (@c TokenType) u akcí ACCEPT   */
+} ScannerDFA_Transition;
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                         DEKLARACE VEŘEJNÝCH FUNKCÍ                          *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Tabulkově řízený automat scanneru.
+ *
+ * @details Vrací stejné tokeny jako @c scanner_FSM(). Identifikátory jsou po
+ *          přijetí rozlišeny na klíčová slova funkcí @c scanner_isKeyword().
+ *          Při lexikální chybě nastaví @c SET_ERROR_LEXICAL a vrátí token
+ *          typu @c TOKEN_UNINITIALIZED.
+ *
+ * @return Přijatý token.
+ */
+Token scannerDFA_FSM();
+
+/*******************************************************************************
+ *                                                                             *
+ *                         DEKLARACE INTERNÍCH FUNKCÍ                          *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Vrátí třídu ekvivalence vstupního znaku.
+ *
+ * @param [in] c Znak ze vstupu (včetně @c EOF)
+ *
+ * @return Index sloupce tabulky přechodů.
+ */
+uint8_t scannerDFA_charClass(int c);
+
+/**
+ * @brief Vytvoří přijatý token z načtené hodnoty.
+ *
+ * @details Identifikátory rozliší na klíčová slova, u tokenů bez hodnoty
+ *          dynamický řetězec uvolní.
+ *
+ * @param [in] type Typ přijatého tokenu
+ * @param [in] str Ukazatel na dynamický řetězec s načtenými znaky
+ *
+ * @return Přijatý token.
+ */
+Token scannerDFA_acceptToken(TokenType type, DString *str);
+
+/**
+ * @brief Vrátí hodnotu hexadecimální číslice.
+ *
+ * @param [in] c Hexadecimální číslice
+ *
+ * @return Hodnota číslice v rozsahu `0` až `15`.
+ */
+int scannerDFA_hexDigitValue(int c);
+
+#endif // SCANNER_DFA_H_
+
+/*** Konec souboru scanner_dfa.h ***/
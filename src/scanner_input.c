@@ -0,0 +1,379 @@
+/*******************************************************************************
+ *                                                                             *
+ * Název projektu:   Implementace překladače imperativního jazyka IFJ24        *
+ *                                                                             *
+ * Soubor:           scanner_input.c                                           *
+ * Autor:            Farkašovský Lukáš  <xfarkal00>                            *
+ *                                                                             *
+ * Datum:            04.12.2024                                                *
+ * Poslední změna:   04.12.2024                                                *
+ *                                                                             *
+ * Tým:      Tým xkalinj00                                                     *
+ * Členové:  Farkašovský Lukáš    <xfarkal00>                                  *
+ *           Hýža Pavel           <xhyzapa00>                                  *
+ *           Kalina Jan           <xkalinj00>                                  *
+ *           Krejčí David         <xkrejcd00>                                  *
+ *                                                                             *
+ ******************************************************************************/
+/**
+ * @file scanner_input.c
+ * @author Farkašovský Lukáš \<xfarkal00>
+ *
+ * @brief Implementace vyrovnávací paměti vstupu scanneru.
+ * @details Vyhledávací funkce zpracují vstup po 16 bajtech pomocí SSE2
+ *          a zbytek (nebo celý vstup na platformách bez SSE2) po znacích.
+ */
+
+#include <string.h>
+#include "scanner_input.h"
+#include "error.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                       INICIALIZACE GLOBÁLNÍCH PROMĚNNÝCH                    *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Globální vstup scanneru.
+ */
+ScannerInput scannerInput = {NULL, 0, 0, false, false};
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                        IMPLEMENTACE VEŘEJNÝCH FUNKCÍ                        *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Načte celý STDIN do paměti a přepne scanner na čtení z ní.
+ */
+bool scannerInput_bufferStdin() {
+    scannerInput_free();
+
+    size_t allocated = SCANNER_INPUT_CHUNK_SIZE;
+    size_t length = 0;
+    char *data = malloc(allocated);
+    if(data == NULL) {
+        return false;
+    }
+
+    // Čteme po blocích, dokud nedojdeme na konec vstupu
+    while(true) {
+        if(length == allocated) {
+            char *newData = realloc(data, allocated * 2);
+            if(newData == NULL) {
+                free(data);
+                return false;
+            }
+            data = newData;
+            allocated *= 2;
+        }
+
+        size_t read = fread(data + length, 1, allocated - length, stdin);
+        length += read;
+
+        if(read == 0) {
+            break;
+        }
+    }
+
+    scannerInput.data = data;
+    scannerInput.length = length;
+    scannerInput.position = 0;
+    scannerInput.buffered = true;
+    scannerInput.validated = false;
+
+    return true;
+}  // scannerInput_bufferStdin()
+
+/**
+ * @brief Přepne scanner na čtení z daného bloku paměti.
+ */
+bool scannerInput_setBuffer(const char *data, size_t length) {
+    scannerInput_free();
+
+    // Alokujeme alespoň jeden bajt, aby šlo rozlišit prázdný vstup od chyby
+    char *copy = malloc(length + 1);
+    if(copy == NULL) {
+        return false;
+    }
+    memcpy(copy, data, length);
+
+    scannerInput.data = copy;
+    scannerInput.length = length;
+    scannerInput.position = 0;
+    scannerInput.buffered = true;
+    scannerInput.validated = false;
+
+    return true;
+}  // scannerInput_setBuffer()
+
+/**
+ * @brief Uvolní načtený vstup a vrátí scanner ke čtení ze STDIN.
+ */
+void scannerInput_free() {
+    free(scannerInput.data);
+    scannerInput.data = NULL;
+    scannerInput.length = 0;
+    scannerInput.position = 0;
+    scannerInput.buffered = false;
+    scannerInput.validated = false;
+}  // scannerInput_free()
+
+/**
+ * @brief Ověří načtený vstup scanneru.
+ */
+bool scannerInput_validateBuffer() {
+    size_t invalid = scannerInput_validate(scannerInput.data, scannerInput.length);
+
+    // Pokud je vstup platný, scanner může vynechat kontroly v komentářích
+    if(invalid == scannerInput.length) {
+        scannerInput.validated = true;
+        return true;
+    }
+
+    // Spočítáme řádek a sloupec neplatného bajtu
+    size_t line = 1;
+    size_t lineStart = 0;
+    for(size_t i = 0; i < invalid; i++) {
+        if(scannerInput.data[i] == '\n') {
+            line++;
+            lineStart = i + 1;
+        }
+    }
+
+    fprintf(stderr, RED_COLOR "Invalid byte 0x%02X at line %zu, column %zu.\n" RESET_COLOR,
+            (unsigned char)scannerInput.data[invalid], line, invalid - lineStart + 1);
+
+    return false;
+}  // scannerInput_validateBuffer()
+
+/**
+ * @brief Najde první bajt, který nemůže být součástí zdrojového souboru.
+ */
+size_t scannerInput_validate(const char *data, size_t length) {
+    size_t i = 0;
+
+#if defined(__SSE2__)
+    const __m128i lastControl = _mm_set1_epi8(' ' - 1);
+    const __m128i tab = _mm_set1_epi8('\t');
+    const __m128i range = _mm_set1_epi8('\r' - '\t');
+#endif
+
+    while(i < length) {
+#if defined(__SSE2__)
+        // Přeskočíme bloky, které obsahují jen ASCII znaky bez řídicích znaků
+        for(; i + SCANNER_SIMD_WIDTH <= length; i += SCANNER_SIMD_WIDTH) {
+            __m128i chunk = _mm_loadu_si128((const __m128i *)(const void *)(data + i));
+            __m128i isControl = _mm_cmpeq_epi8(_mm_min_epu8(chunk, lastControl), chunk);
+            __m128i shifted = _mm_sub_epi8(chunk, tab);
+            __m128i isSpace = _mm_cmpeq_epi8(_mm_min_epu8(shifted, range), shifted);
+
+            // Nejvyšší bit bajtu značí znak mimo ASCII
+            unsigned mask = (unsigned)_mm_movemask_epi8(_mm_andnot_si128(isSpace, isControl)) |
+                            (unsigned)_mm_movemask_epi8(chunk);
+            if(mask != 0) {
+                break;
+            }
+        }
+
+        if(i >= length) {
+            break;
+        }
+#endif
+
+        unsigned char c = (unsigned char)data[i];
+
+        // ASCII znak je neplatný, pokud jde o řídicí znak mimo bílé znaky
+        if(c < 0x80) {
+            if(c < ' ' && (c < '\t' || c > '\r')) {
+                return i;
+            }
+            i++;
+        }
+        // Jinak musí začínat platnou sekvenci UTF-8
+        else {
+            size_t sequence = scannerInput_utf8SequenceLength((const unsigned char *)data + i,
+                                                              length - i);
+            if(sequence == 0) {
+                return i;
+            }
+            i += sequence;
+        }
+    }
+
+    return length;
+}  // scannerInput_validate()
+
+/**
+ * @brief Najde první znak, který není bílým znakem.
+ */
+size_t scannerInput_skipWhitespace(const char *data, size_t from, size_t length) {
+    size_t i = from;
+
+#if defined(__SSE2__)
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i tab = _mm_set1_epi8('\t');
+    const __m128i range = _mm_set1_epi8('\r' - '\t');
+
+    for(; i + SCANNER_SIMD_WIDTH <= length; i += SCANNER_SIMD_WIDTH) {
+        __m128i chunk = _mm_loadu_si128((const __m128i *)(const void *)(data + i));
+
+        // Bílé znaky jsou mezera a znaky '\t' až '\r'
+        __m128i shifted = _mm_sub_epi8(chunk, tab);
+        __m128i isControlSpace = _mm_cmpeq_epi8(_mm_min_epu8(shifted, range), shifted);
+        __m128i isSpace = _mm_or_si128(_mm_cmpeq_epi8(chunk, space), isControlSpace);
+
+        unsigned mask = (unsigned)_mm_movemask_epi8(isSpace) ^ 0xFFFFu;
+        if(mask != 0) {
+            return i + (size_t)__builtin_ctz(mask);
+        }
+    }
+#endif
+
+    // Zbytek vstupu po znacích
+    for(; i < length; i++) {
+        char c = data[i];
+        if(c != ' ' && (c < '\t' || c > '\r')) {
+            return i;
+        }
+    }
+
+    return length;
+}  // scannerInput_skipWhitespace()
+
+/**
+ * @brief Najde první řídicí znak (bajt menší než mezera).
+ */
+size_t scannerInput_findControl(const char *data, size_t from, size_t length) {
+    size_t i = from;
+
+#if defined(__SSE2__)
+    const __m128i lastControl = _mm_set1_epi8(' ' - 1);
+
+    for(; i + SCANNER_SIMD_WIDTH <= length; i += SCANNER_SIMD_WIDTH) {
+        __m128i chunk = _mm_loadu_si128((const __m128i *)(const void *)(data + i));
+
+        // Bezznaménkové porovnání bajtu s hodnotou 0x1F
+        __m128i isControl = _mm_cmpeq_epi8(_mm_min_epu8(chunk, lastControl), chunk);
+
+        unsigned mask = (unsigned)_mm_movemask_epi8(isControl);
+        if(mask != 0) {
+            return i + (size_t)__builtin_ctz(mask);
+        }
+    }
+#endif
+
+    // Zbytek vstupu po znacích
+    for(; i < length; i++) {
+        if((unsigned char)data[i] < ' ') {
+            return i;
+        }
+    }
+
+    return length;
+}  // scannerInput_findControl()
+
+/**
+ * @brief Najde první znak nového řádku.
+ */
+size_t scannerInput_findNewline(const char *data, size_t from, size_t length) {
+    if(from >= length) {
+        return length;
+    }
+
+    // Funkce memchr ze standardní knihovny je sama vektorizovaná
+    const char *newline = memchr(data + from, '\n', length - from);
+
+    return (newline != NULL) ? (size_t)(newline - data) : length;
+}  // scannerInput_findNewline()
+
+/**
+ * @brief Najde první uvozovku nebo zpětné lomítko.
+ */
+size_t scannerInput_findStringEnd(const char *data, size_t from, size_t length) {
+    size_t i = from;
+
+#if defined(__SSE2__)
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+
+    for(; i + SCANNER_SIMD_WIDTH <= length; i += SCANNER_SIMD_WIDTH) {
+        __m128i chunk = _mm_loadu_si128((const __m128i *)(const void *)(data + i));
+        __m128i isEnd = _mm_or_si128(_mm_cmpeq_epi8(chunk, quote),
+                                     _mm_cmpeq_epi8(chunk, backslash));
+
+        unsigned mask = (unsigned)_mm_movemask_epi8(isEnd);
+        if(mask != 0) {
+            return i + (size_t)__builtin_ctz(mask);
+        }
+    }
+#endif
+
+    // Zbytek vstupu po znacích
+    for(; i < length; i++) {
+        if(data[i] == '"' || data[i] == '\\') {
+            return i;
+        }
+    }
+
+    return length;
+}  // scannerInput_findStringEnd()
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                        IMPLEMENTACE INTERNÍCH FUNKCÍ                        *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Vrátí délku platné sekvence UTF-8 začínající daným bajtem.
+ */
+size_t scannerInput_utf8SequenceLength(const unsigned char *data, size_t remaining) {
+    unsigned char lead = data[0];
+    size_t length;
+    unsigned char low = 0x80;   // Povolený rozsah druhého bajtu sekvence
+    unsigned char high = 0xBF;
+
+    // Podle prvního bajtu určíme délku a rozsah druhého bajtu (vyloučení
+    // nadbytečně dlouhých zápisů, náhradních párů a hodnot nad U+10FFFF)
+    if(lead >= 0xC2 && lead <= 0xDF) {
+        length = 2;
+    }
+    else if(lead >= 0xE0 && lead <= 0xEF) {
+        length = 3;
+        if(lead == 0xE0) low = 0xA0;
+        if(lead == 0xED) high = 0x9F;
+    }
+    else if(lead >= 0xF0 && lead <= 0xF4) {
+        length = 4;
+        if(lead == 0xF0) low = 0x90;
+        if(lead == 0xF4) high = 0x8F;
+    }
+    else {
+        return 0;
+    }
+
+    if(remaining < length || data[1] < low || data[1] > high) {
+        return 0;
+    }
+
+    // Zbylé bajty musí být pokračovacími bajty 10xxxxxx
+    for(size_t i = 2; i < length; i++) {
+        if((data[i] & 0xC0) != 0x80) {
+            return 0;
+        }
+    }
+
+    return length;
+}  // scannerInput_utf8SequenceLength()
+
+/*** Konec souboru scanner_input.c ***/
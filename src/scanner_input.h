@@ -0,0 +1,211 @@
+/*******************************************************************************
+ *                                                                             *
+ * Název projektu:   Implementace překladače imperativního jazyka IFJ24        *
+ *                                                                             *
+ * Soubor:           scanner_input.h                                           *
+ * Autor:            Farkašovský Lukáš  <xfarkal00>                            *
+ *                                                                             *
+ * Datum:            04.12.2024                                                *
+ * Poslední změna:   04.12.2024                                                *
+ *                                                                             *
+ * Tým:      Tým xkalinj00                                                     *
+ * Členové:  Farkašovský Lukáš    <xfarkal00>                                  *
+ *           Hýža Pavel           <xhyzapa00>                                  *
+ *           Kalina Jan           <xkalinj00>                                  *
+ *           Krejčí David         <xkrejcd00>                                  *
+ *                                                                             *
+ ******************************************************************************/
+/**
+ * @file scanner_input.h
+ * @author Farkašovský Lukáš \<xfarkal00>
+ *
+ * @brief Hlavičkový soubor pro vyrovnávací paměť vstupu scanneru.
+ * @details Překladač na začátku načte celý zdrojový soubor ze STDIN do paměti.
+ *          Nad načteným vstupem pak scanner přeskakuje bílé znaky, komentáře
+ *          a těla řetězců po blocích 16 bajtů pomocí instrukcí SSE2. Na
+ *          platformách bez SSE2 se použije skalární varianta. Pokud vstup
+ *          načten není, scanner čte po znacích přímo ze STDIN.
+ *
+ *          Před lexikální analýzou je načtený vstup jednorázově ověřen: nesmí
+ *          obsahovat řídicí znaky (kromě bílých znaků) ani neplatné sekvence
+ *          UTF-8. Takové znaky nejsou platné nikde v programu (ani v řetězci,
+ *          ani v komentáři), a tak lze chybu ohlásit hned s její pozicí.
+ */
+
+#ifndef SCANNER_INPUT_H_
+/** @cond  */
+#define SCANNER_INPUT_H_
+/** @endcond  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                             DEKLARACE KONSTANT                              *
+ *                                                                             *
+ ******************************************************************************/
+
+#define SCANNER_INPUT_CHUNK_SIZE 4096   /**< Velikost bloku při načítání STDIN   */
+#define SCANNER_SIMD_WIDTH 16           /**< Počet bajtů zpracovaných najednou   */
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                             DEKLARACE STRUKTUR                              *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Načtený vstup scanneru.
+ */
+typedef struct ScannerInput {
+    char *data;         /**< Obsah vstupu                                  */
+    size_t length;      /**< Délka vstupu v bajtech                        */
+    size_t position;    /**< Pozice dalšího čteného znaku                  */
+    bool buffered;      /**< Příznak, zda scanner čte z načteného vstupu   */
+    bool validated;     /**< Příznak, zda vstup prošel validací            */
+} ScannerInput;
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                       DEKLARACE GLOBÁLNÍCH PROMĚNNÝCH                       *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Globální vstup scanneru.
+ */
+extern ScannerInput scannerInput;
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                         DEKLARACE VEŘEJNÝCH FUNKCÍ                          *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Načte celý STDIN do paměti a přepne scanner na čtení z ní.
+ *
+ * @return `true`, pokud se vstup podařilo načíst, jinak `false`.
+ */
+bool scannerInput_bufferStdin();
+
+/**
+ * @brief Přepne scanner na čtení z daného bloku paměti.
+ *
+ * @details Obsah je zkopírován, volající si vlastní data ponechává.
+ *
+ * @param [in] data Ukazatel na obsah vstupu
+ * @param [in] length Délka vstupu v bajtech
+ *
+ * @return `true`, pokud se vstup podařilo nastavit, jinak `false`.
+ */
+bool scannerInput_setBuffer(const char *data, size_t length);
+
+/**
+ * @brief Uvolní načtený vstup a vrátí scanner ke čtení ze STDIN.
+ */
+void scannerInput_free();
+
+/**
+ * @brief Ověří načtený vstup scanneru.
+ *
+ * @details Při nalezení neplatného bajtu vypíše na STDERR jeho řádek a sloupec.
+ *          Při úspěchu nastaví příznak @c validated, díky kterému scanner
+ *          přeskakuje komentáře až po konec řádku bez kontroly dalších znaků.
+ *
+ * @return `true`, pokud je vstup platný, jinak `false`.
+ */
+bool scannerInput_validateBuffer();
+
+/**
+ * @brief Najde první bajt, který nemůže být součástí zdrojového souboru.
+ *
+ * @details Neplatné jsou řídicí znaky mimo bílé znaky (`0x00`–`0x08`,
+ *          `0x0E`–`0x1F`) a bajty, které netvoří platnou sekvenci UTF-8.
+ *          Bloky 16 bajtů obsahující pouze tisknutelné ASCII znaky a bílé
+ *          znaky se přeskakují pomocí SSE2.
+ *
+ * @param [in] data Ukazatel na vstup
+ * @param [in] length Délka vstupu
+ *
+ * @return Pozice prvního neplatného bajtu, nebo @p length.
+ */
+size_t scannerInput_validate(const char *data, size_t length);
+
+/**
+ * @brief Najde první znak, který není bílým znakem.
+ *
+ * @param [in] data Ukazatel na vstup
+ * @param [in] from Pozice, od které se hledá
+ * @param [in] length Délka vstupu
+ *
+ * @return Pozice nalezeného znaku, nebo @p length.
+ */
+size_t scannerInput_skipWhitespace(const char *data, size_t from, size_t length);
+
+/**
+ * @brief Najde první řídicí znak (bajt menší než mezera).
+ *
+ * @details Využívá se v komentářích, kde je potřeba zastavit na konci řádku
+ *          a na znacích, které nepatří do jazyka.
+ *
+ * @param [in] data Ukazatel na vstup
+ * @param [in] from Pozice, od které se hledá
+ * @param [in] length Délka vstupu
+ *
+ * @return Pozice nalezeného znaku, nebo @p length.
+ */
+size_t scannerInput_findControl(const char *data, size_t from, size_t length);
+
+/**
+ * @brief Najde první znak nového řádku.
+ *
+ * @details Využívá se v komentářích ověřeného vstupu.
+ *
+ * @param [in] data Ukazatel na vstup
+ * @param [in] from Pozice, od které se hledá
+ * @param [in] length Délka vstupu
+ *
+ * @return Pozice nalezeného znaku, nebo @p length.
+ */
+size_t scannerInput_findNewline(const char *data, size_t from, size_t length);
+
+/**
+ * @brief Najde první uvozovku nebo zpětné lomítko.
+ *
+ * @details Využívá se v tělech řetězcových literálů.
+ *
+ * @param [in] data Ukazatel na vstup
+ * @param [in] from Pozice, od které se hledá
+ * @param [in] length Délka vstupu
+ *
+ * @return Pozice nalezeného znaku, nebo @p length.
+ */
+size_t scannerInput_findStringEnd(const char *data, size_t from, size_t length);
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                         DEKLARACE INTERNÍCH FUNKCÍ                          *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Vrátí délku platné sekvence UTF-8 začínající daným bajtem.
+ *
+ * @param [in] data Ukazatel na první bajt sekvence (s hodnotou alespoň `0x80`)
+ * @param [in] remaining Počet bajtů do konce vstupu
+ *
+ * @return Délka sekvence (2 až 4), nebo `0`, pokud sekvence není platná.
+ */
+size_t scannerInput_utf8SequenceLength(const unsigned char *data, size_t remaining);
+
+#endif // SCANNER_INPUT_H_
+
+/*** Konec souboru scanner_input.h ***/
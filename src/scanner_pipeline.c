@@ -0,0 +1,282 @@
+/*******************************************************************************
+ *                                                                             *
+ * Název projektu:   Implementace překladače imperativního jazyka IFJ24        *
+ *                                                                             *
+ * Soubor:           scanner_pipeline.c                                        *
+ * Autor:            Hýža Pavel         <xhyzapa00>                            *
+ *                                                                             *
+ * Datum:            04.12.2024                                                *
+ * Poslední změna:   04.12.2024                                                *
+ *                                                                             *
+ * Tým:      Tým xkalinj00                                                     *
+ * Členové:  Farkašovský Lukáš    <xfarkal00>                                  *
+ *           Hýža Pavel           <xhyzapa00>                                  *
+ *           Kalina Jan           <xkalinj00>                                  *
+ *           Krejčí David         <xkrejcd00>                                  *
+ *                                                                             *
+ ******************************************************************************/
+/**
+ * @file scanner_pipeline.c
+ * @author Hýža Pavel \<xhyzapa00>
+ *
+ * @brief Implementace zřetězeného běhu scanneru v samostatném vlákně.
+ * @details Kruhový buffer používá dva monotónně rostoucí indexy: @c tail
+ *          zapisuje pouze vlákno scanneru, @c head pouze parser. Obě strany
+ *          si index druhé strany pamatují a znovu jej čtou, až když narazí na
+ *          plný, resp. prázdný buffer. Vlastní indexy zveřejňují po dávkách,
+ *          před čekáním však vždy, aby se strany nezablokovaly navzájem.
+ */
+
+// Kvůli funkci sched_yield()
+#define _POSIX_C_SOURCE 200809L
+
+#include <sched.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+// Import knihoven překladače
+#include "scanner_pipeline.h"
+#include "settings.h"
+
+
+/**
+ * @brief Jedno místo kruhového bufferu.
+ */
+typedef struct ScannerPipeline_Slot {
+    Token token;                /**< Token přečtený scannerem                       */
+    ParserErrorState error;     /**< První chyba hlášená při čtení tokenu, jinak
+                                     @c RESET_ERROR_FLAGS                           */
+} ScannerPipeline_Slot;
+
+/**
+ * @brief Stav zřetězeného běhu scanneru.
+ *
+ * @details Indexy každé strany leží ve vlastním řádku cache, aby se zápisy
+ *          scanneru a parseru navzájem nezneplatňovaly.
+ */
+typedef struct ScannerPipeline {
+    ScannerPipeline_Slot *slots;    /**< Místa kruhového bufferu                    */
+    pthread_t thread;               /**< Vlákno scanneru                            */
+    bool running;                   /**< Vlákno scanneru běží                       */
+    atomic_bool stop;               /**< Požadavek parseru na ukončení vlákna       */
+
+    /** Index za posledním zveřejněným tokenem (zapisuje scanner) */
+    _Alignas(SCANNER_PIPELINE_CACHE_LINE) atomic_size_t tail;
+
+    /** Index dalšího nepřevzatého tokenu (zapisuje parser) */
+    _Alignas(SCANNER_PIPELINE_CACHE_LINE) atomic_size_t head;
+    size_t consumed;                /**< Index dalšího převzatého tokenu            */
+    size_t knownTail;               /**< Poslední přečtená hodnota @c tail          */
+} ScannerPipeline;
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                       INICIALIZACE GLOBÁLNÍCH PROMĚNNÝCH                    *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Globální stav zřetězeného běhu scanneru.
+ */
+static ScannerPipeline scannerPipeline;
+
+/**
+ * @brief Chyba tokenu, který právě čte vlákno scanneru.
+ *
+ * @details V ostatních vláknech je vždy `NULL`.
+ */
+static _Thread_local ParserErrorState *scannerPipeline_pendingError = NULL;
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                        IMPLEMENTACE VEŘEJNÝCH FUNKCÍ                        *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Spustí vlákno scanneru, pokud je zřetězený běh zapnut.
+ */
+void scannerPipeline_init(const char *setting) {
+    scannerPipeline_free();
+
+    // Bez nastavení nebo při teplé cache tokenů poběží scanner synchronně
+    if(!settings_isEnabled(setting) || tokenCache.mode == TOKEN_CACHE_READ) {
+        return;
+    }
+
+    scannerPipeline.slots = malloc(SCANNER_PIPELINE_RING_SIZE * sizeof(ScannerPipeline_Slot));
+    if(scannerPipeline.slots == NULL) {
+        return;
+    }
+
+    atomic_init(&scannerPipeline.stop, false);
+    atomic_init(&scannerPipeline.tail, 0);
+    atomic_init(&scannerPipeline.head, 0);
+    scannerPipeline.consumed = 0;
+    scannerPipeline.knownTail = 0;
+
+    if(pthread_create(&scannerPipeline.thread, NULL, scannerPipeline_worker, NULL) != 0) {
+        free(scannerPipeline.slots);
+        scannerPipeline.slots = NULL;
+        return;
+    }
+
+    scannerPipeline.running = true;
+}  // scannerPipeline_init()
+
+/**
+ * @brief Vrátí další token scanneru.
+ */
+Token scannerPipeline_getNextToken() {
+    if(!scannerPipeline.running) {
+        return scanner_getNextToken();
+    }
+
+    // Prázdný buffer: zveřejníme převzaté tokeny a počkáme na další dávku
+    size_t index = scannerPipeline.consumed;
+    if(index == scannerPipeline.knownTail) {
+        atomic_store_explicit(&scannerPipeline.head, index, memory_order_release);
+        unsigned spins = 0;
+        while((scannerPipeline.knownTail = atomic_load_explicit(&scannerPipeline.tail,
+                                                   memory_order_acquire)) == index)
+        {
+            scannerPipeline_wait(&spins);
+        }
+    }
+
+    ScannerPipeline_Slot slot = scannerPipeline.slots[index & (SCANNER_PIPELINE_RING_SIZE - 1)];
+    scannerPipeline.consumed = index + 1;
+    if(scannerPipeline.consumed % SCANNER_PIPELINE_BATCH == 0) {
+        atomic_store_explicit(&scannerPipeline.head, scannerPipeline.consumed, memory_order_release);
+    }
+
+    // Chybu hlášenou scannerem předáme parseru spolu s tokenem
+    if(slot.error != RESET_ERROR_FLAGS) {
+        parser_errorWatcher(slot.error);
+    }
+
+    // Za koncem souboru vlákno ukončíme, další EOF vrátí přímo scanner
+    if(slot.token.type == TOKEN_EOF) {
+        scannerPipeline_free();
+    }
+
+    return slot.token;
+}  // scannerPipeline_getNextToken()
+
+/**
+ * @brief Zastaví vlákno scanneru a uvolní nepřevzaté tokeny.
+ */
+void scannerPipeline_free() {
+    if(!scannerPipeline.running) {
+        return;
+    }
+
+    atomic_store_explicit(&scannerPipeline.stop, true, memory_order_relaxed);
+    pthread_join(scannerPipeline.thread, NULL);
+
+    // Tokeny, které parser nepřevzal, vlastní stále buffer
+    size_t tail = atomic_load_explicit(&scannerPipeline.tail, memory_order_acquire);
+    for(size_t i = scannerPipeline.consumed; i < tail; i++) {
+        Token token = scannerPipeline.slots[i & (SCANNER_PIPELINE_RING_SIZE - 1)].token;
+        if(token.value != NULL) {
+            DString_free(token.value);
+        }
+    }
+
+    free(scannerPipeline.slots);
+    scannerPipeline.slots = NULL;
+    scannerPipeline.running = false;
+}  // scannerPipeline_free()
+
+/**
+ * @brief Odloží chybu hlášenou ve vlákně scanneru.
+ */
+bool scannerPipeline_deferError(ParserErrorState state) {
+    if(scannerPipeline_pendingError == NULL) {
+        return false;
+    }
+
+    // Pro parser je podstatná jen první chyba, další chyby tokenu nic nezmění
+    if(*scannerPipeline_pendingError == RESET_ERROR_FLAGS &&
+       state >= SET_ERROR_LEXICAL && state <= SET_ERROR_INTERNAL)
+    {
+        *scannerPipeline_pendingError = state;
+    }
+
+    return true;
+}  // scannerPipeline_deferError()
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                        IMPLEMENTACE INTERNÍCH FUNKCÍ                        *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Hlavní funkce vlákna scanneru (producenta).
+ */
+void *scannerPipeline_worker(void *argument) {
+    (void)argument;
+
+    size_t tail = 0;
+    size_t published = 0;
+    size_t head = 0;
+    bool endOfFile = false;
+
+    while(!endOfFile) {
+        // Plný buffer: zveřejníme rozpracovanou dávku a počkáme na parser
+        if(tail - head == SCANNER_PIPELINE_RING_SIZE) {
+            atomic_store_explicit(&scannerPipeline.tail, tail, memory_order_release);
+            published = tail;
+            unsigned spins = 0;
+            while((head = atomic_load_explicit(&scannerPipeline.head, memory_order_acquire))
+                  + SCANNER_PIPELINE_RING_SIZE == tail)
+            {
+                if(atomic_load_explicit(&scannerPipeline.stop, memory_order_relaxed)) {
+                    return NULL;
+                }
+                scannerPipeline_wait(&spins);
+            }
+        }
+
+        // Token přečteme přímo do místa bufferu i s případnou chybou
+        ScannerPipeline_Slot *slot = &scannerPipeline.slots[tail & (SCANNER_PIPELINE_RING_SIZE - 1)];
+        slot->error = RESET_ERROR_FLAGS;
+        scannerPipeline_pendingError = &slot->error;
+        slot->token = scanner_getNextToken();
+        scannerPipeline_pendingError = NULL;
+
+        tail++;
+        endOfFile = (slot->token.type == TOKEN_EOF);
+
+        if(endOfFile || tail - published == SCANNER_PIPELINE_BATCH) {
+            atomic_store_explicit(&scannerPipeline.tail, tail, memory_order_release);
+            published = tail;
+        }
+
+        if(atomic_load_explicit(&scannerPipeline.stop, memory_order_relaxed)) {
+            break;
+        }
+    }
+
+    atomic_store_explicit(&scannerPipeline.tail, tail, memory_order_release);
+
+    return NULL;
+}  // scannerPipeline_worker()
+
+/**
+ * @brief Počká na druhou stranu kruhového bufferu.
+ */
+void scannerPipeline_wait(unsigned *spins) {
+    if(*spins < SCANNER_PIPELINE_SPIN_LIMIT) {
+        (*spins)++;
+        return;
+    }
+
+    sched_yield();
+}  // scannerPipeline_wait()
+
+/*** Konec souboru scanner_pipeline.c ***/
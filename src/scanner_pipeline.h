@@ -0,0 +1,135 @@
+/*******************************************************************************
+ *                                                                             *
+ * Název projektu:   Implementace překladače imperativního jazyka IFJ24        *
+ *                                                                             *
+ * Soubor:           scanner_pipeline.h                                        *
+ * Autor:            Hýža Pavel         <xhyzapa00>                            *
+ *                                                                             *
+ * Datum:            04.12.2024                                                *
+ * Poslední změna:   04.12.2024                                                *
+ *                                                                             *
+ * Tým:      Tým xkalinj00                                                     *
+ * Členové:  Farkašovský Lukáš    <xfarkal00>                                  *
+ *           Hýža Pavel           <xhyzapa00>                                  *
+ *           Kalina Jan           <xkalinj00>                                  *
+ *           Krejčí David         <xkrejcd00>                                  *
+ *                                                                             *
+ ******************************************************************************/
+/**
+ * @file scanner_pipeline.h
+ * @author Hýža Pavel \<xhyzapa00>
+ *
+ * @brief Hlavičkový soubor pro zřetězený běh scanneru v samostatném vlákně.
+ * @details Pokud je nastavena proměnná prostředí @c SCANNER_PIPELINE_ENV
+ *          (na jinou hodnotu než `0`), scanner běží ve vlastním vlákně
+ *          a tokeny předává parseru přes kruhový buffer s jedním producentem
+ *          a jedním konzumentem. Producent zveřejňuje tokeny po dávkách
+ *          @c SCANNER_PIPELINE_BATCH, lexikální analýza se tak překrývá se
+ *          syntaktickou.
+ *
+ *          Chyby, které scanner hlásí funkcí @c parser_errorWatcher(), se ve
+ *          vlákně scanneru nezapisují do stavu parseru, ale uloží se k tokenu,
+ *          při jehož čtení vznikly. Parser je převezme až s tímto tokenem,
+ *          takže první hlášená chyba je stejná jako při synchronním běhu.
+ */
+
+#ifndef SCANNER_PIPELINE_H_
+/** @cond  */
+#define SCANNER_PIPELINE_H_
+/** @endcond  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "scanner.h"
+#include "parser_common.h"
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                             DEKLARACE KONSTANT                              *
+ *                                                                             *
+ ******************************************************************************/
+
+#define SCANNER_PIPELINE_ENV "IFJ24_SCANNER_PIPELINE"   /**< Proměnná prostředí zapínající vlákno scanneru */
+#define SCANNER_PIPELINE_RING_SIZE 4096     /**< Počet míst kruhového bufferu (mocnina dvou)    */
+#define SCANNER_PIPELINE_BATCH 64           /**< Počet tokenů zveřejněných najednou             */
+#define SCANNER_PIPELINE_SPIN_LIMIT 64      /**< Počet aktivních pokusů před uvolněním procesoru */
+#define SCANNER_PIPELINE_CACHE_LINE 64      /**< Velikost řádku cache pro oddělení indexů       */
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                         DEKLARACE VEŘEJNÝCH FUNKCÍ                          *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Spustí vlákno scanneru, pokud je zřetězený běh zapnut.
+ *
+ * @details Musí být voláno po @c tokenCache_init(). Při teplé cache tokenů
+ *          se scanner nespouští vůbec, vlákno se proto nevytváří. Pokud se
+ *          vlákno nepodaří vytvořit, scanner poběží synchronně.
+ *
+ * @param [in] setting Hodnota proměnné @c SCANNER_PIPELINE_ENV, nebo `NULL`
+ */
+void scannerPipeline_init(const char *setting);
+
+/**
+ * @brief Vrátí další token scanneru.
+ *
+ * @details Při zřetězeném běhu token převezme z kruhového bufferu spolu
+ *          s chybou, kterou scanner při jeho čtení hlásil. Po převzetí tokenu
+ *          EOF vlákno ukončí. Jinak zavolá přímo @c scanner_getNextToken().
+ *
+ * @return Další token vstupu.
+ */
+Token scannerPipeline_getNextToken();
+
+/**
+ * @brief Zastaví vlákno scanneru a uvolní nepřevzaté tokeny.
+ */
+void scannerPipeline_free();
+
+/**
+ * @brief Odloží chybu hlášenou ve vlákně scanneru.
+ *
+ * @details Volá se z @c parser_errorWatcher(). Mimo vlákno scanneru nic
+ *          neprovádí.
+ *
+ * @param [in] state Hlášený chybový stav
+ *
+ * @return `true`, pokud byla chyba odložena k právě čtenému tokenu,
+ *         jinak `false`.
+ */
+bool scannerPipeline_deferError(ParserErrorState state);
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                         DEKLARACE INTERNÍCH FUNKCÍ                          *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Hlavní funkce vlákna scanneru (producenta).
+ *
+ * @param [in] argument Nepoužitý argument vlákna
+ *
+ * @return Vždy `NULL`.
+ */
+void *scannerPipeline_worker(void *argument);
+
+/**
+ * @brief Počká na druhou stranu kruhového bufferu.
+ *
+ * @details Prvních @c SCANNER_PIPELINE_SPIN_LIMIT pokusů čeká aktivně, poté
+ *          při každém pokusu uvolní procesor.
+ *
+ * @param [in,out] spins Počet dosavadních pokusů
+ */
+void scannerPipeline_wait(unsigned *spins);
+
+#endif // SCANNER_PIPELINE_H_
+
+/*** Konec souboru scanner_pipeline.h ***/
@@ -23,29 +23,56 @@
  * @details Implementace funkcí z hlavičkového souboru semantic_analyser.h
  */
 
-
+#include <pthread.h>
+#include <stdatomic.h>
 #include "semantic_analyser.h"
+#include "settings.h"
+
+
+/**
+ * @brief Sdílený stav paralelní analýzy definic funkcí
+ *
+ * @details Vlákna si berou funkce podle atomického indexu @c next a chybu
+ *          každé funkce zapisují na její index do pole @c errors. Výsledná
+ *          chyba je chyba první chybné funkce v pořadí definic, stejně jako
+ *          při sekvenční analýze.
+ */
+typedef struct Semantic_Pool {
+    AST_FunDefNode **functions;     /**< Definice funkcí v pořadí seznamu funkcí       */
+    const bool *selected;           /**< Příznaky analyzovaných funkcí, nebo `NULL`    */
+    ErrorType *errors;              /**< Výsledky analýzy jednotlivých funkcí          */
+    size_t count;                   /**< Počet funkcí                                  */
+    atomic_size_t next;             /**< Index další funkce k analýze                  */
+    atomic_size_t firstError;       /**< Nejnižší index funkce s chybou                */
+} Semantic_Pool;
 
 
 /**
  * @brief Provede sémantickou analýzu celého programu.
  */
 void semantic_analyseProgram() {
+    semantic_analyseSelected(NULL, NULL);
+}  // semantic_analyseProgram
+
+/**
+ * @brief Provede sémantickou analýzu programu s vynecháním vybraných funkcí.
+ */
+void semantic_analyseSelected(const bool *selectedFunctions, const bool *selectedFrames) {
     ErrorType error = semantic_analyseProgramStructure();
     if(error != SUCCESS) {
         error_handle(error);
     }
 
-    error = semantic_analyseFunctionDefinitions();
+    error = semantic_analyseSelectedFunctions(selectedFunctions);
     if(error != SUCCESS) {
         error_handle(error);
     }
 
-    error = semantic_analyseVariables();
+    error = semantic_analyseVariablesInFrames(selectedFrames);
     if(error != SUCCESS) {
         error_handle(error);
     }
-}  // semantic_analyseProgram
+}  // semantic_analyseSelected
 
 /**
  * @brief Provede sémantickou analýzu základní struktury programu.
@@ -108,67 +135,143 @@ ErrorType semantic_analyseProgramStructure() {
  * @brief Provede sémantickou analýzu definic funkcí
  */
 ErrorType semantic_analyseFunctionDefinitions() {
-    AST_FunDefNode *node = ASTroot->functionList;
-    // Pro každou definici funkce
-    while(node != NULL) {
-        ErrorType error = semantic_probeFunction(node);
-        if(error != SUCCESS) {
-            return error;
-        }
-        node = node->next;
-    }
-
-    return SUCCESS;
+    return semantic_analyseSelectedFunctions(NULL);
 }  // semantic_analyseFunctionDefinitions
 
 /**
- * @brief Provede sémantickou analýzu všech proměnných v programu
+ * @brief Provede sémantickou analýzu vybraných definic funkcí
  */
-ErrorType semantic_analyseVariables() {
-    // Projdeme všechny rámce
-    for(size_t i = 1; i <= frameStack.currentID; i++) {
-        // Z rámce vezmeme tabulku symbolů
-        SymtablePtr table = frameArray.array[i]->frame;
-        SymtableItem item;
-        // Pro každý index tabulky symbolů
-        for(size_t j = 0; j < table->allocatedSize; j++) {
-            item = table->array[j];
-
-            // Pokud na indexu není položka, tak přejdeme na další index
-            if(item.symbolState == SYMTABLE_SYMBOL_EMPTY) {
+ErrorType semantic_analyseSelectedFunctions(const bool *selected) {
+    size_t count = 0;
+    for(AST_FunDefNode *node = ASTroot->functionList; node != NULL; node = node->next) {
+        count++;
+    }
+
+    // Malé programy analyzujeme sekvenčně bez režie vláken
+    size_t threads = semantic_threadCount(count);
+    if(threads <= 1) {
+        AST_FunDefNode *node = ASTroot->functionList;
+        // Pro každou vybranou definici funkce
+        for(size_t i = 0; node != NULL; i++, node = node->next) {
+            if(selected != NULL && !selected[i]) {
                 continue;
             }
 
-            if(item.symbolState == SYMTABLE_SYMBOL_FUNCTION) {
-                // Nemělo by se nikdy stát, jinak je chyba v implementaci
-                // Funkce by měly být definovány pouze v globálním rámci
-                return ERROR_INTERNAL;
+            ErrorType error = semantic_probeFunction(node);
+            if(error != SUCCESS) {
+                return error;
             }
+        }
 
-            if(item.symbolState == SYMTABLE_SYMBOL_DEAD) {
-                // Nemělo by se nikdy stát, jinak je chyba v implementaci
-                // Položky by se měly mazat jen na konci běhu programu
-                return ERROR_INTERNAL;
-            }
+        return SUCCESS;
+    }
 
-            // Zkontrolujeme, že je proměnná využita
-            if(item.used == false) {
-                return ERROR_SEM_UNUSED_VAR;
-            }
+    AST_FunDefNode **functions = malloc(count * sizeof(AST_FunDefNode *));
+    ErrorType *errors = malloc(count * sizeof(ErrorType));
+    pthread_t *workers = malloc(threads * sizeof(pthread_t));
+    if(functions == NULL || errors == NULL || workers == NULL) {
+        free(functions);
+        free(errors);
+        free(workers);
+        return ERROR_INTERNAL;
+    }
 
-            // Pokud je položka konstantní, tak zkontrolujeme, že se nemění
-            if(item.constant == true) {
-                if(item.changed == true) {
-                    return ERROR_SEM_REDEF_OR_CONSTDEF;
-                }
-            }
-            // Pokud není konstantní, tak zkontrolujeme, že se změní
-            else {
-                if(item.changed == false) {
-                    return ERROR_SEM_UNUSED_VAR;
-                }
+    AST_FunDefNode *node = ASTroot->functionList;
+    for(size_t i = 0; i < count; i++, node = node->next) {
+        functions[i] = node;
+        errors[i] = SUCCESS;
+    }
+
+    Semantic_Pool pool = { functions, selected, errors, count, 0, count };
+
+    // Volající vlákno analyzuje také, pokud se vlákno nevytvoří, práci převezmou ostatní
+    size_t started = 0;
+    for(size_t i = 1; i < threads; i++) {
+        if(pthread_create(&workers[started], NULL, semantic_poolWorker, &pool) == 0) {
+            started++;
+        }
+    }
+    semantic_poolWorker(&pool);
+    for(size_t i = 0; i < started; i++) {
+        pthread_join(workers[i], NULL);
+    }
+
+    // Chyba první chybné funkce nezávisí na rozvrhování vláken
+    ErrorType error = SUCCESS;
+    size_t firstError = atomic_load(&pool.firstError);
+    if(firstError < count) {
+        error = errors[firstError];
+    }
+
+    free(functions);
+    free(errors);
+    free(workers);
+
+    return error;
+}  // semantic_analyseSelectedFunctions
+
+/**
+ * @brief Vrátí počet vláken pro analýzu daného počtu funkcí
+ */
+size_t semantic_threadCount(size_t count) {
+    return settings_threadCount(getenv(SEMANTIC_THREADS_ENV), count, SEMANTIC_PARALLEL_THRESHOLD, SEMANTIC_MAX_THREADS);
+}  // semantic_threadCount
+
+/**
+ * @brief Analyzuje funkce ze sdíleného stavu, dokud nějaké zbývají
+ */
+void *semantic_poolWorker(void *arg) {
+    Semantic_Pool *pool = arg;
+
+    while(true) {
+        size_t i = atomic_fetch_add(&pool->next, 1);
+        // Funkce za první nalezenou chybou už výsledek neovlivní
+        if(i >= pool->count || i > atomic_load(&pool->firstError)) {
+            break;
+        }
+
+        if(pool->selected != NULL && !pool->selected[i]) {
+            continue;
+        }
+
+        pool->errors[i] = semantic_probeFunction(pool->functions[i]);
+        if(pool->errors[i] == SUCCESS) {
+            continue;
+        }
+
+        // Zaznamenáme nejnižší index chybné funkce
+        size_t current = atomic_load(&pool->firstError);
+        while(i < current) {
+            // Při neúspěchu se do current načte aktuální hodnota
+            if(atomic_compare_exchange_weak(&pool->firstError, &current, i)) {
+                break;
             }
+        }
+    }
 
+    return NULL;
+}  // semantic_poolWorker
+
+/**
+ * @brief Provede sémantickou analýzu všech proměnných v programu
+ */
+ErrorType semantic_analyseVariables() {
+    return semantic_analyseVariablesInFrames(NULL);
+}  // semantic_analyseVariables
+
+/**
+ * @brief Provede sémantickou analýzu proměnných ve vybraných rámcích
+ */
+ErrorType semantic_analyseVariablesInFrames(const bool *selected) {
+    // Projdeme všechny vybrané rámce
+    for(size_t i = 1; i <= frameStack.currentID; i++) {
+        if(selected != NULL && !selected[i]) {
+            continue;
+        }
+
+        ErrorType error = semantic_analyseFrameVariables(frameArray.array[i]->frame);
+        if(error != SUCCESS) {
+            return error;
         }
     }
 
@@ -188,7 +291,49 @@ ErrorType semantic_analyseVariables() {
 
     // Pokud jsme prošli všechny rámce bez vrácení, tak je vše v pořádku
     return SUCCESS;
-}  // semantic_analyseVariables
+}  // semantic_analyseVariablesInFrames
+
+/**
+ * @brief Provede sémantickou analýzu proměnných jednoho rámce
+ */
+ErrorType semantic_analyseFrameVariables(SymtablePtr table) {
+    // Procházíme jen živé položky v pořadí deklarace
+    for(size_t j = 0; j < table->itemCount; j++) {
+        SymtableItem item = table->array[table->order[j]];
+
+        if(item.symbolState == SYMTABLE_SYMBOL_FUNCTION) {
+            // Nemělo by se nikdy stát, jinak je chyba v implementaci
+            // Funkce by měly být definovány pouze v globálním rámci
+            return ERROR_INTERNAL;
+        }
+
+        if(item.symbolState == SYMTABLE_SYMBOL_DEAD) {
+            // Nemělo by se nikdy stát, jinak je chyba v implementaci
+            // Položky by se měly mazat jen na konci běhu programu
+            return ERROR_INTERNAL;
+        }
+
+        // Zkontrolujeme, že je proměnná využita
+        if(item.used == false) {
+            return ERROR_SEM_UNUSED_VAR;
+        }
+
+        // Pokud je položka konstantní, tak zkontrolujeme, že se nemění
+        if(item.constant == true) {
+            if(item.changed == true) {
+                return ERROR_SEM_REDEF_OR_CONSTDEF;
+            }
+        }
+        // Pokud není konstantní, tak zkontrolujeme, že se změní
+        else {
+            if(item.changed == false) {
+                return ERROR_SEM_UNUSED_VAR;
+            }
+        }
+    }
+
+    return SUCCESS;
+}  // semantic_analyseFrameVariables
 
 /**
  * @brief Provede sémantickou analýzu bloku funkce
@@ -215,8 +360,8 @@ ErrorType semantic_probeFunction(AST_FunDefNode *FunDefNode) {
         }
     }
 
-    // Vše proběhlo v pořádku
-    return SUCCESS;
+    // Definice konstant dosazených do všech použití už nejsou potřeba
+    return semantic_dropPropagatedConstants(&FunDefNode->body);
 }  // semantic_probeFunction
 
 /**
@@ -307,44 +452,116 @@ ErrorType semantic_probeBlock(Semantic_Data fun_return,      \
     return SUCCESS;
 }  // semantic_probeBlock
 
+/**
+ * @brief Odstraní z bloku definice konstant, které byly dosazeny do všech použití
+ */
+ErrorType semantic_dropPropagatedConstants(AST_StatementNode **statementList) {
+    AST_StatementNode **link = statementList;
+    ErrorType result;
+
+    while(*link != NULL) {
+        AST_StatementNode *statement = *link;
+
+        switch(statement->statementType) {
+            case(AST_STATEMENT_VAR_DEF): {
+                AST_BinOpNode *assignNode = ((AST_ExprNode*)statement->statement)->expression;
+                AST_VarNode *leftNode = assignNode->left->expression;
+
+                // Inicializátor musí být literál, jinak by mohl mít vedlejší efekt
+                if(assignNode->right->exprType != AST_EXPR_LITERAL) {
+                    break;
+                }
+
+                SymtablePtr table = frameArray.array[leftNode->frameID]->frame;
+                SymtableItemPtr item;
+                if(symtable_findItem(table, leftNode->identifier, &item) != SYMTABLE_SUCCESS) {
+                    return ERROR_INTERNAL;
+                }
+
+                // Nepoužitou konstantu ponecháme, chybu ohlásí kontrola proměnných
+                if(item->constant == false || item->knownValue == false ||
+                   item->used == false || item->referenced == true) {
+                    break;
+                }
+
+                // Data položky ukazují do literálu, který se uvolní s definicí
+                item->data = NULL;
+                item->knownValue = false;
+
+                *link = statement->next;
+                AST_destroyStatementNode(statement);
+                continue;
+            }
+
+            case(AST_STATEMENT_IF): {
+                AST_IfNode *ifNode = statement->statement;
+                result = semantic_dropPropagatedConstants(&ifNode->thenBranch);
+                if(result != SUCCESS) {
+                    return result;
+                }
+                result = semantic_dropPropagatedConstants(&ifNode->elseBranch);
+                if(result != SUCCESS) {
+                    return result;
+                }
+                break;
+            }
+
+            case(AST_STATEMENT_WHILE): {
+                AST_WhileNode *whileNode = statement->statement;
+                result = semantic_dropPropagatedConstants(&whileNode->body);
+                if(result != SUCCESS) {
+                    return result;
+                }
+                break;
+            }
+
+            default:
+                break;
+        }
+
+        link = &statement->next;
+    }
+
+    return SUCCESS;
+}  // semantic_dropPropagatedConstants
+
 /**
  * @brief Provede sémantickou analýzu binárního operátoru
  */
 ErrorType semantic_analyseBinOp(AST_ExprNode *node, Semantic_Data *type, void** value) {
     AST_BinOpNode *binNode = (AST_BinOpNode*)node->expression;
     ErrorType result;
+    Semantic_Value folded;
+    bool known = false;
 
     if(binNode->op == AST_OP_ASSIGNMENT) {
         result = semantic_analyseAssignmentBinOp(binNode, type);
     }
     else if(binNode->op >= AST_OP_ADD) {
-        result = semantic_analyseArithmeticBinOp(binNode, type, value);
+        result = semantic_analyseArithmeticBinOp(binNode, type, &folded, &known);
     }
     else {
-        result = semantic_analyseRelationBinOp(binNode, type, value);
+        result = semantic_analyseRelationBinOp(binNode, type, &folded, &known);
     }
 
     if(result != SUCCESS) {
         return result;
     }
 
-    // Pokud známe hodnotu operace, tak ve stromě změníme operaci na literál
-    if(value != NULL) {
-        if(*value != NULL) {
-            AST_destroyNode(AST_BIN_OP_NODE, binNode);
-            node->exprType = AST_EXPR_LITERAL;
-            AST_VarNode *newNode = AST_createVarNode(AST_LITERAL_NODE);
-            if(newNode == NULL) {
-                return ERROR_INTERNAL;
-            }
-            newNode->literalType = semantic_semToLiteral(*type);
-            newNode->value = *value;
-            newNode->identifier = NULL;
-
-            node->expression = newNode;
+    // Pokud známe hodnotu operace, tak ve stromě změníme operaci na literál,
+    // i když hodnotu volající nepožaduje (např. argument nebo návratová hodnota)
+    void *literalValue = NULL;
+    if(known) {
+        result = semantic_foldBinOp(node, *type, folded, &literalValue);
+        if(result != SUCCESS) {
+            return result;
         }
     }
 
+    if(value != NULL) {
+        *value = literalValue;
+    }
+
     return SUCCESS;
 }  // semantic_analyseBinOp
 
@@ -403,8 +620,8 @@ ErrorType semantic_analyseAssignmentBinOp(AST_BinOpNode *binNode,
 /**
  * @brief Provede sémantickou analýzu aritmetického operátoru
  */
-ErrorType semantic_analyseArithmeticBinOp(AST_BinOpNode *binNode,
-                                          Semantic_Data *type, void **value) {
+ErrorType semantic_analyseArithmeticBinOp(AST_BinOpNode *binNode, Semantic_Data *type,
+                                          Semantic_Value *value, bool *known) {
     // Zjistíme typy a hodnoty operandů
     Semantic_Data leftType;
     Semantic_Data rightType;
@@ -431,12 +648,10 @@ ErrorType semantic_analyseArithmeticBinOp(AST_BinOpNode *binNode,
     if(leftType == rightType) {
         *type = leftType;
         // Pokud známe hodnotu výrazu, tak ji zjistíme
-        if(value != NULL && leftValue != NULL && rightValue != NULL) {
+        if(leftValue != NULL && rightValue != NULL) {
             result = semantic_getArithmeticValue(*type, leftValue, rightValue,
-                                                    binNode->op, value);
-        }
-        else if(value != NULL) {
-            *value = NULL;
+                                                 binNode->op, value);
+            *known = (result == SUCCESS);
         }
         return result;
     }
@@ -451,30 +666,25 @@ ErrorType semantic_analyseArithmeticBinOp(AST_BinOpNode *binNode,
     if(leftType == SEM_DATA_INT) {
         if(leftValue != NULL) {
             // Konvertujeme levý na float
-            result = semantic_toFloat(binNode->left);
+            result = semantic_toFloat(binNode->left, &leftValue);
             *type = SEM_DATA_FLOAT;
-            semantic_analyseExpr(binNode->left, &leftType, &leftValue);
-
         }
         else {
             // Pokusíme se konvertovat pravý na int
-            result = semantic_toInt(binNode->right);
+            result = semantic_toInt(binNode->right, &rightValue);
             *type = SEM_DATA_INT;
-            semantic_analyseExpr(binNode->right, &rightType, &rightValue);
         }
     }
     else {
         if(rightValue != NULL) {
             // Konvertujeme pravý na float
-            result = semantic_toFloat(binNode->right);
+            result = semantic_toFloat(binNode->right, &rightValue);
             *type = SEM_DATA_FLOAT;
-            semantic_analyseExpr(binNode->right, &rightType, &rightValue);
         }
         else {
             // Pokusíme se konvertovat levý na int
-            result = semantic_toInt(binNode->left);
+            result = semantic_toInt(binNode->left, &leftValue);
             *type = SEM_DATA_INT;
-            semantic_analyseExpr(binNode->left, &leftType, &leftValue);
         }
     }
 
@@ -482,12 +692,10 @@ ErrorType semantic_analyseArithmeticBinOp(AST_BinOpNode *binNode,
         return result;
     }
 
-    if(value != NULL && leftValue != NULL && rightValue != NULL) {
+    if(leftValue != NULL && rightValue != NULL) {
         result = semantic_getArithmeticValue(*type, leftValue, rightValue,
                                              binNode->op, value);
-    }
-    else if(value != NULL) {
-        *value = NULL;
+        *known = (result == SUCCESS);
     }
     return result;
 }  // semantic_analyseArithmetic
@@ -495,8 +703,8 @@ ErrorType semantic_analyseArithmeticBinOp(AST_BinOpNode *binNode,
 /**
  * @brief Provede sémantickou analýzu relačního operátoru
  */
-ErrorType semantic_analyseRelationBinOp(AST_BinOpNode *binNode,
-                                        Semantic_Data *type, void **value) {
+ErrorType semantic_analyseRelationBinOp(AST_BinOpNode *binNode, Semantic_Data *type,
+                                        Semantic_Value *value, bool *known) {
     // Zjistíme typy a hodnoty operandů
     Semantic_Data leftType;
     Semantic_Data rightType;
@@ -519,6 +727,9 @@ ErrorType semantic_analyseRelationBinOp(AST_BinOpNode *binNode,
         return result;
     }
 
+    // Typ operandů, ve kterém se porovnává (konverze jej mohou změnit)
+    *type = leftType;
+
     // Jedná se o relační operátor
     if(binNode->op == AST_OP_EQUAL || binNode->op == AST_OP_NOT_EQUAL) {
         result = semantic_compatibleEqual(leftType, rightType);
@@ -530,12 +741,12 @@ ErrorType semantic_analyseRelationBinOp(AST_BinOpNode *binNode,
         if(leftType == SEM_DATA_INT && rightType == SEM_DATA_FLOAT) {
             if(leftValue != NULL) {
                 // Konvertujeme levý na float
-                result = semantic_toFloat(binNode->left);
+                result = semantic_toFloat(binNode->left, &leftValue);
                 *type = SEM_DATA_FLOAT;
             }
             else if(rightValue != NULL) {
                 // Konvertujeme pravý na int
-                result = semantic_toInt(binNode->right);
+                result = semantic_toInt(binNode->right, &rightValue);
                 *type = SEM_DATA_INT;
             }
             else {
@@ -545,12 +756,12 @@ ErrorType semantic_analyseRelationBinOp(AST_BinOpNode *binNode,
         else if(rightType == SEM_DATA_INT && leftType == SEM_DATA_FLOAT) {
             if(rightValue != NULL) {
                 // Konvertujeme pravý na float
-                result = semantic_toFloat(binNode->right);
+                result = semantic_toFloat(binNode->right, &rightValue);
                 *type = SEM_DATA_FLOAT;
             }
             else if(leftValue != NULL) {
                 // Konvertujeme levý na int
-                result = semantic_toInt(binNode->left);
+                result = semantic_toInt(binNode->left, &leftValue);
                 *type = SEM_DATA_INT;
             }
             else {
@@ -562,13 +773,8 @@ ErrorType semantic_analyseRelationBinOp(AST_BinOpNode *binNode,
             return result;
         }
 
+        result = semantic_foldRelation(binNode, *type, leftValue, rightValue, value, known);
         *type = SEM_DATA_BOOL;
-        if(value != NULL && leftValue != NULL && rightValue != NULL) {
-            result = semantic_getRelationValue(leftType, leftValue, rightValue, binNode->op, value);
-        }
-        else if(value != NULL) {
-            *value = NULL;
-        }
 
     }
     else {
@@ -581,12 +787,12 @@ ErrorType semantic_analyseRelationBinOp(AST_BinOpNode *binNode,
         if(leftType == SEM_DATA_INT && rightType == SEM_DATA_FLOAT) {
             if(leftValue != NULL) {
                 // konverze levé na float
-                result = semantic_toFloat(binNode->left);
+                result = semantic_toFloat(binNode->left, &leftValue);
                 *type = SEM_DATA_FLOAT;
             }
             else if(rightValue != NULL) {
                 // konverze pravé na int
-                result = semantic_toInt(binNode->right);
+                result = semantic_toInt(binNode->right, &rightValue);
                 *type = SEM_DATA_INT;
             }
             else {
@@ -596,12 +802,12 @@ ErrorType semantic_analyseRelationBinOp(AST_BinOpNode *binNode,
         else if(rightType == SEM_DATA_INT && leftType == SEM_DATA_FLOAT) {
             if(rightValue != NULL) {
                 // konverze pravé na float
-                result = semantic_toFloat(binNode->right);
+                result = semantic_toFloat(binNode->right, &rightValue);
                 *type = SEM_DATA_FLOAT;
             }
             else if(leftValue != NULL) {
                 // konverze levé na int
-                result = semantic_toInt(binNode->left);
+                result = semantic_toInt(binNode->left, &leftValue);
                 *type = SEM_DATA_INT;
             }
             else {
@@ -613,13 +819,8 @@ ErrorType semantic_analyseRelationBinOp(AST_BinOpNode *binNode,
             return result;
         }
 
+        result = semantic_foldRelation(binNode, *type, leftValue, rightValue, value, known);
         *type = SEM_DATA_BOOL;
-        if(value != NULL && leftValue != NULL && rightValue != NULL) {
-            result = semantic_getRelationValue(leftType, leftValue, rightValue, binNode->op, value);
-        }
-        else if(value != NULL) {
-            *value = NULL;
-        }
     }
 
 
@@ -684,14 +885,14 @@ ErrorType semantic_analyseVarDef(AST_StatementNode *statement) {
             // Podíváme se, jestli můžeme provést konverzi
             if( (l_type == SEM_DATA_FLOAT || l_type == SEM_DATA_FLOAT_OR_NULL)  \
                 && r_type == SEM_DATA_INT && value != NULL) {
-                result = semantic_toFloat(assignNode.right);
+                result = semantic_toFloat(assignNode.right, &value);
                 if(result != SUCCESS) {
                     return result;
                 }
             }
             else if( (l_type == SEM_DATA_INT || l_type == SEM_DATA_INT_OR_NULL)
                       && r_type == SEM_DATA_FLOAT && value != NULL) {
-                result = semantic_toInt(assignNode.right);
+                result = semantic_toInt(assignNode.right, &value);
                 if(result != SUCCESS) {
                     return result;
                 }
@@ -699,7 +900,8 @@ ErrorType semantic_analyseVarDef(AST_StatementNode *statement) {
             else {
                 return result;
             }
-            semantic_analyseExpr(assignNode.right, &r_type, &value);
+            // Konvertovaný literál má typ proměnné bez null
+            r_type = (r_type == SEM_DATA_INT) ? SEM_DATA_FLOAT : SEM_DATA_INT;
             item->data = value;
             item->symbolState = semantic_semTypeToState(r_type);
         }
@@ -756,6 +958,7 @@ ErrorType semantic_analyseExpr(AST_ExprNode *exprNode, Semantic_Data *type, void
 
             // Pokud známe hodnotu, ale je NULL,
             if(item->knownValue == true && item->data == NULL) {
+                item->referenced = true;
                 *type = SEM_DATA_NULL;
                 if(value != NULL) {
                     *value = NULL;
@@ -769,9 +972,11 @@ ErrorType semantic_analyseExpr(AST_ExprNode *exprNode, Semantic_Data *type, void
                 *value = node->value;
             }
 
-            // Pokud známe hodnotu, tak nahradíme uzel literálem
-            if(value != NULL && item->knownValue == true) {
+            // Pokud známe hodnotu, tak nahradíme uzel literálem (i v místech,
+            // kde volající hodnotu nepotřebuje, aby odkaz na proměnnou zmizel)
+            if(item->knownValue == true) {
                 AST_LiteralType litType = semantic_semToLiteral(*type);
+                void *literal;
                 // Pokud to lze, tak vytvoříme nová data a nakopírujeme hodnotu
                 if(litType == AST_LITERAL_INT) {
                     int *val = malloc(sizeof(int));
@@ -779,7 +984,7 @@ ErrorType semantic_analyseExpr(AST_ExprNode *exprNode, Semantic_Data *type, void
                         return ERROR_INTERNAL;
                     }
                     *val = *(int*)item->data;
-                    *value = val;
+                    literal = val;
                 }
                 else if(litType == AST_LITERAL_FLOAT) {
                     double *val = malloc(sizeof(double));
@@ -787,11 +992,12 @@ ErrorType semantic_analyseExpr(AST_ExprNode *exprNode, Semantic_Data *type, void
                         return ERROR_INTERNAL;
                     }
                     *val = *(double*)item->data;
-                    *value = val;
+                    literal = val;
                 }
                 else {
                     // Pokud se konverze nepodařila, tak se vracíme
                     // Úspěšně, protože můžeme dál pokračovat i bez převodu
+                    item->referenced = true;
                     return SUCCESS;
                 }
 
@@ -800,8 +1006,15 @@ ErrorType semantic_analyseExpr(AST_ExprNode *exprNode, Semantic_Data *type, void
                 node->identifier = NULL;
                 node->literalType = litType;
                 node->type = AST_LITERAL_NODE;
-                node->value = *value;
+                node->value = literal;
                 exprNode->exprType = AST_EXPR_LITERAL;
+                if(value != NULL) {
+                    *value = literal;
+                }
+            }
+            else {
+                // Proměnná zůstane v cílovém kódu
+                item->referenced = true;
             }
 
             // Není co dále kontrolovat, v pořádku se vracíme
@@ -839,7 +1052,6 @@ ErrorType semantic_analyseExpr(AST_ExprNode *exprNode, Semantic_Data *type, void
  */
 ErrorType semantic_analyseFunCall(AST_FunCallNode *funNode, Semantic_Data *returnType) {
     SymtableItemPtr item = NULL;
-    DString *key = NULL;
 
     // Specíální případ funkce ifj.write
     if(funNode->isBuiltIn &&
@@ -854,43 +1066,38 @@ ErrorType semantic_analyseFunCall(AST_FunCallNode *funNode, Semantic_Data *retur
         return semantic_checkIFJString(funNode);
     }
 
-    // Pokud je funkce vestavěná, tak přidáme prefix ifj.
+    const BuiltInSignature *builtIn = NULL;     /**< Signatura vestavěné funkce */
+    SymtableFunctionData *data = NULL;          /**< Data uživatelské funkce */
+    size_t paramCount = 0;
+    Symtable_functionReturnType definedReturn = SYMTABLE_TYPE_UNKNOWN;
+
+    // Vestavěné funkce hledáme ve statické tabulce signatur
     if(funNode->isBuiltIn) {
-        key = DString_constCharToDString("ifj.");
-        if(key == NULL) {
-            return ERROR_INTERNAL;
-        }
-        for(size_t i = 0; i < funNode->identifier->length; i++) {
-            DString_appendChar(key, funNode->identifier->str[i]);
+        builtIn = frameStack_findBuiltIn(funNode->identifier);
+        if(builtIn == NULL) {
+            return ERROR_SEM_UNDEF;
         }
+        paramCount = builtIn->paramCount;
+        definedReturn = builtIn->returnType;
     }
-    // Jinak zkopírujeme identifikátor
+    // Jinak zjistíme, zda je funkce definována v globálním rámci
     else {
-        key = DString_init();
-        if(key == NULL) {
-            return ERROR_INTERNAL;
-        }
-        if(DString_copy(funNode->identifier, key) != STRING_SUCCESS) {
-            return ERROR_INTERNAL;
+        Symtable_result sym_result = symtable_findItem(frameStack.bottom->frame,
+                                                   funNode->identifier, &item);
+        if(sym_result != SYMTABLE_SUCCESS) {
+            return ERROR_SEM_UNDEF;
         }
+        data = (SymtableFunctionData*)item->data;
+        paramCount = data->paramCount;
+        definedReturn = data->returnType;
     }
 
-    // Zjistíme, zda je funkce definována
-    Symtable_result sym_result = symtable_findItem(frameStack.bottom->frame,
-                                               key, &item);
-    if(sym_result != SYMTABLE_SUCCESS) {
-        DString_free(key);
-        return ERROR_SEM_UNDEF;
-    }
-    SymtableFunctionData *data = (SymtableFunctionData*)item->data;
-
     AST_ArgOrParamNode *arg = funNode->arguments;
 
     // Projdeme všechny argumenty
-    for(size_t i = 0; i < data->paramCount; i++) {
+    for(size_t i = 0; i < paramCount; i++) {
         // Málo argumentů ve volání
         if(arg == NULL) {
-            DString_free(key);
             return ERROR_SEM_PARAMS_OR_RETVAL;
         }
 
@@ -898,17 +1105,18 @@ ErrorType semantic_analyseFunCall(AST_FunCallNode *funNode, Semantic_Data *retur
         Semantic_Data actualType = SEM_DATA_UNKNOWN;
         ErrorType result = semantic_analyseExpr(arg->expression, &actualType, NULL);
         if(result != SUCCESS) {
-            DString_free(key);
             return result;
         }
 
         // Zjistíme, jestli sedí typ argumentu
-        Semantic_Data defined_type = semantic_returnToSemType(data->params[i].type);
+        Symtable_functionReturnType paramType = (builtIn != NULL) ?
+                                                builtIn->params[i].type :
+                                                data->params[i].type;
+        Semantic_Data defined_type = semantic_returnToSemType(paramType);
 
         result = semantic_compatibleAssign(defined_type, actualType);
 
         if(result != SUCCESS) {
-            DString_free(key);
             return result;
         }
 
@@ -916,7 +1124,6 @@ ErrorType semantic_analyseFunCall(AST_FunCallNode *funNode, Semantic_Data *retur
         arg = arg->next;
     }
 
-    DString_free(key);
     // Přebývají argumenty
     if(arg != NULL) {
         return ERROR_SEM_PARAMS_OR_RETVAL;
@@ -924,7 +1131,7 @@ ErrorType semantic_analyseFunCall(AST_FunCallNode *funNode, Semantic_Data *retur
 
     // Předáme typ návratové hodnoty funkce
     if(returnType != NULL) {
-        *returnType = semantic_returnToSemType(data->returnType);
+        *returnType = semantic_returnToSemType(definedReturn);
     }
 
     return SUCCESS;
@@ -1102,137 +1309,196 @@ ErrorType semantic_analyseCondition(AST_IfNode *ifWhileNode) {
 }  // semantic_analyseCondition
 
 
+/**
+ * @brief Získá hodnotu aritmetické operace
+ */
 ErrorType semantic_getArithmeticValue(Semantic_Data type, void *leftValue,
-                                  void *rightValue, AST_BinOpType op, void **value) {
+                                      void *rightValue, AST_BinOpType op, Semantic_Value *value) {
 
     if(type == SEM_DATA_INT) {
-        int *result = malloc(sizeof(int));
-        if(result == NULL) {
-            return ERROR_INTERNAL;
-        }
-        int left = *(int*)leftValue;
-        int right = *(int*)rightValue;
+        // Počítáme v širším typu, abychom poznali přetečení i32
+        int64_t left = *(int*)leftValue;
+        int64_t right = *(int*)rightValue;
+        int64_t result;
 
         switch(op) {
             case AST_OP_ADD:
-                *result = left + right;
+                result = left + right;
                 break;
             case AST_OP_SUBTRACT:
-                *result = left - right;
+                result = left - right;
                 break;
             case AST_OP_MULTIPLY:
-                *result = left * right;
+                result = left * right;
                 break;
             case AST_OP_DIVIDE:
                 if(right == 0) {
                     return ERROR_SEM_OTHER;
                 }
-                // Aby se dělelní pro záporná čísla chovalo jako Zig,
-                // tak převedeme na double a zaokrouhlíme dolů
-                *result = (int)(floor((double)left / (double)right));
+                // Celočíselné dělení zaokrouhluje dolů stejně jako instrukce IDIVS
+                result = left / right;
+                if(left % right != 0 && (left < 0) != (right < 0)) {
+                    result--;
+                }
                 break;
             default:
                 return ERROR_INTERNAL;
         }
-        *value = result;
+
+        // Přetečení i32 ve výrazu známém při překladu je v jazyce Zig chybou
+        if(result < INT_MIN || result > INT_MAX) {
+            return ERROR_SEM_OTHER;
+        }
+        value->intValue = (int)result;
     }
     else {
-        double *result = malloc(sizeof(double));
-        if(result == NULL) {
-            return ERROR_INTERNAL;
-        }
         double left = *(double*)leftValue;
         double right = *(double*)rightValue;
 
         switch(op) {
             case AST_OP_ADD:
-                *result = left + right;
+                value->floatValue = left + right;
                 break;
             case AST_OP_SUBTRACT:
-                *result = left - right;
+                value->floatValue = left - right;
                 break;
             case AST_OP_MULTIPLY:
-                *result = left * right;
+                value->floatValue = left * right;
                 break;
             case AST_OP_DIVIDE:
                 if(right == 0) {
                     return ERROR_SEM_OTHER;
                 }
-                *result = left / right;
+                value->floatValue = left / right;
                 break;
             default:
                 return ERROR_INTERNAL;
         }
-        *value = result;
     }
     return SUCCESS;
-}
+}  // semantic_getArithmeticValue
 
+/**
+ * @brief Získá hodnotu relační operace
+ */
 ErrorType semantic_getRelationValue(Semantic_Data type, void *leftValue, void *rightValue,
-                          AST_BinOpType op, void **value) {
+                                    AST_BinOpType op, Semantic_Value *value) {
+    // Celá čísla porovnáváme jako f64, to je pro hodnoty i32 přesné
+    double left;
+    double right;
+    if(type == SEM_DATA_INT) {
+        left = *(int*)leftValue;
+        right = *(int*)rightValue;
+    }
+    else {
+        left = *(double*)leftValue;
+        right = *(double*)rightValue;
+    }
+
+    switch(op) {
+        case AST_OP_EQUAL:
+            value->boolValue = left == right;
+            break;
+        case AST_OP_NOT_EQUAL:
+            value->boolValue = left != right;
+            break;
+        case AST_OP_LESS_THAN:
+            value->boolValue = left < right;
+            break;
+        case AST_OP_LESS_EQUAL:
+            value->boolValue = left <= right;
+            break;
+        case AST_OP_GREATER_THAN:
+            value->boolValue = left > right;
+            break;
+        case AST_OP_GREATER_EQUAL:
+            value->boolValue = left >= right;
+            break;
+        default:
+            return ERROR_INTERNAL;
+    }
+
+    return SUCCESS;
+}  // semantic_getRelationValue
+
+/**
+ * @brief Vyhodnotí relační operaci, pokud známe hodnoty obou operandů
+ */
+ErrorType semantic_foldRelation(AST_BinOpNode *binNode, Semantic_Data type, void *leftValue,
+                                void *rightValue, Semantic_Value *value, bool *known) {
+    // Porovnávat umíme pouze hodnoty i32 a f64
+    if(leftValue == NULL || rightValue == NULL ||
+       (type != SEM_DATA_INT && type != SEM_DATA_FLOAT)) {
+        return SUCCESS;
+    }
+
+    // Konverze mohla hodnotu operandu nahradit, proto ji čteme znovu z literálů
+    AST_VarNode *left = binNode->left->expression;
+    AST_VarNode *right = binNode->right->expression;
+    AST_LiteralType litType = semantic_semToLiteral(type);
+    if(binNode->left->exprType != AST_EXPR_LITERAL || left->literalType != litType ||
+       binNode->right->exprType != AST_EXPR_LITERAL || right->literalType != litType) {
+        return SUCCESS;
+    }
+
+    ErrorType result = semantic_getRelationValue(type, left->value, right->value,
+                                                 binNode->op, value);
+    *known = (result == SUCCESS);
+    return result;
+}  // semantic_foldRelation
 
-    bool *result = malloc(sizeof(bool));
-    if(result == NULL) {
+/**
+ * @brief Nahradí uzel binární operace literálem s její hodnotou
+ */
+ErrorType semantic_foldBinOp(AST_ExprNode *node, Semantic_Data type, Semantic_Value value,
+                             void **literalValue) {
+    AST_BinOpNode *binNode = node->expression;
+    AST_LiteralType litType = semantic_semToLiteral(type);
+
+    // Literálem se stane levý operand, jehož hodnota je známá
+    AST_ExprNode *leftExpr = binNode->left;
+    if(leftExpr->exprType != AST_EXPR_LITERAL) {
         return ERROR_INTERNAL;
     }
-    if(type == SEM_DATA_INT) {
-        int left = *(int*)leftValue;
-        int right = *(int*)rightValue;
+    AST_VarNode *literal = leftExpr->expression;
 
-        switch(op) {
-            case AST_OP_EQUAL:
-                *result = left == right;
-                break;
-            case AST_OP_NOT_EQUAL:
-                *result = left != right;
-                break;
-            case AST_OP_LESS_THAN:
-                *result = left < right;
-                break;
-            case AST_OP_LESS_EQUAL:
-                *result = left <= right;
-                break;
-            case AST_OP_GREATER_THAN:
-                *result = left > right;
-                break;
-            case AST_OP_GREATER_EQUAL:
-                *result = left >= right;
-                break;
-            default:
-                return ERROR_INTERNAL;
+    // Paměť hodnoty levého operandu pojme výsledek stejného typu i pravdivostní
+    // hodnotu, jinak (po konverzi) alokujeme novou
+    if(literal->value == NULL ||
+       (litType != AST_LITERAL_BOOL && literal->literalType != litType)) {
+        void *storage = malloc(litType == AST_LITERAL_FLOAT ? sizeof(double) : sizeof(int));
+        if(storage == NULL) {
+            return ERROR_INTERNAL;
         }
+        free(literal->value);
+        literal->value = storage;
     }
-    else {
-        double left = *(double*)leftValue;
-        double right = *(double*)rightValue;
 
-        switch(op) {
-            case AST_OP_EQUAL:
-                *result = left == right;
-                break;
-            case AST_OP_NOT_EQUAL:
-                *result = left != right;
-                break;
-            case AST_OP_LESS_THAN:
-                *result = left < right;
-                break;
-            case AST_OP_LESS_EQUAL:
-                *result = left <= right;
-                break;
-            case AST_OP_GREATER_THAN:
-                *result = left > right;
-                break;
-            case AST_OP_GREATER_EQUAL:
-                *result = left >= right;
-                break;
-            default:
-                return ERROR_INTERNAL;
-        }
+    switch(litType) {
+        case AST_LITERAL_INT:
+            *(int*)literal->value = value.intValue;
+            break;
+        case AST_LITERAL_FLOAT:
+            *(double*)literal->value = value.floatValue;
+            break;
+        case AST_LITERAL_BOOL:
+            *(bool*)literal->value = value.boolValue;
+            break;
+        default:
+            return ERROR_INTERNAL;
     }
+    literal->literalType = litType;
+
+    // Uzel literálu odpojíme od operace a zbytek operace uvolníme
+    leftExpr->expression = NULL;
+    AST_destroyNode(AST_BIN_OP_NODE, binNode);
+
+    node->exprType = AST_EXPR_LITERAL;
+    node->expression = literal;
+    *literalValue = literal->value;
 
-    *value = result;
     return SUCCESS;
-}
+}  // semantic_foldBinOp
 
 /**
  * @brief Vyhodnotí, zda lze provést přiřazení z typu from do typu to
@@ -1451,19 +1717,20 @@ Semantic_Data semantic_ASTToSemType(AST_DataType type) {
 /**
  * @brief Převede hodnotu z typu int na typ float
  */
-ErrorType semantic_toFloat(AST_ExprNode *node) {
+ErrorType semantic_toFloat(AST_ExprNode *node, void **value) {
     AST_VarNode *varNode = node->expression;
 
-    int value = *(int*)varNode->value;
+    int intValue = *(int*)varNode->value;
     // Alokujeme paměť pro výsledek
     double* result = (double*)malloc(sizeof(double));
     if (result == NULL) {
         return ERROR_INTERNAL;
     }
-    *result = (double)value;
+    *result = (double)intValue;
     free(varNode->value);
     varNode->value = result;
     varNode->literalType = AST_LITERAL_FLOAT;
+    *value = result;
 
     return SUCCESS;
 }  // semantic_toFloat
@@ -1471,15 +1738,15 @@ ErrorType semantic_toFloat(AST_ExprNode *node) {
 /**
  * @brief Převede hodnotu z typu float na typ int
  */
-ErrorType semantic_toInt(AST_ExprNode *node) {
+ErrorType semantic_toInt(AST_ExprNode *node, void **value) {
     AST_VarNode *varNode = node->expression;
-    double value = *(double*)varNode->value;
-    // Zkontrolujeme, jestli má value desetinnou část
-    if (value != trunc(value)) {
+    double floatValue = *(double*)varNode->value;
+    // Zkontrolujeme, jestli má hodnota desetinnou část
+    if (floatValue != trunc(floatValue)) {
         return ERROR_SEM_TYPE_COMPATIBILITY;
     }
-    // Zkontrolujeme, jestli se value vejde do int
-    if (value < INT_MIN || value > INT_MAX) {
+    // Zkontrolujeme, jestli se hodnota vejde do int
+    if (floatValue < INT_MIN || floatValue > INT_MAX) {
         return ERROR_SEM_TYPE_COMPATIBILITY;
     }
     // Alokujeme pamět pro výsledek
@@ -1487,10 +1754,11 @@ ErrorType semantic_toInt(AST_ExprNode *node) {
     if (result == NULL) {
         return ERROR_INTERNAL;
     }
-    *result = (int)value;
+    *result = (int)floatValue;
     free(varNode->value);
     varNode->value = result;
     varNode->literalType = AST_LITERAL_INT;
+    *value = result;
 
     return SUCCESS;
 }  // semantic_toInt
@@ -30,6 +30,7 @@
 
 #include <stdlib.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <math.h>
 #include "ast_nodes.h"
 #include "ast_interface.h"
@@ -38,6 +39,11 @@
 #include "error.h"
 
 
+#define SEMANTIC_THREADS_ENV "IFJ24_SEMANTIC_THREADS"   /**< Proměnná prostředí s počtem vláken analýzy */
+#define SEMANTIC_MAX_THREADS 16                         /**< Maximální počet vláken analýzy funkcí      */
+#define SEMANTIC_PARALLEL_THRESHOLD 64                  /**< Minimální počet funkcí pro paralelní analýzu */
+
+
 /**
  * @brief Typy dat pro sémantickou analýzu
  */
@@ -55,6 +61,19 @@ typedef enum {
     SEM_DATA_NULL = 10
 } Semantic_Data;
 
+/**
+ * @brief Hodnota výrazu vyhodnoceného při překladu
+ *
+ * @details Výsledek aritmetické nebo relační operace se známými operandy se
+ *          ukládá přímo do této struktury, bez alokace na haldě. Do AST se
+ *          zapíše až při nahrazení operace literálem.
+ */
+typedef union {
+    int intValue;           /**< Hodnota typu i32                   */
+    double floatValue;      /**< Hodnota typu f64                   */
+    bool boolValue;         /**< Výsledek relační operace           */
+} Semantic_Value;
+
 /*******************************************************************************
  *                                                                             *
  *                          FUNKCE PRO ANALÝZU PROGRAMU                        *
@@ -71,6 +90,19 @@ typedef enum {
  */
 void semantic_analyseProgram();
 
+/**
+ * @brief Provede sémantickou analýzu programu s vynecháním vybraných funkcí.
+ *
+ * @details Slouží pro inkrementální překlad, kdy je výsledek analýzy
+ *          nezměněných funkcí již znám. Struktura programu se kontroluje vždy.
+ *
+ * @param [in] selectedFunctions Příznaky analyzovaných funkcí v pořadí seznamu
+ *                               funkcí, nebo `NULL` pro všechny funkce
+ * @param [in] selectedFrames Příznaky kontrolovaných rámců indexované ID rámce,
+ *                            nebo `NULL` pro všechny rámce
+ */
+void semantic_analyseSelected(const bool *selectedFunctions, const bool *selectedFrames);
+
 
 /**
  * @brief Provede sémantickou analýzu základní struktury programu.
@@ -93,6 +125,43 @@ ErrorType semantic_analyseProgramStructure();
  */
 ErrorType semantic_analyseFunctionDefinitions();
 
+/**
+ * @brief Provede sémantickou analýzu vybraných definic funkcí
+ *
+ * @param [in] selected Příznaky analyzovaných funkcí v pořadí seznamu funkcí,
+ *                      nebo `NULL` pro všechny funkce
+ *
+ * @return SUCCESS, pokud nebyla nalezena sémantická chyba, jinak kód chyby
+ */
+ErrorType semantic_analyseSelectedFunctions(const bool *selected);
+
+/**
+ * @brief Vrátí počet vláken pro analýzu daného počtu funkcí
+ *
+ * @details Počet vláken lze nastavit proměnnou prostředí
+ *          @c SEMANTIC_THREADS_ENV, jinak odpovídá počtu procesorů. Pro méně
+ *          než @c SEMANTIC_PARALLEL_THRESHOLD funkcí se vlákna nevytváří.
+ *          Hodnotu proměnné vykládá funkce @c settings_threadCount().
+ *
+ * @param [in] count Počet analyzovaných funkcí
+ *
+ * @return Počet vláken včetně volajícího (alespoň 1)
+ */
+size_t semantic_threadCount(size_t count);
+
+/**
+ * @brief Analyzuje funkce ze sdíleného stavu, dokud nějaké zbývají
+ *
+ * @details Tělo každé funkce pracuje pouze se svými rámci (adresovanými
+ *          ID rámce z pole rámců) a globální tabulku funkcí jen čte, funkce
+ *          proto lze analyzovat souběžně bez zámků.
+ *
+ * @param [in,out] arg Ukazatel na sdílený stav analýzy (viz semantic_analyser.c)
+ *
+ * @return Vždy `NULL`
+ */
+void *semantic_poolWorker(void *arg);
+
 
 /**
  * @brief Provede sémantickou analýzu všech proměnných v programu
@@ -106,6 +175,31 @@ ErrorType semantic_analyseFunctionDefinitions();
  */
 ErrorType semantic_analyseVariables();
 
+/**
+ * @brief Provede sémantickou analýzu proměnných ve vybraných rámcích
+ *
+ * @param [in] selected Příznaky kontrolovaných rámců indexované ID rámce,
+ *                      nebo `NULL` pro všechny rámce
+ *
+ * @return SUCCESS, pokud nebyla nalezena sémantická chyba, jinak kód chyby
+ */
+ErrorType semantic_analyseVariablesInFrames(const bool *selected);
+
+/**
+ * @brief Provede sémantickou analýzu proměnných jednoho rámce
+ *
+ * @details Prochází jen živé položky tabulky symbolů v pořadí jejich
+ *          deklarace, takže je kontrola lineární v počtu deklarovaných
+ *          symbolů, a ne v kapacitě tabulky. Rámec lze zkontrolovat, jakmile
+ *          jsou příznaky jeho položek konečné, nezávisle na ostatních rámcích.
+ *
+ * @param [in] table Tabulka symbolů kontrolovaného rámce
+ *
+ * @return SUCCESS, pokud nebyla nalezena sémantická chyba, jinak kód chyby
+ *         první chybné proměnné v pořadí deklarace
+ */
+ErrorType semantic_analyseFrameVariables(SymtablePtr table);
+
 
 /**
  * @brief Provede sémantickou analýzu bloku funkce
@@ -146,6 +240,21 @@ ErrorType semantic_probeFunction(AST_FunDefNode *node);
 ErrorType semantic_probeBlock(Semantic_Data funReturn,
                               AST_StatementNode *statement, bool* returned);
 
+/**
+ * @brief Odstraní z bloku definice konstant, které byly dosazeny do všech použití
+ *
+ * @details Po analýze funkce jsou všechna použití konstant se známou hodnotou
+ *          typu `i32` nebo `f64` nahrazena literály. Pokud na konstantu
+ *          nezůstal v AST žádný odkaz, odstraní se i její definice, takže se
+ *          pro ni negeneruje `DEFVAR` ani `MOVE`. Funkce prochází rekurzivně
+ *          i bloky podmínek a cyklů.
+ *
+ * @param [in,out] statementList Ukazatel na první příkaz bloku
+ *
+ * @return  SUCCESS, pokud vše proběhlo v pořádku, jinak ERROR_INTERNAL
+ */
+ErrorType semantic_dropPropagatedConstants(AST_StatementNode **statementList);
+
 
 /**
  * @brief Provede sémantickou analýzu definice proměnné
@@ -220,6 +329,11 @@ ErrorType semantic_analyseReturn(Semantic_Data funReturn, AST_ExprNode *node);
  *          nastaví typ a hodnotu. Pro binární operátory a volání funkcí volá
  *          další funkce (semantic_analyseFunCall, semantic_analyseBinOp).
  *
+ *          Každý uzel výrazu se analyzuje právě jednou. Výraz se známou
+ *          hodnotou je po analýze nahrazen literálem, který hodnotu uchovává,
+ *          a implicitní konverze operandu vrací novou hodnotu literálu, takže
+ *          se podstrom po konverzi znovu neprochází.
+ *
  * @param [in] exprNode Ukazatel na uzel výrazu
  * @param [out] type Ukazatel na proměnnou, do které se uloží typ výrazu
  * @param [out] value Ukazatel na proměnnou, do které se uloží hodnota výrazu
@@ -234,7 +348,8 @@ ErrorType semantic_analyseExpr(AST_ExprNode *exprNode, Semantic_Data *type, void
  * @details Podle typu operátoru volá další funkce pro analýzu přiřazení,
  *          aritmetického operátoru nebo relačního operátoru. Vrací typ a
  *          hodnotu výrazu, pokud je známa. Pokud je hodnota známa, tak se uzel
- *          binární operace změní na uzel literálu.
+ *          binární operace změní na uzel literálu, a to i tehdy, když volající
+ *          hodnotu nepožaduje (@p value je `NULL`).
  *
  * @param [in] node Ukazatel na uzel binárního operátoru
  * @param [out] type Ukazatel na proměnnou, do které se uloží typ výrazu
@@ -267,10 +382,12 @@ ErrorType semantic_analyseAssignmentBinOp(AST_BinOpNode *binNode, Semantic_Data
  * @param [in] binNode Ukazatel na uzel binární operace
  * @param [out] type Ukazatel na proměnnou, do které se uloží typ výrazu
  * @param [out] value Ukazatel na proměnnou, do které se uloží hodnota výrazu
+ * @param [out] known Nastaví se na `true`, pokud je hodnota výrazu známa
  *
  * @return  SUCCESS, pokud nebyla nalezena sémantická chyba, jinak kód chyby
  */
-ErrorType semantic_analyseArithmeticBinOp(AST_BinOpNode *binNode, Semantic_Data *type, void **value);
+ErrorType semantic_analyseArithmeticBinOp(AST_BinOpNode *binNode, Semantic_Data *type,
+                                          Semantic_Value *value, bool *known);
 
 /**
  * @brief Provede sémantickou analýzu relačního operátoru
@@ -282,16 +399,20 @@ ErrorType semantic_analyseArithmeticBinOp(AST_BinOpNode *binNode, Semantic_Data
  * @param [in] binNode Ukazatel na uzel binární operace
  * @param [out] type Ukazatel na proměnnou, do které se uloží typ výrazu
  * @param [out] value Ukazatel na proměnnou, do které se uloží hodnota výrazu
+ * @param [out] known Nastaví se na `true`, pokud je hodnota výrazu známa
  *
  * @return  SUCCESS, pokud nebyla nalezena sémantická chyba, jinak kód chyby
  */
-ErrorType semantic_analyseRelationBinOp(AST_BinOpNode *binNode, Semantic_Data *type, void **value);
+ErrorType semantic_analyseRelationBinOp(AST_BinOpNode *binNode, Semantic_Data *type,
+                                        Semantic_Value *value, bool *known);
 
 /**
  * @brief Získá hodnotu aritmetické operace
  *
  * @details Provede aritmetickou operaci mezi dvěma hodnotami a vrátí výsledek.
- *          Předpokládá, že typy operandů jsou kompatibilní.
+ *          Předpokládá, že typy operandů jsou kompatibilní. Celočíselné dělení
+ *          zaokrouhluje dolů (jako instrukce IDIVS). Dělení nulou a přetečení
+ *          typu i32 jsou stejně jako v jazyce Zig chybou překladu.
  *
  * @param [in] type Typ operandů
  * @param [in] leftValue Ukazatel na hodnotu levého operandu
@@ -302,7 +423,7 @@ ErrorType semantic_analyseRelationBinOp(AST_BinOpNode *binNode, Semantic_Data *t
  * @return  SUCCESS, pokud bylo možné získat hodnotu, jinak kód chyby
  */
 ErrorType semantic_getArithmeticValue(Semantic_Data type, void *leftValue,
-                                  void *rightValue, AST_BinOpType op, void **value);
+                                      void *rightValue, AST_BinOpType op, Semantic_Value *value);
 
 /**
  * @brief Získá hodnotu relační operace
@@ -319,7 +440,42 @@ ErrorType semantic_getArithmeticValue(Semantic_Data type, void *leftValue,
  * @return  SUCCESS, pokud bylo možné získat hodnotu, jinak kód chyby
  */
 ErrorType semantic_getRelationValue(Semantic_Data type, void *leftValue, void *rightValue,
-                          AST_BinOpType op, void **value);
+                                    AST_BinOpType op, Semantic_Value *value);
+
+/**
+ * @brief Vyhodnotí relační operaci, pokud známe hodnoty obou operandů
+ *
+ * @details Hodnoty operandů čte z literálů v AST, protože předchozí konverze
+ *          typu mohla původní hodnotu operandu nahradit.
+ *
+ * @param [in] binNode Ukazatel na uzel binární operace
+ * @param [in] type Typ, ve kterém se operandy porovnávají
+ * @param [in] leftValue Hodnota levého operandu, nebo `NULL`, pokud není známa
+ * @param [in] rightValue Hodnota pravého operandu, nebo `NULL`, pokud není známa
+ * @param [out] value Ukazatel na proměnnou, do které se uloží výsledek
+ * @param [out] known Nastaví se na `true`, pokud byl výsledek vyhodnocen
+ *
+ * @return  SUCCESS, pokud nebyla nalezena sémantická chyba, jinak kód chyby
+ */
+ErrorType semantic_foldRelation(AST_BinOpNode *binNode, Semantic_Data type, void *leftValue,
+                                void *rightValue, Semantic_Value *value, bool *known);
+
+/**
+ * @brief Nahradí uzel binární operace literálem s její hodnotou
+ *
+ * @details Jako literál se použije uzel levého operandu včetně paměti pro
+ *          jeho hodnotu, pokud do ní výsledek vejde. Zbytek operace se uvolní.
+ *
+ * @param [in,out] node Ukazatel na uzel výrazu s binární operací
+ * @param [in] type Typ výsledku operace
+ * @param [in] value Hodnota výsledku operace
+ * @param [out] literalValue Ukazatel na proměnnou, do které se uloží ukazatel
+ *                           na hodnotu nového literálu
+ *
+ * @return  SUCCESS, pokud se náhrada podařila, jinak kód chyby
+ */
+ErrorType semantic_foldBinOp(AST_ExprNode *node, Semantic_Data type, Semantic_Value value,
+                             void **literalValue);
 
 
 /**
@@ -417,10 +573,11 @@ ErrorType semantic_compatibleArithmetic(Semantic_Data type1, Semantic_Data type2
  *          Uvolní předchozí hodnotu a nastaví novou.
  *
  * @param [in] node Ukazatel na uzel s výrazem
+ * @param [out] value Ukazatel, do kterého se uloží nová hodnota literálu
  *
  * @return  SUCCESS, pokud byla konverze úspěšná, jinak kód chyby
  */
-ErrorType semantic_toInt(AST_ExprNode *node);
+ErrorType semantic_toInt(AST_ExprNode *node, void **value);
 
 /**
  * @brief Převede hodnotu z typu int na typ float
@@ -430,10 +587,11 @@ ErrorType semantic_toInt(AST_ExprNode *node);
  *          Uvolní předchozí hodnotu a nastaví novou.
  *
  * @param [in] node Ukazatel na uzel s výrazem
+ * @param [out] value Ukazatel, do kterého se uloží nová hodnota literálu
  *
  * @return  SUCCESS, pokud byla konverze úspěšná, jinak kód chyby
  */
-ErrorType semantic_toFloat(AST_ExprNode *node);
+ErrorType semantic_toFloat(AST_ExprNode *node, void **value);
 
 
 /*******************************************************************************
@@ -0,0 +1,77 @@
+/*******************************************************************************
+ *                                                                             *
+ * Název projektu:   Implementace překladače imperativního jazyka IFJ24        *
+ *                                                                             *
+ * Soubor:           settings.c                                                *
+ * Autor:            Farkašovský Lukáš  <xfarkal00>                            *
+ *                                                                             *
+ * Datum:            04.12.2024                                                *
+ * Poslední změna:   04.12.2024                                                *
+ *                                                                             *
+ * Tým:      Tým xkalinj00                                                     *
+ * Členové:  Farkašovský Lukáš    <xfarkal00>                                  *
+ *           Hýža Pavel           <xhyzapa00>                                  *
+ *           Kalina Jan           <xkalinj00>                                  *
+ *           Krejčí David         <xkrejcd00>                                  *
+ *                                                                             *
+ ******************************************************************************/
+/**
+ * @file settings.c
+ * @author Farkašovský Lukáš \<xfarkal00>
+ *
+ * @brief Implementace čtení přepínačů překladače z prostředí.
+ */
+
+// Kvůli funkci sysconf()
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "settings.h"
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                        IMPLEMENTACE VEŘEJNÝCH FUNKCÍ                        *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Zjistí, zda hodnota přepínače @c IFJ24_* v prostředí danou volbu zapíná.
+ */
+bool settings_isEnabled(const char *setting) {
+    return !(setting == NULL || *setting == '\0' || strcmp(setting, "0") == 0);
+} // settings_isEnabled()
+
+/**
+ * @brief Vrátí počet vláken pro paralelní zpracování daného počtu položek.
+ */
+size_t settings_threadCount(const char *setting, size_t count, size_t threshold, size_t maximum) {
+    if(count < threshold) {
+        return 1;
+    }
+
+    long threads = sysconf(_SC_NPROCESSORS_ONLN);
+    if(setting != NULL && *setting != '\0') {
+        // Hodnotu přijmeme, jen pokud ji celou tvoří platné číslo
+        char *end = NULL;
+        errno = 0;
+        long value = strtol(setting, &end, 10);
+        if(errno == 0 && *end == '\0') {
+            threads = value;
+        }
+    }
+
+    if(threads < 1) {
+        return 1;
+    }
+    if((unsigned long)threads > maximum) {
+        return maximum;
+    }
+
+    return (size_t)threads;
+} // settings_threadCount()
+
+/*** Konec souboru settings.c ***/
@@ -0,0 +1,76 @@
+/*******************************************************************************
+ *                                                                             *
+ * Název projektu:   Implementace překladače imperativního jazyka IFJ24        *
+ *                                                                             *
+ * Soubor:           settings.h                                                *
+ * Autor:            Farkašovský Lukáš  <xfarkal00>                            *
+ *                                                                             *
+ * Datum:            04.12.2024                                                *
+ * Poslední změna:   04.12.2024                                                *
+ *                                                                             *
+ * Tým:      Tým xkalinj00                                                     *
+ * Členové:  Farkašovský Lukáš    <xfarkal00>                                  *
+ *           Hýža Pavel           <xhyzapa00>                                  *
+ *           Kalina Jan           <xkalinj00>                                  *
+ *           Krejčí David         <xkrejcd00>                                  *
+ *                                                                             *
+ ******************************************************************************/
+/**
+ * @file settings.h
+ * @author Farkašovský Lukáš \<xfarkal00>
+ *
+ * @brief Hlavičkový soubor pro čtení přepínačů překladače z prostředí.
+ * @details Moduly překladače dostávají hodnotu své proměnné prostředí
+ *          @c IFJ24_* jako řetězec a vykládají ji funkcemi tohoto modulu.
+ *          Modul nezávisí na žádné fázi překladu, takže jej mohou použít
+ *          scanner, parser i výpis cílového kódu.
+ */
+
+#ifndef SETTINGS_H_
+/** @cond  */
+#define SETTINGS_H_
+/** @endcond  */
+
+#include <stdbool.h>
+#include <stddef.h>
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                         DEKLARACE VEŘEJNÝCH FUNKCÍ                          *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Zjistí, zda hodnota přepínače @c IFJ24_* v prostředí danou volbu zapíná.
+ *
+ * @details Volbu vypíná nenastavená proměnná, prázdný řetězec a hodnota `0`,
+ *          jakákoliv jiná hodnota ji zapíná. Všechny přepínače překladače
+ *          (např. @c PRATT_PARSER_ENV) tak čtou hodnotu stejně.
+ *
+ * @param [in] setting Hodnota proměnné prostředí, nebo `NULL`
+ *
+ * @return `true`, pokud je volba zapnuta, jinak `false`.
+ */
+bool settings_isEnabled(const char *setting);
+
+/**
+ * @brief Vrátí počet vláken pro paralelní zpracování daného počtu položek.
+ *
+ * @details Hodnotou přepínače je kladné dekadické číslo. Nenastavená proměnná,
+ *          prázdný řetězec a hodnota, která není celým číslem (např. `abc`
+ *          nebo `4x`), ponechají počet vláken na počtu procesorů. Hodnota
+ *          `0` paralelní zpracování vypne.
+ *
+ * @param [in] setting Hodnota proměnné prostředí, nebo `NULL`
+ * @param [in] count Počet zpracovávaných položek
+ * @param [in] threshold Nejmenší počet položek, pro který se vytváří vlákna
+ * @param [in] maximum Nejvyšší povolený počet vláken
+ *
+ * @return Počet vláken včetně volajícího (alespoň 1, nejvýše @p maximum)
+ */
+size_t settings_threadCount(const char *setting, size_t count, size_t threshold, size_t maximum);
+
+#endif // SETTINGS_H_
+
+/*** Konec souboru settings.h ***/
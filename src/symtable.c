@@ -48,15 +48,20 @@ SymtablePtr symtable_init() {
     table->allocatedSize = TABLE_INIT_SIZE;
     table->usedSize = 0;
 
-    // Inicializujeme pole položek
+    // Inicializujeme pole položek a pole pořadí vložení
     SymtableItemPtr items = symtable_initItems(TABLE_INIT_SIZE);
+    size_t *order = malloc(TABLE_INIT_SIZE * sizeof(size_t));
     // Pokud se nepodařilo alokovat paměť, uvolníme tabulku a vracíme NULL
-    if(items == NULL) {
+    if(items == NULL || order == NULL) {
+        free(items);
+        free(order);
         free(table);
         return NULL;
     }
     // Přiřadíme pole položek do tabulky
     table->array = items;
+    table->order = order;
+    table->itemCount = 0;
 
     return table;
 }  // symtable_init()
@@ -119,8 +124,12 @@ Symtable_result symtable_addItem(Symtable *table, DString *key, SymtableItem **o
             item->constant = false;
             item->knownValue = false;
             item->used = false;
+            item->referenced = false;
             item->changed = false;
 
+            // Zapíšeme index položky na konec pořadí vložení
+            table->order[table->itemCount++] = index;
+
             // Pokud je požadován odkaz na novou položku, vrátíme ho
             if(outItem != NULL) {
                 *outItem = item;
@@ -235,6 +244,18 @@ Symtable_result symtable_deleteItem(Symtable *table, DString *key) {
         item->data = NULL;
     }
     item->symbolState = SYMTABLE_SYMBOL_DEAD;
+
+    // Odstraníme index položky z pořadí vložení
+    size_t index = (size_t)(item - table->array);
+    for(size_t i = 0; i < table->itemCount; i++) {
+        if(table->order[i] == index) {
+            memmove(&table->order[i], &table->order[i + 1],
+                    (table->itemCount - i - 1) * sizeof(size_t));
+            table->itemCount--;
+            break;
+        }
+    }
+
     return SYMTABLE_SUCCESS;
 }  // symtable_deleteItem()
 
@@ -247,10 +268,10 @@ void symtable_deleteAll(Symtable *table, bool keepData) {
         return;
     }
 
-    // Procházíme všechny položky v tabulce
-    for(size_t i = 0; i < table->allocatedSize; i++) {
+    // Procházíme živé položky v pořadí vložení
+    for(size_t k = 0; k < table->itemCount; k++) {
         // Pokud je položka prázdná nebo mrtvá, pokračujeme
-        SymtableItem item = table->array[i];
+        SymtableItem item = table->array[table->order[k]];
 
         // Pokud je položka živá, odstraníme ji
         if(item.symbolState != SYMTABLE_SYMBOL_EMPTY &&
@@ -261,14 +282,6 @@ void symtable_deleteAll(Symtable *table, bool keepData) {
                 // Pokud je položka funkce, uvolníme i její parametry
                 if(item.symbolState == SYMTABLE_SYMBOL_FUNCTION) {
                     SymtableFunctionData *data = (SymtableFunctionData *)item.data;
-                    // Pokud je funkce vestavěná, tak uvolníme stringy
-                    if(item.key->length > 4) {
-                        if(memcmp(item.key->str, "ifj.", 4) == 0) {
-                            for(size_t j = 0; j < data->paramCount; j++) {
-                                DString_free(data->params[j].id);
-                            }
-                        }
-                    }
                     free(data->params);
                     free(item.data);
                     item.data = NULL;
@@ -294,6 +307,8 @@ void symtable_deleteAll(Symtable *table, bool keepData) {
             item.symbolState = SYMTABLE_SYMBOL_DEAD;
         }
     }
+
+    table->itemCount = 0;
 }  // symtable_deleteAll()
 
 /**
@@ -307,6 +322,7 @@ inline void symtable_destroyTable(Symtable *table) {
     // Odstraníme všechny položky
     symtable_deleteAll(table, false);
     free(table->array);
+    free(table->order);
     free(table);
 }  // symtable_destroyTable()
 
@@ -458,13 +474,9 @@ bool symtable_transfer(Symtable *outTable, Symtable *inTable) {
         return false;
     }
 
-    // Procházíme všechny položky v tabulce
-    for(size_t i = 0; i < outTable->allocatedSize; i++) {
-        // Pokud je položka prázdná nebo mrtvá, pokračujeme
-        if(outTable->array[i].symbolState == SYMTABLE_SYMBOL_EMPTY ||
-           outTable->array[i].symbolState == SYMTABLE_SYMBOL_DEAD) {
-            continue;
-        }
+    // Procházíme živé položky v pořadí vložení, aby se pořadí zachovalo
+    for(size_t j = 0; j < outTable->itemCount; j++) {
+        size_t i = outTable->order[j];
 
         // Vytvoříme novou položku v cílové tabulce
         SymtableItemPtr newLocation;
@@ -479,6 +491,7 @@ bool symtable_transfer(Symtable *outTable, Symtable *inTable) {
         newLocation->constant = outTable->array[i].constant;
         newLocation->knownValue = outTable->array[i].knownValue;
         newLocation->used = outTable->array[i].used;
+        newLocation->referenced = outTable->array[i].referenced;
         newLocation->changed = outTable->array[i].changed;
     }
     return true;
@@ -500,10 +513,13 @@ Symtable *symtable_resize(Symtable *table, size_t size) {
         return NULL;
     }
 
-    // Alokujeme paměť pro nové pole položek
+    // Alokujeme paměť pro nové pole položek a pole pořadí vložení
     newTable->array = symtable_initItems(size);
+    newTable->order = malloc(size * sizeof(size_t));
     // Pokud se nepodařilo alokovat paměť, uvolníme pomocnou tabulku a vracíme NULL
-    if(newTable->array == NULL) {
+    if(newTable->array == NULL || newTable->order == NULL) {
+        free(newTable->array);
+        free(newTable->order);
         free(newTable);
         return NULL;
     }
@@ -511,6 +527,7 @@ Symtable *symtable_resize(Symtable *table, size_t size) {
     // Inicializujeme pomocnou tabulku
     newTable->allocatedSize = size;
     newTable->usedSize = 0;
+    newTable->itemCount = 0;
     // Přeneseme data z původní tabulky do pomocné
     if(symtable_transfer(table, newTable) == false) {
         return NULL;
@@ -518,7 +535,10 @@ Symtable *symtable_resize(Symtable *table, size_t size) {
     // Uvolníme původní pole položek
     symtable_deleteAll(table, true);
     free(table->array);
+    free(table->order);
     table->array = newTable->array;
+    table->order = newTable->order;
+    table->itemCount = newTable->itemCount;
     table->allocatedSize = size;
     free(newTable);
 
@@ -544,6 +564,7 @@ inline SymtableItemPtr symtable_initItems(size_t size) {
         items[i].constant = false;
         items[i].knownValue = false;
         items[i].used = false;
+        items[i].referenced = false;
         items[i].changed = false;
     }
     return items;
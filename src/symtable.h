@@ -122,6 +122,7 @@ typedef struct {
     DString *key;                       /**< Klíč položky (identifikátor) */
     Symtable_symbolState symbolState;   /**< Stav symbolu dle výčtu `Symtable_symbolState` */
     bool used;                          /**< Příznak, zda je položka použita */
+    bool referenced;                    /**< Příznak, zda na položku zůstal odkaz v AST */
     bool knownValue;                    /**< Příznak, zda má položka hodnotu známou při překladu */
     bool constant;                      /**< Příznak, zda je položka konstantní */
     bool changed;                       /**< Příznak, zda byla hodnota položky změněna */
@@ -156,11 +157,18 @@ typedef struct {
  *          Obsahuje pole položek, jehož velikost se dynamicky upravuje
  *          při přidávání nových položek, když je zaplněno
  *          více než MAX_FULLNESS_BEFORE_EXPAND.
+ *
+ *          Indexy živých položek jsou navíc uloženy v hustém poli @c order
+ *          v pořadí vložení, takže lze projít všechny symboly tabulky
+ *          v čase úměrném jejich počtu, a ne kapacitě tabulky. Kapacita pole
+ *          @c order je rovna @c allocatedSize.
  */
 typedef struct {
     size_t allocatedSize;          /**< Velikost alokovaného pole položek */
     size_t usedSize;               /**< Počet použitých položek včetně mrtvých*/
     SymtableItem *array;            /**< Pole položek */
+    size_t *order;                  /**< Indexy živých položek v pořadí vložení */
+    size_t itemCount;               /**< Počet živých položek (délka pole `order`) */
 } Symtable, *SymtablePtr;
 
 
@@ -319,7 +327,8 @@ size_t symtable_hashFunction(DString *key);
  * @brief Přesun dat z jedné tabulky do druhé
  *
  * @details Přesune všechny položky z jedné tabulky do druhé.
- *          Položky jsou naindexovány znovu podle nové velikosti tabulky.
+ *          Položky jsou naindexovány znovu podle nové velikosti tabulky,
+ *          pořadí vložení zůstane zachováno.
  * @note Funkce se využívá při rozšiřování
  *
  * @param [in] outTable Zdrojová tabulka
@@ -28,10 +28,56 @@
  *          AST, jako jsou definice funkcí, výrazy, podmínky a smyčky.
  */
 
+// Kvůli funkci open_memstream()
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <stdatomic.h>
+
 // Import knihoven překladače
 #include "tac_generator.h"
 #include "semantic_analyser.h"
 #include "built_in_functions.h"
+#include "settings.h"
+
+
+/**
+ * @brief Sdílený stav paralelního generování funkcí
+ *
+ * @details Vlákna si berou funkce podle atomického indexu @c next a kód
+ *          zapisují na index funkce do pole @c codes.
+ */
+typedef struct TAC_Pool {
+    AST_FunDefNode **functions;     /**< Definice funkcí v pořadí výstupu   */
+    TAC_FunctionCode *codes;        /**< Kód jednotlivých funkcí            */
+    size_t count;                   /**< Počet funkcí                       */
+    atomic_size_t next;             /**< Index další funkce ke generování   */
+} TAC_Pool;
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                POČÁTEČNÍ INICIALIZACE GLOBÁLNÍCH PROMĚNNÝCH                 *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Proud, do kterého se zapisuje cílový kód (`NULL` pro standardní výstup).
+ */
+_Thread_local FILE *TAC_output = NULL;
+
+/**
+ * @brief Definice právě generované funkce (pro rozpoznání koncové rekurze).
+ */
+static _Thread_local AST_FunDefNode *currentFunction = NULL;
+
+/**
+ * @brief ID rámce těla právě generované funkce.
+ *
+ * @details Jména proměnných obsahují ID rámce relativní k rámci těla funkce,
+ *          takže kód funkce nezávisí na ostatních funkcích programu.
+ */
+static _Thread_local size_t frameBase = 0;
 
 
 /*******************************************************************************
@@ -47,38 +93,54 @@ void TAC_generateProgram() {
     // Vyresetujeme statické proměnné pro více testů
     TAC_resetStatic();
 
-    // Povinná hlavička (prolog)
-    printf(".IFJcode24\n");
+    TAC_generateProlog();
 
-    // Definice pomocných proměnných pro výpočty
-    printf("DEFVAR GF@?tempDEST\n");
-    printf("DEFVAR GF@?tempSRC1\n");
-    printf("DEFVAR GF@?tempSRC2\n");
+    size_t count = 0;
+    for(AST_FunDefNode *node = ASTroot->functionList; node != NULL; node = node->next) {
+        count++;
+    }
 
-    // Vytvoříme temporary frame pro main
-    printf("CREATEFRAME\n");
-    // Voláme funkci main
-    printf("CALL $$main\n");
-    // Jakmile se vrátíme z funkce main, skočíme na konec programu
-    printf("JUMP $$end$$\n");
+    // Malé programy generujeme přímo na výstup
+    if(TAC_threadCount(count) <= 1) {
+        // Procházíme seznam funkcí a generujeme kód pro každou funkci
+        AST_FunDefNode *node = ASTroot->functionList;
+        while(node != NULL) {
+            fputc('\n', TAC_OUTPUT);
+            TAC_generateFunctionDefinition(node);
+            node = node->next;
+        }
 
-    // Definice vestavěných funkcí
-    TAC_builtInFunctions();
+        TAC_generateEpilog();
+        return;
+    }
+
+    AST_FunDefNode **functions = malloc(count * sizeof(AST_FunDefNode *));
+    TAC_FunctionCode *codes = calloc(count, sizeof(TAC_FunctionCode));
+    if(functions == NULL || codes == NULL) {
+        free(functions);
+        free(codes);
+        error_handle(ERROR_INTERNAL);
+    }
 
-    // Procházíme seznam funkcí a generujeme kód pro každou funkci
     AST_FunDefNode *node = ASTroot->functionList;
-    while(node != NULL) {
-        putchar('\n');
-        TAC_generateFunctionDefinition(node);
-        node = node->next;
+    for(size_t i = 0; i < count; i++, node = node->next) {
+        functions[i] = node;
     }
 
-    // Konec programu
-    // Vypíšeme buffer
-    TAC_bufferPrint(NULL);
-    putchar('\n');
-    printf("LABEL $$end$$\n");
-    putchar('\n');
+    TAC_generateFunctions(functions, codes, count);
+
+    // Kód funkcí vypíšeme v pořadí jejich definic
+    for(size_t i = 0; i < count; i++) {
+        fputc('\n', TAC_OUTPUT);
+        fwrite(codes[i].code, 1, codes[i].length, TAC_OUTPUT);
+        TAC_builtInMarkMask(codes[i].builtIns);
+        free(codes[i].code);
+    }
+
+    free(functions);
+    free(codes);
+
+    TAC_generateEpilog();
 
 }  // TAC_generateProgram
 
@@ -89,23 +151,165 @@ void TAC_generateProgram() {
  *                                                                             *
  ******************************************************************************/
 
+/**
+ * @brief Generuje hlavičku programu a volání funkce main
+ */
+void TAC_generateProlog() {
+    // Povinná hlavička (prolog)
+    fprintf(TAC_OUTPUT, ".IFJcode24\n");
+
+    // Definice pomocných proměnných pro výpočty
+    fprintf(TAC_OUTPUT, "DEFVAR GF@?tempDEST\n");
+    fprintf(TAC_OUTPUT, "DEFVAR GF@?tempSRC1\n");
+    fprintf(TAC_OUTPUT, "DEFVAR GF@?tempSRC2\n");
+
+    // Vytvoříme temporary frame pro main
+    fprintf(TAC_OUTPUT, "CREATEFRAME\n");
+    // Voláme funkci main
+    fprintf(TAC_OUTPUT, "CALL $$main\n");
+    // Jakmile se vrátíme z funkce main, skočíme na konec programu
+    fprintf(TAC_OUTPUT, "JUMP $$end$$\n");
+
+}  // TAC_generateProlog
+
+/**
+ * @brief Generuje konec programu s použitými vestavěnými funkcemi
+ */
+void TAC_generateEpilog() {
+    // Konec programu
+    // Vypíšeme buffer
+    TAC_bufferPrint(NULL);
+    fputc('\n', TAC_OUTPUT);
+
+    // Definice použitých vestavěných funkcí
+    TAC_builtInFunctions();
+    fprintf(TAC_OUTPUT, "LABEL $$end$$\n");
+    fputc('\n', TAC_OUTPUT);
+
+}  // TAC_generateEpilog
+
+/**
+ * @brief Generuje cílový kód definice funkce do paměti
+ */
+void TAC_generateFunctionToBuffer(AST_FunDefNode *funDefNode, TAC_FunctionCode *functionCode) {
+    functionCode->code = NULL;
+    functionCode->length = 0;
+
+    FILE *stream = open_memstream(&functionCode->code, &functionCode->length);
+    if(stream == NULL) {
+        error_handle(ERROR_INTERNAL);
+    }
+
+    // Výstup i masku vestavěných podprogramů přesměrujeme jen na dobu generování
+    FILE *previousOutput = TAC_output;
+    uint32_t previousBuiltIns = TAC_builtInUsedMask();
+    TAC_output = stream;
+    TAC_builtInReset();
+
+    TAC_generateFunctionDefinition(funDefNode);
+
+    functionCode->builtIns = TAC_builtInUsedMask();
+    TAC_output = previousOutput;
+    TAC_builtInMarkMask(previousBuiltIns | functionCode->builtIns);
+
+    if(fclose(stream) != 0) {
+        free(functionCode->code);
+        error_handle(ERROR_INTERNAL);
+    }
+}  // TAC_generateFunctionToBuffer
+
+/**
+ * @brief Generuje cílový kód více funkcí do paměti, případně paralelně
+ */
+void TAC_generateFunctions(AST_FunDefNode **functions, TAC_FunctionCode *codes, size_t count) {
+    TAC_Pool pool = { functions, codes, count, 0 };
+
+    size_t threads = TAC_threadCount(count);
+    pthread_t *workers = threads > 1 ? malloc((threads - 1) * sizeof(pthread_t)) : NULL;
+
+    // Volající vlákno generuje také, pokud se vlákno nevytvoří, práci převezmou ostatní
+    size_t started = 0;
+    for(size_t i = 1; workers != NULL && i < threads; i++) {
+        if(pthread_create(&workers[started], NULL, TAC_poolWorker, &pool) == 0) {
+            started++;
+        }
+    }
+    TAC_poolWorker(&pool);
+    for(size_t i = 0; i < started; i++) {
+        pthread_join(workers[i], NULL);
+    }
+
+    free(workers);
+}  // TAC_generateFunctions
+
+/**
+ * @brief Vrátí počet vláken pro generování daného počtu funkcí
+ */
+size_t TAC_threadCount(size_t count) {
+    return settings_threadCount(getenv(TAC_THREADS_ENV), count, TAC_PARALLEL_THRESHOLD, TAC_MAX_THREADS);
+}  // TAC_threadCount
+
+/**
+ * @brief Generuje funkce ze sdíleného stavu, dokud nějaké zbývají
+ */
+void *TAC_poolWorker(void *arg) {
+    TAC_Pool *pool = arg;
+
+    while(true) {
+        size_t i = atomic_fetch_add(&pool->next, 1);
+        if(i >= pool->count) {
+            break;
+        }
+
+        TAC_generateFunctionToBuffer(pool->functions[i], &pool->codes[i]);
+    }
+
+    return NULL;
+}  // TAC_poolWorker
+
 /**
  * @brief Generuje cílový kód definice funkce
  */
 void TAC_generateFunctionDefinition(AST_FunDefNode *funDefNode) {
-    printf("LABEL $$%s\n", funDefNode->identifier->str);
-    printf("PUSHFRAME\n");
+    fprintf(TAC_OUTPUT, "LABEL $$%s\n", funDefNode->identifier->str);
+    fprintf(TAC_OUTPUT, "PUSHFRAME\n");
+
+    currentFunction = funDefNode;
+
+    // Návěští se číslují od nuly v každé funkci zvlášť
+    TAC_resetLabels();
+
+    // Relativní ID rámců počítáme od rámce těla funkce
+    frameBase = 0;
+    SymtableItemPtr function = NULL;
+    if(symtable_findItem(frameStack.bottom->frame, funDefNode->identifier,
+                         &function) == SYMTABLE_SUCCESS && function->data != NULL) {
+        frameBase = ((SymtableFunctionData *)function->data)->bodyFrameID;
+    }
 
-    TAC_generateStatementBlock(funDefNode->body, TAC_ALL);
+    // Koncová rekurze skáče zpět na začátek těla, proto musí být všechny
+    // proměnné definovány ještě před návěštím (stejně jako u cyklu while)
+    if(TAC_hasSelfTailCall(funDefNode->body)) {
+        TAC_generateStatementBlock(funDefNode->body, TAC_VAR_DEF_ONLY);
+        TAC_bufferPrint(NULL);
+        fprintf(TAC_OUTPUT, "LABEL $$%s$tail\n", funDefNode->identifier->str);
+        TAC_generateStatementBlock(funDefNode->body, TAC_EXCEPT_VAR_DEF);
+    }
+    else {
+        TAC_generateStatementBlock(funDefNode->body, TAC_ALL);
+    }
 
     // Vypíšeme buffer
     TAC_bufferPrint(NULL);
     // Pokud je funkce void, tak jí přidáme return
     if(funDefNode->returnType == AST_DATA_TYPE_VOID) {
-        printf("POPFRAME\n");
-        printf("RETURN\n");
+        fprintf(TAC_OUTPUT, "POPFRAME\n");
+        fprintf(TAC_OUTPUT, "RETURN\n");
     }
 
+    currentFunction = NULL;
+    frameBase = 0;
+
 }  // TAC_generateFunctionDefinition
 
 
@@ -187,13 +391,13 @@ void TAC_generateBinaryOperator(AST_BinOpNode *binNode) {
                 TAC_bufferPrint(&buffer);
             } else {
                 // Nahrajeme hodnotu výrazu do proměnné
-                writtenSize = snprintf(buffer, OPTIMIZE_BUFFER_SIZE, "POPS LF@%s$%lu$\n", var->identifier->str, var->frameID);
+                writtenSize = snprintf(buffer, OPTIMIZE_BUFFER_SIZE, "POPS LF@%s$%lu$\n", var->identifier->str, var->frameID - frameBase);
                 // Pokud nám nestačí velikost bufferu
                 if(writtenSize >= OPTIMIZE_BUFFER_SIZE) {
                     // Vypíšeme buffer
                     TAC_bufferPrint(NULL);
                     // Vypíšeme instukci přímo
-                    printf("POPS LF@%s$%lu$\n", var->identifier->str, var->frameID);
+                    fprintf(TAC_OUTPUT, "POPS LF@%s$%lu$\n", var->identifier->str, var->frameID - frameBase);
                 }
                 TAC_bufferPrint(&buffer);
             }
@@ -201,15 +405,15 @@ void TAC_generateBinaryOperator(AST_BinOpNode *binNode) {
 
         case AST_OP_ADD:
             TAC_bufferPrint(NULL);
-            printf("ADDS\n");
+            fprintf(TAC_OUTPUT, "ADDS\n");
             break;
         case AST_OP_SUBTRACT:
             TAC_bufferPrint(NULL);
-            printf("SUBS\n");
+            fprintf(TAC_OUTPUT, "SUBS\n");
             break;
         case AST_OP_MULTIPLY:
             TAC_bufferPrint(NULL);
-            printf("MULS\n");
+            fprintf(TAC_OUTPUT, "MULS\n");
             break;
         case AST_OP_DIVIDE:
             // Musíme zjistit, zda se jedná o celočíselné nebo desetinné dělení
@@ -219,37 +423,37 @@ void TAC_generateBinaryOperator(AST_BinOpNode *binNode) {
 
             TAC_bufferPrint(NULL);
             if(type == SEM_DATA_INT) {
-                printf("IDIVS\n");
+                fprintf(TAC_OUTPUT, "IDIVS\n");
             } else {
-                printf("DIVS\n");
+                fprintf(TAC_OUTPUT, "DIVS\n");
             }
             break;
         case AST_OP_EQUAL:
             TAC_bufferPrint(NULL);
-            printf("EQS\n");
+            fprintf(TAC_OUTPUT, "EQS\n");
             break;
         case AST_OP_NOT_EQUAL:
             TAC_bufferPrint(NULL);
-            printf("EQS\n");
-            printf("NOTS\n");
+            fprintf(TAC_OUTPUT, "EQS\n");
+            fprintf(TAC_OUTPUT, "NOTS\n");
             break;
         case AST_OP_LESS_THAN:
             TAC_bufferPrint(NULL);
-            printf("LTS\n");
+            fprintf(TAC_OUTPUT, "LTS\n");
             break;
         case AST_OP_GREATER_THAN:
             TAC_bufferPrint(NULL);
-            printf("GTS\n");
+            fprintf(TAC_OUTPUT, "GTS\n");
             break;
         case AST_OP_LESS_EQUAL:
             TAC_bufferPrint(NULL);
-            printf("GTS\n");
-            printf("NOTS\n");
+            fprintf(TAC_OUTPUT, "GTS\n");
+            fprintf(TAC_OUTPUT, "NOTS\n");
             break;
         case AST_OP_GREATER_EQUAL:
             TAC_bufferPrint(NULL);
-            printf("LTS\n");
-            printf("NOTS\n");
+            fprintf(TAC_OUTPUT, "LTS\n");
+            fprintf(TAC_OUTPUT, "NOTS\n");
             break;
 
         default:
@@ -279,7 +483,7 @@ void TAC_generateVarDef(AST_ExprNode *exprNode, TAC_mode mode) {
 
     if(mode != TAC_EXCEPT_VAR_DEF) {
         TAC_bufferPrint(NULL);
-        printf("DEFVAR LF@%s$%lu$ \n", var->identifier->str, var->frameID);
+        fprintf(TAC_OUTPUT, "DEFVAR LF@%s$%lu$ \n", var->identifier->str, var->frameID - frameBase);
     }
     if(mode != TAC_VAR_DEF_ONLY) {
         // Na vrchol zásobníku vložíme hodnotu výrazu vpravo
@@ -289,12 +493,12 @@ void TAC_generateVarDef(AST_ExprNode *exprNode, TAC_mode mode) {
         char buffer[OPTIMIZE_BUFFER_SIZE] = {0};
         int writtenSize = 0;
         // Nahrajeme hodnotu výrazu do proměnné
-        writtenSize = snprintf(buffer, OPTIMIZE_BUFFER_SIZE, "POPS LF@%s$%lu$ \n", var->identifier->str, var->frameID);
+        writtenSize = snprintf(buffer, OPTIMIZE_BUFFER_SIZE, "POPS LF@%s$%lu$ \n", var->identifier->str, var->frameID - frameBase);
         if(writtenSize >= OPTIMIZE_BUFFER_SIZE) {
             // Vypíšeme buffer
             TAC_bufferPrint(NULL);
             // Vypíšeme instukci přímo
-            printf("POPS LF@%s$%lu$ \n", var->identifier->str, var->frameID);
+            fprintf(TAC_OUTPUT, "POPS LF@%s$%lu$ \n", var->identifier->str, var->frameID - frameBase);
         }
         TAC_bufferPrint(&buffer);
     }
@@ -321,12 +525,12 @@ void TAC_generateExpression(AST_ExprNode *expr) {
             break;
         case AST_EXPR_VARIABLE:
             // Pokud je proměnná, tak se její hodnota rovnou nahraje na vrchol zásobníku
-            writtenSize = snprintf(buffer, OPTIMIZE_BUFFER_SIZE, "PUSHS LF@%s$%lu$\n", var->identifier->str, var->frameID);
+            writtenSize = snprintf(buffer, OPTIMIZE_BUFFER_SIZE, "PUSHS LF@%s$%lu$\n", var->identifier->str, var->frameID - frameBase);
             if(writtenSize >= OPTIMIZE_BUFFER_SIZE) {
                 // Vypíšeme buffer
                 TAC_bufferPrint(NULL);
                 // Vypíšeme instukci přímo
-                printf("PUSHS LF@%s$%lu$\n", var->identifier->str, var->frameID);
+                fprintf(TAC_OUTPUT, "PUSHS LF@%s$%lu$\n", var->identifier->str, var->frameID - frameBase);
             }
             TAC_bufferPrint(&buffer);
             break;
@@ -359,9 +563,12 @@ void TAC_generateLiteral(AST_VarNode *literal) {
         case AST_LITERAL_INT:
             snprintf(buffer, OPTIMIZE_BUFFER_SIZE, "PUSHS int@%d \n", *(int*)literal->value);
             break;
-        case AST_LITERAL_FLOAT:
-            snprintf(buffer, OPTIMIZE_BUFFER_SIZE, "PUSHS float@%a \n", *(double*)literal->value);
+        case AST_LITERAL_FLOAT: {
+            char number[NUMBER_HEX_FLOAT_SIZE];
+            numberLiteral_formatHexFloat(*(double*)literal->value, number);
+            snprintf(buffer, OPTIMIZE_BUFFER_SIZE, "PUSHS float@%s \n", number);
             break;
+        }
         case AST_LITERAL_STRING:
             value = (DString*)literal->value;
             value = TAC_convertSpecialSymbols(value);
@@ -394,7 +601,7 @@ void TAC_generateIf(AST_IfNode *ifNode, TAC_mode mode) {
     }
 
     // Unikátní identifikátor pro if
-    static unsigned int count = 0;
+    static _Thread_local unsigned int count = 0;
     unsigned int id = count;
     count++;
 
@@ -410,7 +617,7 @@ void TAC_generateIf(AST_IfNode *ifNode, TAC_mode mode) {
         if(ifNode->nullCondition != NULL) {
             DString *idWithoutNull = ifNode->nullCondition->identifier;
             TAC_bufferPrint(NULL);
-            printf("DEFVAR LF@%s$%lu$\n", idWithoutNull->str, ifNode->nullCondition->frameID);
+            fprintf(TAC_OUTPUT, "DEFVAR LF@%s$%lu$\n", idWithoutNull->str, ifNode->nullCondition->frameID - frameBase);
         }
         // Definujeme proměnné v then a else větvích
         TAC_generateStatementBlock(ifNode->thenBranch, TAC_VAR_DEF_ONLY);
@@ -419,39 +626,39 @@ void TAC_generateIf(AST_IfNode *ifNode, TAC_mode mode) {
     }
 
     // Vyhodnotíme podmínku
-    printf("# if_%d\n", id);
+    fprintf(TAC_OUTPUT, "# if_%d\n", id);
     TAC_generateExpression(ifNode->condition);
-    printf("# then_%d\n", id);
+    fprintf(TAC_OUTPUT, "# then_%d\n", id);
     // je bool nebo null podmínka?
     if(ifNode->nullCondition == NULL) {
         TAC_bufferPrint(NULL);
-        printf("PUSHS bool@true\n");
-        printf("JUMPIFNEQS if_else$%d\n", id);
+        fprintf(TAC_OUTPUT, "PUSHS bool@true\n");
+        fprintf(TAC_OUTPUT, "JUMPIFNEQS if_else$%s$%d\n", currentFunction->identifier->str, id);
     }
     else {
         // Výsledek podmínky vložíme do proměnné
         char buffer[OPTIMIZE_BUFFER_SIZE] = "POPS GF@?tempSRC1\n";
         TAC_bufferPrint(&buffer);
         TAC_bufferPrint(NULL);
-        printf("JUMPIFEQ if_else$%d GF@?tempSRC1 nil@nil\n", id);
+        fprintf(TAC_OUTPUT, "JUMPIFEQ if_else$%s$%d GF@?tempSRC1 nil@nil\n", currentFunction->identifier->str, id);
         // Definujeme id_bez_null
         DString *idWithoutNull = ifNode->nullCondition->identifier;
         if(mode != TAC_EXCEPT_VAR_DEF) {
-            printf("DEFVAR LF@%s$%lu$\n", idWithoutNull->str, ifNode->nullCondition->frameID);
+            fprintf(TAC_OUTPUT, "DEFVAR LF@%s$%lu$\n", idWithoutNull->str, ifNode->nullCondition->frameID - frameBase);
         }
-        printf("MOVE LF@%s$%lu$ GF@?tempSRC1\n", idWithoutNull->str, ifNode->nullCondition->frameID);
+        fprintf(TAC_OUTPUT, "MOVE LF@%s$%lu$ GF@?tempSRC1\n", idWithoutNull->str, ifNode->nullCondition->frameID - frameBase);
     }
 
     // Generujeme tělo if
     TAC_generateStatementBlock(ifNode->thenBranch, mode);
     TAC_bufferPrint(NULL);
-    printf("JUMP if_end$%d\n", id);
+    fprintf(TAC_OUTPUT, "JUMP if_end$%s$%d\n", currentFunction->identifier->str, id);
 
     // Generujeme tělo else
-    printf("LABEL if_else$%d\n", id);
+    fprintf(TAC_OUTPUT, "LABEL if_else$%s$%d\n", currentFunction->identifier->str, id);
     TAC_generateStatementBlock(ifNode->elseBranch, mode);
     TAC_bufferPrint(NULL);
-    printf("LABEL if_end$%d\n", id);
+    fprintf(TAC_OUTPUT, "LABEL if_end$%s$%d\n", currentFunction->identifier->str, id);
 
 }  // TAC_generateIf
 
@@ -460,7 +667,7 @@ void TAC_generateIf(AST_IfNode *ifNode, TAC_mode mode) {
  */
 void TAC_generateWhile(AST_WhileNode *whileNode, TAC_mode mode) {
     // Unikátní identifikátor pro while
-    static unsigned int count = 0;
+    static _Thread_local unsigned int count = 0;
     unsigned int id = count;
 
     count++;
@@ -477,7 +684,7 @@ void TAC_generateWhile(AST_WhileNode *whileNode, TAC_mode mode) {
         // Definujeme NULL podmínku pokud existuje
         if(whileNode->nullCondition != NULL) {
             DString *idWithoutNull = whileNode->nullCondition->identifier;
-            printf("DEFVAR LF@%s$%lu$\n", idWithoutNull->str, whileNode->nullCondition->frameID);
+            fprintf(TAC_OUTPUT, "DEFVAR LF@%s$%lu$\n", idWithoutNull->str, whileNode->nullCondition->frameID - frameBase);
         }
         // Definujeme proměnné v těle while
         TAC_generateStatementBlock(whileNode->body, TAC_VAR_DEF_ONLY);
@@ -485,42 +692,45 @@ void TAC_generateWhile(AST_WhileNode *whileNode, TAC_mode mode) {
     }
     // Pokud máme NULL podmínku, tak nejdříve definujeme id_bez_null
     DString *idWithoutNull = NULL;
-    if(whileNode->nullCondition != NULL && mode != TAC_EXCEPT_VAR_DEF) {
+    if(whileNode->nullCondition != NULL) {
         idWithoutNull = whileNode->nullCondition->identifier;
-        printf("DEFVAR LF@%s$%lu$\n", idWithoutNull->str, whileNode->nullCondition->frameID);
+        // V režimu bez definic ji už definoval nadřazený blok
+        if(mode != TAC_EXCEPT_VAR_DEF) {
+            fprintf(TAC_OUTPUT, "DEFVAR LF@%s$%lu$\n", idWithoutNull->str, whileNode->nullCondition->frameID - frameBase);
+        }
     }
     // Definujeme proměnné těla
     if(mode == TAC_ALL) {
-        printf("# Definice vsech promennych v tele while\n");
+        fprintf(TAC_OUTPUT, "# Definice vsech promennych v tele while\n");
         TAC_generateStatementBlock(whileNode->body, TAC_VAR_DEF_ONLY);
     }
     // Návěští začátku while
-    printf("LABEL while_start$%d\n", id);
+    fprintf(TAC_OUTPUT, "LABEL while_start$%s$%d\n", currentFunction->identifier->str, id);
     // Vyhodnotíme podmínku
     TAC_generateExpression(whileNode->condition);
-    printf("# while_body_%d\n", id);
+    fprintf(TAC_OUTPUT, "# while_body_%d\n", id);
     // Je pravdivostní nebo null podmínka?
     if(whileNode->nullCondition == NULL) {
-        printf("PUSHS bool@true\n");
-        printf("JUMPIFNEQS while_end$%d\n", id);
+        fprintf(TAC_OUTPUT, "PUSHS bool@true\n");
+        fprintf(TAC_OUTPUT, "JUMPIFNEQS while_end$%s$%d\n", currentFunction->identifier->str, id);
     }
     else {
         // Výsledek podmínky uložíme do proměnné
         char buffer[OPTIMIZE_BUFFER_SIZE] = "POPS GF@?tempSRC1\n";
         TAC_bufferPrint(&buffer);
         TAC_bufferPrint(NULL);
-        printf("JUMPIFEQ while_end$%d GF@?tempSRC1 nil@nil\n", id);
+        fprintf(TAC_OUTPUT, "JUMPIFEQ while_end$%s$%d GF@?tempSRC1 nil@nil\n", currentFunction->identifier->str, id);
         // Přesuneme hodnotu do idWithoutNull
 
-        printf("MOVE LF@%s$%lu$ GF@?tempSRC1\n", idWithoutNull->str, whileNode->nullCondition->frameID);
+        fprintf(TAC_OUTPUT, "MOVE LF@%s$%lu$ GF@?tempSRC1\n", idWithoutNull->str, whileNode->nullCondition->frameID - frameBase);
     }
 
     // Generujeme tělo while
     TAC_generateStatementBlock(whileNode->body, TAC_EXCEPT_VAR_DEF);
     TAC_bufferPrint(NULL);
     // Skočíme na začátek cyklu
-    printf("JUMP while_start$%d\n", id);
-    printf("LABEL while_end$%d\n", id);
+    fprintf(TAC_OUTPUT, "JUMP while_start$%s$%d\n", currentFunction->identifier->str, id);
+    fprintf(TAC_OUTPUT, "LABEL while_end$%s$%d\n", currentFunction->identifier->str, id);
 
 }  // TAC_generateWhile
 
@@ -528,12 +738,18 @@ void TAC_generateWhile(AST_WhileNode *whileNode, TAC_mode mode) {
  * @brief Generuje cílový kód pro návrat z funkce
  */
 void TAC_generateReturn(AST_ExprNode *expr) {
+    // Koncové volání sebe sama nahradíme skokem na začátek funkce
+    if(TAC_isSelfTailCall(expr)) {
+        TAC_generateTailCall(expr->expression);
+        return;
+    }
+
     // Na datový zásobník vyhodnotíme výraz
     TAC_generateExpression(expr);
     TAC_bufferPrint(NULL);
     // Vrátíme se z funkce
-    printf("POPFRAME\n");
-    printf("RETURN\n");
+    fprintf(TAC_OUTPUT, "POPFRAME\n");
+    fprintf(TAC_OUTPUT, "RETURN\n");
 }  // TAC_generateReturn
 
 void TAC_generateFunctionCall(AST_FunCallNode *funCallNode) {
@@ -546,21 +762,21 @@ void TAC_generateFunctionCall(AST_FunCallNode *funCallNode) {
     if(funCallNode->isBuiltIn) {
         if(DString_compareWithConstChar(funCallNode->identifier, "readstr") == STRING_EQUAL) {
             // Načteme řetězec a výsledek nahrajeme na zásobník
-            printf("READ GF@?tempSRC1 string\n");
+            fprintf(TAC_OUTPUT, "READ GF@?tempSRC1 string\n");
             snprintf(buffer, OPTIMIZE_BUFFER_SIZE, "PUSHS GF@?tempSRC1\n");
             TAC_bufferPrint(&buffer);
             return;
         }
         else if(DString_compareWithConstChar(funCallNode->identifier, "readi32") == STRING_EQUAL) {
             // Načteme číslo a výsledek nahrajeme na zásobník
-            printf("READ GF@?tempSRC1 int\n");
+            fprintf(TAC_OUTPUT, "READ GF@?tempSRC1 int\n");
             snprintf(buffer, OPTIMIZE_BUFFER_SIZE, "PUSHS GF@?tempSRC1\n");
             TAC_bufferPrint(&buffer);
             return;
         }
         else if(DString_compareWithConstChar(funCallNode->identifier, "readf64") == STRING_EQUAL) {
             // Načteme číslo a výsledek nahrajeme na zásobník
-            printf("READ GF@?tempSRC1 float\n");
+            fprintf(TAC_OUTPUT, "READ GF@?tempSRC1 float\n");
             snprintf(buffer, OPTIMIZE_BUFFER_SIZE, "PUSHS GF@?tempSRC1\n");
             TAC_bufferPrint(&buffer);
             return;
@@ -572,21 +788,21 @@ void TAC_generateFunctionCall(AST_FunCallNode *funCallNode) {
             snprintf(buffer, OPTIMIZE_BUFFER_SIZE, "POPS GF@?tempSRC1\n");
             TAC_bufferPrint(&buffer);
             TAC_bufferPrint(NULL);
-            printf("WRITE GF@?tempSRC1\n");
+            fprintf(TAC_OUTPUT, "WRITE GF@?tempSRC1\n");
             return;
         }
         else if(DString_compareWithConstChar(funCallNode->identifier, "i2f") == STRING_EQUAL) {
             // Vyhodnotíme parametr
             TAC_generateExpression(funCallNode->arguments->expression);
             TAC_bufferPrint(NULL);
-            printf("INT2FLOATS\n");
+            fprintf(TAC_OUTPUT, "INT2FLOATS\n");
             return;
         }
         else if(DString_compareWithConstChar(funCallNode->identifier, "f2i") == STRING_EQUAL) {
             // Vyhodnotíme parametr
             TAC_generateExpression(funCallNode->arguments->expression);
             TAC_bufferPrint(NULL);
-            printf("FLOAT2INTS\n");
+            fprintf(TAC_OUTPUT, "FLOAT2INTS\n");
             return;
         }
         else if(DString_compareWithConstChar(funCallNode->identifier, "string") == STRING_EQUAL) {
@@ -600,8 +816,8 @@ void TAC_generateFunctionCall(AST_FunCallNode *funCallNode) {
             TAC_bufferPrint(&buffer);
             TAC_bufferPrint(NULL);
             // Zjistíme délku řetězce a výsledek nahrajeme na zásobník
-            printf("STRLEN GF@?tempDEST GF@?tempSRC1\n");
-            printf("PUSHS GF@?tempDEST\n");
+            fprintf(TAC_OUTPUT, "STRLEN GF@?tempDEST GF@?tempSRC1\n");
+            fprintf(TAC_OUTPUT, "PUSHS GF@?tempDEST\n");
             return;
         }
         else if(DString_compareWithConstChar(funCallNode->identifier, "concat") == STRING_EQUAL) {
@@ -614,87 +830,81 @@ void TAC_generateFunctionCall(AST_FunCallNode *funCallNode) {
             TAC_bufferPrint(&buffer);
             TAC_bufferPrint(NULL);
             // Spojíme oba řetězce a výsledek nahrajeme na zásobník
-            printf("CONCAT GF@?tempDEST GF@?tempSRC1 GF@?tempSRC2\n");
-            printf("PUSHS GF@?tempDEST\n");
+            fprintf(TAC_OUTPUT, "CONCAT GF@?tempDEST GF@?tempSRC1 GF@?tempSRC2\n");
+            fprintf(TAC_OUTPUT, "PUSHS GF@?tempDEST\n");
+            return;
+        }
+        else if(DString_compareWithConstChar(funCallNode->identifier, "ord") == STRING_EQUAL) {
+            TAC_generateOrd(funCallNode);
             return;
         }
         else if(DString_compareWithConstChar(funCallNode->identifier, "chr") == STRING_EQUAL) {
             // Vyhodnotíme parametr a nahrajeme do pomocné proměnné
             TAC_generateExpression(funCallNode->arguments->expression);
             TAC_bufferPrint(NULL);
-            printf("INT2CHARS\n");
+            fprintf(TAC_OUTPUT, "INT2CHARS\n");
             return;
         }
     }
     // Jinak budeme funkci volat
 
     // Vytvoříme dočasný rámec pro parametry funkce
-    printf("CREATEFRAME\n");
+    fprintf(TAC_OUTPUT, "CREATEFRAME\n");
 
     // Najdeme definici funkce
-    DString *key = NULL;
-    SymtableItemPtr function = NULL;
+    const BuiltInSignature *builtIn = NULL;             /**< Signatura vestavěné funkce */
+    SymtableFunctionData *functionData = NULL;          /**< Definovaná data funkce */
+    size_t paramCount = 0;
 
-    // Pokud je funkce vestavěná, tak přidáme prefix ifj.
+    // Vestavěné funkce hledáme ve statické tabulce signatur
     if(funCallNode->isBuiltIn) {
-        key = DString_constCharToDString("ifj.");
-        if(key == NULL) {
+        builtIn = frameStack_findBuiltIn(funCallNode->identifier);
+        if(builtIn == NULL) {
             error_handle(ERROR_INTERNAL);
         }
-        for(size_t i = 0; i < funCallNode->identifier->length; i++) {
-            DString_appendChar(key, funCallNode->identifier->str[i]);
-        }
+        paramCount = builtIn->paramCount;
     }
-    // Jinak jen překopírujeme identifikátor
+    // Jinak funkci najdeme v globálním rámci
     else {
-        key = DString_init();
-        if(key == NULL) {
+        SymtableItemPtr function = NULL;
+        if(symtable_findItem(frameStack.bottom->frame, funCallNode->identifier,
+                             &function) != SYMTABLE_SUCCESS) {
             error_handle(ERROR_INTERNAL);
         }
-        if(DString_copy(funCallNode->identifier, key) != STRING_SUCCESS) {
-            error_handle(ERROR_INTERNAL);
-        }
-    }
-
-    // Najdeme definici funkce
-    if(symtable_findItem(frameStack.bottom->frame, key, &function) != SYMTABLE_SUCCESS) {
-        DString_free(key);
-        error_handle(ERROR_INTERNAL);
+        functionData = function->data;
+        paramCount = functionData->paramCount;
     }
 
-    SymtableFunctionData *functionData = function->data;    /**< Definovaná data funkce */
     AST_ArgOrParamNode *arg = funCallNode->arguments;       /**< Argumenty volání funkce */
     // Pro všechny parametry
-    for(size_t i = 0; i < functionData->paramCount; i++) {
-        char *paramId = functionData->params[i].id->str;
-        if(funCallNode->isBuiltIn) {
+    for(size_t i = 0; i < paramCount; i++) {
+        if(builtIn != NULL) {
             // Built-in funkce nemají rámcový suffix
-            printf("DEFVAR TF@%s\n", paramId);
-        }
-        else {
-            printf("DEFVAR TF@%s$%lu$\n", paramId, functionData->bodyFrameID);
-        }
-        // Na zásobník vyhodnotíme hodnotu parametru
-        TAC_generateExpression(arg->expression);
-        // Vytvoříme instrukci DEFVAR pro parametr
-        // Pokud je funkce vestavěná, tak se nepřidává frameID do názvu
-        if(funCallNode->isBuiltIn) {
-            // Vstavěné funkce nemají rámcový suffix
+            const char *paramId = builtIn->params[i].id;
+            fprintf(TAC_OUTPUT, "DEFVAR TF@%s\n", paramId);
+
+            // Na zásobník vyhodnotíme hodnotu parametru
+            TAC_generateExpression(arg->expression);
             writtenSize = snprintf(buffer, OPTIMIZE_BUFFER_SIZE, "POPS TF@%s\n", paramId);
             if(writtenSize >= OPTIMIZE_BUFFER_SIZE) {
                 // Vypíšeme buffer
                 TAC_bufferPrint(NULL);
                 // Vypíšeme instukci přímo
-                printf("POPS TF@%s\n", paramId);
+                fprintf(TAC_OUTPUT, "POPS TF@%s\n", paramId);
             }
         }
         else {
-            writtenSize = snprintf(buffer, OPTIMIZE_BUFFER_SIZE, "POPS TF@%s$%lu$\n", paramId, functionData->bodyFrameID);
+            char *paramId = functionData->params[i].id->str;
+            fprintf(TAC_OUTPUT, "DEFVAR TF@%s$0$\n", paramId);
+
+            // Na zásobník vyhodnotíme hodnotu parametru
+            TAC_generateExpression(arg->expression);
+            writtenSize = snprintf(buffer, OPTIMIZE_BUFFER_SIZE, "POPS TF@%s$0$\n", paramId);
             if(writtenSize >= OPTIMIZE_BUFFER_SIZE) {
                 // Vypíšeme buffer
                 TAC_bufferPrint(NULL);
                 // Vypíšeme instukci přímo
-                printf("POPS TF@%s$%lu$\n", paramId, functionData->bodyFrameID);
+                fprintf(TAC_OUTPUT, "POPS TF@%s$0$\n", paramId);
             }
         }
         // Vypíšeme buffer
@@ -706,15 +916,136 @@ void TAC_generateFunctionCall(AST_FunCallNode *funCallNode) {
 
     // Přidáme skok na návěští funkce
     if(funCallNode->isBuiltIn) {
-        printf("CALL $$ifj$%s\n", funCallNode->identifier->str);
+        fprintf(TAC_OUTPUT, "CALL $$ifj$%s\n", funCallNode->identifier->str);
+        TAC_builtInMarkUsed(funCallNode->identifier->str);
     }
     else {
-        printf("CALL $$%s\n", key->str);
+        fprintf(TAC_OUTPUT, "CALL $$%s\n", funCallNode->identifier->str);
     }
-    DString_free(key);
 
 }  // TAC_generateFunctionCall
 
+/**
+ * @brief Zjistí, zda výraz za příkazem return je voláním právě generované funkce
+ */
+bool TAC_isSelfTailCall(AST_ExprNode *expr) {
+    if(currentFunction == NULL || expr == NULL || expr->exprType != AST_EXPR_FUN_CALL) {
+        return false;
+    }
+
+    AST_FunCallNode *funCallNode = expr->expression;
+    return !funCallNode->isBuiltIn &&
+           DString_compare(funCallNode->identifier, currentFunction->identifier) == STRING_EQUAL;
+}  // TAC_isSelfTailCall
+
+/**
+ * @brief Zjistí, zda blok příkazů obsahuje koncové volání právě generované funkce
+ */
+bool TAC_hasSelfTailCall(AST_StatementNode *statement) {
+    while(statement != NULL) {
+        switch(statement->statementType) {
+            case AST_STATEMENT_RETURN:
+                if(TAC_isSelfTailCall(statement->statement)) {
+                    return true;
+                }
+                break;
+            case AST_STATEMENT_IF: {
+                AST_IfNode *ifNode = statement->statement;
+                if(TAC_hasSelfTailCall(ifNode->thenBranch) ||
+                   TAC_hasSelfTailCall(ifNode->elseBranch)) {
+                    return true;
+                }
+                break;
+            }
+            case AST_STATEMENT_WHILE: {
+                AST_WhileNode *whileNode = statement->statement;
+                if(TAC_hasSelfTailCall(whileNode->body)) {
+                    return true;
+                }
+                break;
+            }
+            default:
+                break;
+        }
+        statement = statement->next;
+    }
+
+    return false;
+}  // TAC_hasSelfTailCall
+
+/**
+ * @brief Generuje cílový kód pro koncové volání sebe sama
+ */
+void TAC_generateTailCall(AST_FunCallNode *funCallNode) {
+    // Nejprve vyhodnotíme všechny argumenty, aby se ve výrazech použily
+    // ještě původní hodnoty parametrů
+    AST_ArgOrParamNode *arg = funCallNode->arguments;
+    size_t paramCount = 0;
+    while(arg != NULL) {
+        TAC_generateExpression(arg->expression);
+        paramCount++;
+        arg = arg->next;
+    }
+    TAC_bufferPrint(NULL);
+
+    // Hodnoty ze zásobníku přiřadíme parametrům v opačném pořadí
+    for(size_t i = paramCount; i > 0; i--) {
+        AST_ArgOrParamNode *param = currentFunction->parameters;
+        for(size_t j = 1; j < i; j++) {
+            param = param->next;
+        }
+        AST_VarNode *paramVar = param->expression->expression;
+        fprintf(TAC_OUTPUT, "POPS LF@%s$%lu$\n", paramVar->identifier->str, paramVar->frameID - frameBase);
+    }
+
+    // Skočíme zpět na začátek těla funkce bez vytvoření nového rámce
+    fprintf(TAC_OUTPUT, "JUMP $$%s$tail\n", currentFunction->identifier->str);
+}  // TAC_generateTailCall
+
+/**
+ * @brief Generuje cílový kód pro vestavěnou funkci `ifj.ord` přímo v místě volání
+ */
+void TAC_generateOrd(AST_FunCallNode *funCallNode) {
+    // Unikátní identifikátor pro návěští
+    static _Thread_local unsigned int count = 0;
+    unsigned int id = count;
+    count++;
+
+    // Pro reset mezi testy
+    if(funCallNode->type == RESET_STATIC) {
+        count = 0;
+        return;
+    }
+
+    char buffer[OPTIMIZE_BUFFER_SIZE] = {0};
+
+    // Vyhodnotíme oba parametry a nahrajeme do pomocných proměnných
+    TAC_generateExpression(funCallNode->arguments->expression);
+    TAC_generateExpression(funCallNode->arguments->next->expression);
+    snprintf(buffer, OPTIMIZE_BUFFER_SIZE, "POPS GF@?tempSRC2\n");
+    TAC_bufferPrint(&buffer);
+    snprintf(buffer, OPTIMIZE_BUFFER_SIZE, "POPS GF@?tempSRC1\n");
+    TAC_bufferPrint(&buffer);
+    TAC_bufferPrint(NULL);
+
+    // Index musí být v intervalu <0, délka)
+    fprintf(TAC_OUTPUT, "STRLEN GF@?tempDEST GF@?tempSRC1\n");
+    fprintf(TAC_OUTPUT, "LT GF@?tempDEST GF@?tempSRC2 GF@?tempDEST\n");
+    fprintf(TAC_OUTPUT, "JUMPIFEQ ord_zero$%s$%u GF@?tempDEST bool@false\n", currentFunction->identifier->str, id);
+    fprintf(TAC_OUTPUT, "LT GF@?tempDEST GF@?tempSRC2 int@0\n");
+    fprintf(TAC_OUTPUT, "JUMPIFEQ ord_zero$%s$%u GF@?tempDEST bool@true\n", currentFunction->identifier->str, id);
+
+    // Získáme ordinální hodnotu znaku a výsledek nahrajeme na zásobník
+    fprintf(TAC_OUTPUT, "STRI2INT GF@?tempDEST GF@?tempSRC1 GF@?tempSRC2\n");
+    fprintf(TAC_OUTPUT, "PUSHS GF@?tempDEST\n");
+    fprintf(TAC_OUTPUT, "JUMP ord_end$%s$%u\n", currentFunction->identifier->str, id);
+
+    // Index mimo meze vrací 0
+    fprintf(TAC_OUTPUT, "LABEL ord_zero$%s$%u\n", currentFunction->identifier->str, id);
+    fprintf(TAC_OUTPUT, "PUSHS int@0\n");
+    fprintf(TAC_OUTPUT, "LABEL ord_end$%s$%u\n", currentFunction->identifier->str, id);
+}  // TAC_generateOrd
+
 /**
  * @brief Převede speciální znaky na escape sekvence
  */
@@ -750,23 +1081,33 @@ DString *TAC_convertSpecialSymbols(DString *origin) {
  * @brief Resetuje statické proměnné v případě více testů v jednom spuštění
  */
 void TAC_resetStatic() {
+    TAC_resetLabels();
+    TAC_builtInReset();
+}  // TAC_resetStatic
+
+/**
+ * @brief Resetuje počítadla návěští
+ */
+void TAC_resetLabels() {
     AST_IfNode ifNode = {.type = RESET_STATIC};
     AST_WhileNode whileNode = {.type = RESET_STATIC};
+    AST_FunCallNode funCallNode = {.type = RESET_STATIC};
     TAC_generateIf(&ifNode, TAC_ALL);
     TAC_generateWhile(&whileNode, TAC_ALL);
-}  // TAC_resetStatic
+    TAC_generateOrd(&funCallNode);
+}  // TAC_resetLabels
 
 /**
  * @brief Přidá instrukci do bufferu
  */
 void TAC_bufferPrint(char (*newInstruction)[OPTIMIZE_BUFFER_SIZE]) {
 
-    static char buffered[OPTIMIZE_BUFFER_SIZE] = {'\0'};
+    static _Thread_local char buffered[OPTIMIZE_BUFFER_SIZE] = {'\0'};
 
     // Pokud jsme dostali NULL, tak vypíšeme buffer
     if(newInstruction == NULL) {
         if(*buffered != '\0') {
-            printf("%s", buffered);
+            fprintf(TAC_OUTPUT, "%s", buffered);
             *buffered = '\0';
         }
         return;
@@ -788,26 +1129,26 @@ void TAC_bufferPrint(char (*newInstruction)[OPTIMIZE_BUFFER_SIZE]) {
         }
 
         // Pokud se nejedná o stejnou proměnnou, tak nahradíme instukcí move
-        printf("MOVE ");
+        fprintf(TAC_OUTPUT, "MOVE ");
         // Vypíšeme cíl
         char *ptr = *newInstruction + 5;
         while(*ptr != '\0' && *ptr != '\n') {
-            putchar(*ptr);
+            fputc(*ptr, TAC_OUTPUT);
             ptr++;
         }
-        putchar(' ');
+        fputc(' ', TAC_OUTPUT);
         // Vypíšeme zdroj
         ptr = buffered + 6;
         while(*ptr != '\0' && *ptr != '\n') {
-            putchar(*ptr);
+            fputc(*ptr, TAC_OUTPUT);
             ptr++;
         }
-        putchar('\n');
+        fputc('\n', TAC_OUTPUT);
         *buffered = '\0';
     }
     else {
         // Pokud se nejedná o push a pop, tak vypíšeme buffer a uložíme novou instrukci
-        printf("%s", buffered);
+        fprintf(TAC_OUTPUT, "%s", buffered);
         strcpy(buffered, *newInstruction);
     }
 }  // TAC_bufferPrint
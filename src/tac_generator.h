@@ -35,7 +35,9 @@
 /** @endcond  */
 
 // Import standardních knihoven jazyka C
+#include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
 #include <stdbool.h>
 #include <ctype.h>
 
@@ -63,6 +65,12 @@
 
 #define OPTIMIZE_BUFFER_SIZE 2048   /**< Velikost bufferu pro optimalizaci */
 
+#define TAC_OUTPUT (TAC_output != NULL ? TAC_output : stdout)  /**< Proud pro cílový kód */
+
+#define TAC_THREADS_ENV "IFJ24_TAC_THREADS"     /**< Proměnná prostředí s počtem vláken generování */
+#define TAC_MAX_THREADS 16                      /**< Maximální počet vláken generování funkcí      */
+#define TAC_PARALLEL_THRESHOLD 64               /**< Minimální počet funkcí pro paralelní generování */
+
 
 /*******************************************************************************
  *                                                                             *
@@ -83,6 +91,34 @@ typedef enum TAC_mode {
     TAC_EXCEPT_VAR_DEF   /**< Generovat kromě definic proměnných  */
 } TAC_mode;
 
+/**
+ * @brief Cílový kód jedné funkce vygenerovaný do paměti.
+ */
+typedef struct TAC_FunctionCode {
+    char *code;             /**< Kód funkce (uvolňuje volající)                 */
+    size_t length;          /**< Délka kódu v bajtech                           */
+    uint32_t builtIns;      /**< Maska vestavěných podprogramů použitých funkcí */
+} TAC_FunctionCode;
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                       DEKLARACE GLOBÁLNÍCH PROMĚNNÝCH                       *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Proud, do kterého se zapisuje cílový kód.
+ *
+ * @details Hodnota `NULL` znamená standardní výstup. Jiný proud lze nastavit
+ *          například pro zachycení kódu jednotlivých funkcí. Každé vlákno má
+ *          vlastní proud. Testy v C++ proměnnou nepoužívají a deklaraci
+ *          s @c _Thread_local by nepřeložily.
+ */
+#ifndef __cplusplus
+extern _Thread_local FILE *TAC_output;
+#endif
+
 
 /*******************************************************************************
  *                                                                             *
@@ -95,7 +131,9 @@ typedef enum TAC_mode {
  *
  * @details Funkce prochází strom AST a rekurzivně volá funkci
  *          @c TAC_generateFunctionDefinition pro každou definici funkce.
- *          Pracuje s globálním kořenem stromu ASTroot.
+ *          Pracuje s globálním kořenem stromu ASTroot. Programy s mnoha
+ *          funkcemi generuje paralelně do bufferů, které vypíše v pořadí
+ *          definic funkcí.
  */
 void TAC_generateProgram();
 
@@ -106,6 +144,70 @@ void TAC_generateProgram();
  *                                                                             *
  ******************************************************************************/
 
+/**
+ * @brief Generuje hlavičku programu a volání funkce main
+ */
+void TAC_generateProlog();
+
+/**
+ * @brief Generuje konec programu s použitými vestavěnými funkcemi
+ *
+ * @details Vypíše kód podprogramů vestavěných funkcí označených jako použité
+ *          a návěští konce programu.
+ */
+void TAC_generateEpilog();
+
+/**
+ * @brief Generuje cílový kód definice funkce do paměti
+ *
+ * @details Výstup i použité vestavěné podprogramy volajícího vlákna se
+ *          po vygenerování obnoví, podprogramy funkce se k nim přidají.
+ *
+ * @param [in] funDefNode Ukazatel na uzel definice funkce
+ * @param [out] functionCode Vygenerovaný kód a maska jeho podprogramů
+ */
+void TAC_generateFunctionToBuffer(AST_FunDefNode *funDefNode, TAC_FunctionCode *functionCode);
+
+/**
+ * @brief Generuje cílový kód více funkcí do paměti, případně paralelně
+ *
+ * @details Kód každé funkce je v samostatném bufferu na indexu funkce,
+ *          spojením bufferů v pořadí indexů vznikne stejný kód jako při
+ *          sekvenčním generování.
+ *
+ * @param [in] functions Pole ukazatelů na definice funkcí
+ * @param [out] codes Pole pro kód funkcí o velikosti @p count
+ * @param [in] count Počet funkcí
+ */
+void TAC_generateFunctions(AST_FunDefNode **functions, TAC_FunctionCode *codes, size_t count);
+
+/**
+ * @brief Vrátí počet vláken pro generování daného počtu funkcí
+ *
+ * @details Počet vláken lze nastavit proměnnou prostředí @c TAC_THREADS_ENV,
+ *          jinak odpovídá počtu procesorů. Pro méně než
+ *          @c TAC_PARALLEL_THRESHOLD funkcí se vlákna nevytváří. Hodnotu
+ *          proměnné vykládá funkce @c settings_threadCount().
+ *
+ * @param [in] count Počet generovaných funkcí
+ *
+ * @return Počet vláken včetně volajícího (alespoň 1)
+ */
+size_t TAC_threadCount(size_t count);
+
+/**
+ * @brief Generuje funkce ze sdíleného stavu, dokud nějaké zbývají
+ *
+ * @details Stav generátoru (výstup, počítadla návěští, buffer optimalizace
+ *          a použité podprogramy) je lokální pro vlákno, AST každé funkce
+ *          a její rámce zpracovává jediné vlákno.
+ *
+ * @param [in,out] arg Ukazatel na sdílený stav generování (viz tac_generator.c)
+ *
+ * @return Vždy `NULL`
+ */
+void *TAC_poolWorker(void *arg);
+
 /**
  * @brief Generuje cílový kód definice funkce
  *
@@ -242,6 +344,49 @@ void TAC_generateReturn(AST_ExprNode *expr);
  */
 void TAC_generateFunctionCall(AST_FunCallNode *funCallNode);
 
+/**
+ * @brief Zjistí, zda výraz za příkazem return je voláním právě generované funkce
+ *
+ * @param [in] expr Ukazatel na uzel výrazu
+ *
+ * @return `true`, pokud jde o koncové volání sebe sama, jinak `false`.
+ */
+bool TAC_isSelfTailCall(AST_ExprNode *expr);
+
+/**
+ * @brief Zjistí, zda blok příkazů obsahuje koncové volání právě generované funkce
+ *
+ * @details Prochází rekurzivně i větve příkazů if a těla cyklů while.
+ *
+ * @param [in] statement Ukazatel na první příkaz bloku
+ *
+ * @return `true`, pokud blok obsahuje `return f(...)` volající sebe sama.
+ */
+bool TAC_hasSelfTailCall(AST_StatementNode *statement);
+
+/**
+ * @brief Generuje cílový kód pro koncové volání sebe sama
+ *
+ * @details Místo `CREATEFRAME` a `CALL` vyhodnotí argumenty, přiřadí je
+ *          parametrům v aktuálním rámci a skočí na návěští za definicemi
+ *          proměnných funkce. Hloubka zásobníku rámců interpretu tak
+ *          nezávisí na hloubce rekurze.
+ *
+ * @param [in] funCallNode Ukazatel na uzel volání funkce
+ */
+void TAC_generateTailCall(AST_FunCallNode *funCallNode);
+
+/**
+ * @brief Generuje cílový kód pro vestavěnou funkci `ifj.ord` přímo v místě volání
+ *
+ * @details Místo volání podprogramu vyhodnotí oba argumenty, ověří, že index
+ *          leží v mezích řetězce, a použije instrukci `STRI2INT`. Pro index
+ *          mimo meze vloží na zásobník hodnotu 0.
+ *
+ * @param [in] funCallNode Ukazatel na uzel volání funkce
+ */
+void TAC_generateOrd(AST_FunCallNode *funCallNode);
+
 /**
  * @brief Převede speciální znaky na escape sekvence
  *
@@ -259,6 +404,14 @@ DString *TAC_convertSpecialSymbols(DString *origin);
  */
 void TAC_resetStatic();
 
+/**
+ * @brief Resetuje počítadla návěští
+ *
+ * @details Volá se na začátku každé funkce, návěští jsou proto jednoznačná
+ *          díky jménu funkce a jejich čísla nezávisí na ostatních funkcích.
+ */
+void TAC_resetLabels();
+
 /**
  * @brief Přidá instrukci do bufferu
  *
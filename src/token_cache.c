@@ -0,0 +1,332 @@
+/*******************************************************************************
+ *                                                                             *
+ * Název projektu:   Implementace překladače imperativního jazyka IFJ24        *
+ *                                                                             *
+ * Soubor:           token_cache.c                                             *
+ * Autor:            Farkašovský Lukáš  <xfarkal00>                            *
+ *                                                                             *
+ * Datum:            04.12.2024                                                *
+ * Poslední změna:   04.12.2024                                                *
+ *                                                                             *
+ * Tým:      Tým xkalinj00                                                     *
+ * Členové:  Farkašovský Lukáš    <xfarkal00>                                  *
+ *           Hýža Pavel           <xhyzapa00>                                  *
+ *           Kalina Jan           <xkalinj00>                                  *
+ *           Krejčí David         <xkrejcd00>                                  *
+ *                                                                             *
+ ******************************************************************************/
+/**
+ * @file token_cache.c
+ * @author Farkašovský Lukáš \<xfarkal00>
+ *
+ * @brief Implementace diskové cache proudu tokenů.
+ * @details Soubor cache je vázán na konkrétní stroj (čísla jsou uložena
+ *          v nativním pořadí bajtů). Poškozený nebo cizí soubor se ignoruje
+ *          a vstup se zpracuje scannerem.
+ */
+
+#include <string.h>
+#include "token_cache.h"
+#include "scanner_input.h"
+#include "parser_common.h"
+#include "scanner_pipeline.h"
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                       INICIALIZACE GLOBÁLNÍCH PROMĚNNÝCH                    *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Globální stav cache tokenů.
+ */
+TokenCache tokenCache = { TOKEN_CACHE_OFF, NULL, NULL, NULL, 0, 0, 0, 0, 0, 0, 0, "" };
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                        IMPLEMENTACE VEŘEJNÝCH FUNKCÍ                        *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Zapne cache tokenů pro načtený vstup scanneru.
+ */
+bool tokenCache_init(const char *directory) {
+    tokenCache_free();
+
+    // Bez adresáře nebo bez vstupu v paměti cache nepoužíváme
+    if(directory == NULL || *directory == '\0' || !scannerInput.buffered) {
+        return true;
+    }
+
+    tokenCache.inputHash = tokenCache_hash(scannerInput.data, scannerInput.length);
+    int written = snprintf(tokenCache.path, TOKEN_CACHE_PATH_SIZE, "%s/%016llx.tok",
+                           directory, (unsigned long long)tokenCache.inputHash);
+    if(written < 0 || written >= TOKEN_CACHE_PATH_SIZE) {
+        return true;
+    }
+
+    // Teplá cache: tokeny se budou číst ze souboru
+    if(tokenCache_load(scannerInput.length)) {
+        tokenCache.mode = TOKEN_CACHE_READ;
+        return true;
+    }
+
+    // Studená cache: tokeny od scanneru budeme zaznamenávat
+    tokenCache.types = malloc(TOKEN_CACHE_INITIAL_CAPACITY * sizeof(uint8_t));
+    tokenCache.lengths = malloc(TOKEN_CACHE_INITIAL_CAPACITY * sizeof(uint32_t));
+    tokenCache.data = malloc(TOKEN_CACHE_INITIAL_CAPACITY);
+    if(tokenCache.types == NULL || tokenCache.lengths == NULL || tokenCache.data == NULL) {
+        tokenCache_free();
+        return false;
+    }
+
+    tokenCache.capacity = TOKEN_CACHE_INITIAL_CAPACITY;
+    tokenCache.dataCapacity = TOKEN_CACHE_INITIAL_CAPACITY;
+    tokenCache.mode = TOKEN_CACHE_RECORD;
+
+    return true;
+}  // tokenCache_init()
+
+/**
+ * @brief Vrátí další token.
+ */
+Token tokenCache_getNextToken() {
+    if(tokenCache.mode == TOKEN_CACHE_READ) {
+        return tokenCache_readToken();
+    }
+
+    Token token = scannerPipeline_getNextToken();
+
+    if(tokenCache.mode == TOKEN_CACHE_RECORD) {
+        // Při chybě alokace záznam zahodíme, překlad tím ale neovlivníme
+        if(!tokenCache_record(token)) {
+            tokenCache_free();
+        }
+        // Po konci souboru uložíme cache, pokud analýza proběhla bez chyby
+        else if(token.type == TOKEN_EOF) {
+            if(!parser_errorWatcher(IS_PARSING_ERROR)) {
+                tokenCache_store();
+            }
+            tokenCache_free();
+        }
+    }
+
+    return token;
+}  // tokenCache_getNextToken()
+
+/**
+ * @brief Uvolní zdroje cache tokenů a cache vypne.
+ */
+void tokenCache_free() {
+    free(tokenCache.types);
+    free(tokenCache.lengths);
+    free(tokenCache.data);
+
+    tokenCache.mode = TOKEN_CACHE_OFF;
+    tokenCache.types = NULL;
+    tokenCache.lengths = NULL;
+    tokenCache.data = NULL;
+    tokenCache.count = 0;
+    tokenCache.capacity = 0;
+    tokenCache.dataSize = 0;
+    tokenCache.dataCapacity = 0;
+    tokenCache.next = 0;
+    tokenCache.dataOffset = 0;
+    tokenCache.inputHash = 0;
+    tokenCache.path[0] = '\0';
+}  // tokenCache_free()
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                        IMPLEMENTACE INTERNÍCH FUNKCÍ                        *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Spočítá 64bitový hash FNV-1a obsahu vstupu.
+ */
+uint64_t tokenCache_hash(const char *data, size_t length) {
+    uint64_t hash = UINT64_C(14695981039346656037);
+
+    for(size_t i = 0; i < length; i++) {
+        hash ^= (unsigned char)data[i];
+        hash *= UINT64_C(1099511628211);
+    }
+
+    return hash;
+}  // tokenCache_hash()
+
+/**
+ * @brief Načte soubor cache, pokud odpovídá vstupu.
+ */
+bool tokenCache_load(size_t inputLength) {
+    FILE *file = fopen(tokenCache.path, "rb");
+    if(file == NULL) {
+        return false;
+    }
+
+    // Hlavička musí odpovídat formátu i vstupu
+    TokenCacheHeader header;
+    if(fread(&header, sizeof(header), 1, file) != 1 ||
+       memcmp(header.magic, TOKEN_CACHE_MAGIC, TOKEN_CACHE_MAGIC_SIZE) != 0 ||
+       header.version != TOKEN_CACHE_VERSION || header.inputHash != tokenCache.inputHash ||
+       header.inputLength != inputLength || header.tokenCount == 0 ||
+       header.dataSize > SIZE_MAX - 1)
+    {
+        fclose(file);
+        return false;
+    }
+
+    size_t count = header.tokenCount;
+    size_t dataSize = (size_t)header.dataSize;
+    tokenCache.types = malloc(count * sizeof(uint8_t));
+    tokenCache.lengths = malloc(count * sizeof(uint32_t));
+    tokenCache.data = malloc(dataSize + 1);
+
+    bool loaded = tokenCache.types != NULL && tokenCache.lengths != NULL &&
+                  tokenCache.data != NULL &&
+                  fread(tokenCache.types, sizeof(uint8_t), count, file) == count &&
+                  fread(tokenCache.lengths, sizeof(uint32_t), count, file) == count &&
+                  fread(tokenCache.data, 1, dataSize, file) == dataSize;
+    fclose(file);
+
+    // Délky hodnot musí odpovídat celkové délce dat a proud končit tokenem EOF
+    size_t total = 0;
+    for(size_t i = 0; loaded && i < count; i++) {
+        if(tokenCache.lengths[i] != TOKEN_CACHE_NO_VALUE) {
+            total += tokenCache.lengths[i];
+        }
+    }
+    if(!loaded || total != dataSize || tokenCache.types[count - 1] != TOKEN_EOF) {
+        tokenCache_free();
+        return false;
+    }
+
+    tokenCache.count = count;
+    tokenCache.capacity = count;
+    tokenCache.dataSize = dataSize;
+    tokenCache.dataCapacity = dataSize + 1;
+
+    return true;
+}  // tokenCache_load()
+
+/**
+ * @brief Uloží zaznamenané tokeny do souboru cache.
+ */
+void tokenCache_store() {
+    char temporaryPath[TOKEN_CACHE_PATH_SIZE + 8];
+    snprintf(temporaryPath, sizeof(temporaryPath), "%s.tmp", tokenCache.path);
+
+    FILE *file = fopen(temporaryPath, "wb");
+    if(file == NULL) {
+        return;
+    }
+
+    TokenCacheHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, TOKEN_CACHE_MAGIC, TOKEN_CACHE_MAGIC_SIZE);
+    header.version = TOKEN_CACHE_VERSION;
+    header.tokenCount = (uint32_t)tokenCache.count;
+    header.inputHash = tokenCache.inputHash;
+    header.inputLength = scannerInput.length;
+    header.dataSize = tokenCache.dataSize;
+
+    bool written = fwrite(&header, sizeof(header), 1, file) == 1 &&
+                   fwrite(tokenCache.types, sizeof(uint8_t), tokenCache.count, file) == tokenCache.count &&
+                   fwrite(tokenCache.lengths, sizeof(uint32_t), tokenCache.count, file) == tokenCache.count &&
+                   fwrite(tokenCache.data, 1, tokenCache.dataSize, file) == tokenCache.dataSize;
+
+    if(fclose(file) != 0 || !written || rename(temporaryPath, tokenCache.path) != 0) {
+        remove(temporaryPath);
+    }
+}  // tokenCache_store()
+
+/**
+ * @brief Zaznamená token vrácený scannerem.
+ */
+bool tokenCache_record(Token token) {
+    // Počet tokenů musí být uložitelný do hlavičky
+    if(tokenCache.count == UINT32_MAX) {
+        return false;
+    }
+
+    // Zvětšíme pole typů a délek
+    if(tokenCache.count == tokenCache.capacity) {
+        size_t capacity = tokenCache.capacity * 2;
+        uint8_t *types = realloc(tokenCache.types, capacity * sizeof(uint8_t));
+        if(types == NULL) {
+            return false;
+        }
+        tokenCache.types = types;
+
+        uint32_t *lengths = realloc(tokenCache.lengths, capacity * sizeof(uint32_t));
+        if(lengths == NULL) {
+            return false;
+        }
+        tokenCache.lengths = lengths;
+        tokenCache.capacity = capacity;
+    }
+
+    uint32_t length = TOKEN_CACHE_NO_VALUE;
+    if(token.value != NULL) {
+        if(token.value->length >= TOKEN_CACHE_NO_VALUE) {
+            return false;
+        }
+        length = (uint32_t)token.value->length;
+
+        // Zvětšíme pole hodnot
+        while(tokenCache.dataSize + length > tokenCache.dataCapacity) {
+            size_t dataCapacity = tokenCache.dataCapacity * 2;
+            char *data = realloc(tokenCache.data, dataCapacity);
+            if(data == NULL) {
+                return false;
+            }
+            tokenCache.data = data;
+            tokenCache.dataCapacity = dataCapacity;
+        }
+
+        memcpy(tokenCache.data + tokenCache.dataSize, token.value->str, length);
+        tokenCache.dataSize += length;
+    }
+
+    tokenCache.types[tokenCache.count] = (uint8_t)token.type;
+    tokenCache.lengths[tokenCache.count] = length;
+    tokenCache.count++;
+
+    return true;
+}  // tokenCache_record()
+
+/**
+ * @brief Vrátí další token ze souboru cache.
+ */
+Token tokenCache_readToken() {
+    // Za koncem proudu vracíme opakovaně EOF, stejně jako scanner
+    if(tokenCache.next >= tokenCache.count) {
+        return scanner_stringlessTokenCreate(TOKEN_EOF);
+    }
+
+    size_t index = tokenCache.next++;
+    TokenType type = (TokenType)tokenCache.types[index];
+    uint32_t length = tokenCache.lengths[index];
+
+    if(length == TOKEN_CACHE_NO_VALUE) {
+        return scanner_stringlessTokenCreate(type);
+    }
+
+    // Parser přebírá vlastnictví hodnoty, vytvoříme proto nový řetězec
+    DString *value = DString_init();
+    if(value == NULL ||
+       DString_appendChars(value, tokenCache.data + tokenCache.dataOffset, length) != STRING_SUCCESS)
+    {
+        parser_errorWatcher(SET_ERROR_INTERNAL);
+    }
+    tokenCache.dataOffset += length;
+
+    return scanner_tokenCreate(type, value);
+}  // tokenCache_readToken()
+
+/*** Konec souboru token_cache.c ***/
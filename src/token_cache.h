@@ -0,0 +1,220 @@
+/*******************************************************************************
+ *                                                                             *
+ * Název projektu:   Implementace překladače imperativního jazyka IFJ24        *
+ *                                                                             *
+ * Soubor:           token_cache.h                                             *
+ * Autor:            Farkašovský Lukáš  <xfarkal00>                            *
+ *                                                                             *
+ * Datum:            04.12.2024                                                *
+ * Poslední změna:   04.12.2024                                                *
+ *                                                                             *
+ * Tým:      Tým xkalinj00                                                     *
+ * Členové:  Farkašovský Lukáš    <xfarkal00>                                  *
+ *           Hýža Pavel           <xhyzapa00>                                  *
+ *           Kalina Jan           <xkalinj00>                                  *
+ *           Krejčí David         <xkrejcd00>                                  *
+ *                                                                             *
+ ******************************************************************************/
+/**
+ * @file token_cache.h
+ * @author Farkašovský Lukáš \<xfarkal00>
+ *
+ * @brief Hlavičkový soubor pro diskovou cache proudu tokenů.
+ * @details Pokud je nastavena proměnná prostředí @c TOKEN_CACHE_ENV s cestou
+ *          k adresáři, překladač uloží proud tokenů přeloženého vstupu do
+ *          souboru pojmenovaného podle hashe obsahu vstupu. Při dalším překladu
+ *          stejného vstupu parser čte tokeny přímo z cache a lexikální analýza
+ *          se vůbec neprovádí.
+ *
+ *          Soubor cache má tvar:
+ *          - hlavička @c TokenCacheHeader,
+ *          - typy tokenů (jeden bajt na token),
+ *          - délky hodnot tokenů (`uint32_t` na token, @c TOKEN_CACHE_NO_VALUE
+ *            pro token bez hodnoty),
+ *          - hodnoty tokenů uložené za sebou.
+ *
+ *          Cache se ukládá jen pro vstup, který prošel lexikální analýzou až
+ *          do konce souboru bez chyby.
+ */
+
+#ifndef TOKEN_CACHE_H_
+/** @cond  */
+#define TOKEN_CACHE_H_
+/** @endcond  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "scanner.h"
+#include "dynamic_string.h"
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                             DEKLARACE KONSTANT                              *
+ *                                                                             *
+ ******************************************************************************/
+
+#define TOKEN_CACHE_ENV "IFJ24_TOKEN_CACHE"     /**< Proměnná prostředí s adresářem cache    */
+#define TOKEN_CACHE_MAGIC "IFJ24TOK"            /**< Identifikace souboru cache              */
+#define TOKEN_CACHE_MAGIC_SIZE 8                /**< Délka identifikace souboru cache        */
+#define TOKEN_CACHE_VERSION 1                   /**< Verze formátu souboru cache             */
+#define TOKEN_CACHE_NO_VALUE UINT32_MAX         /**< Délka hodnoty tokenu bez hodnoty        */
+#define TOKEN_CACHE_PATH_SIZE 4096              /**< Velikost bufferu pro cestu k souboru    */
+#define TOKEN_CACHE_INITIAL_CAPACITY 256        /**< Počáteční kapacita záznamu tokenů       */
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                             VÝČTOVÉ DATOVÉ TYPY                             *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Režim cache tokenů.
+ */
+typedef enum TokenCacheMode {
+    TOKEN_CACHE_OFF = 0,        /**< Cache není použita, tokeny vrací scanner         */
+    TOKEN_CACHE_READ,           /**< Tokeny se čtou z načteného souboru cache         */
+    TOKEN_CACHE_RECORD          /**< Tokeny vrací scanner a zároveň se zaznamenávají  */
+} TokenCacheMode;
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                             DEKLARACE STRUKTUR                              *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Hlavička souboru cache.
+ */
+typedef struct TokenCacheHeader {
+    char magic[TOKEN_CACHE_MAGIC_SIZE]; /**< Identifikace souboru @c TOKEN_CACHE_MAGIC     */
+    uint32_t version;                   /**< Verze formátu @c TOKEN_CACHE_VERSION          */
+    uint32_t tokenCount;                /**< Počet uložených tokenů                        */
+    uint64_t inputHash;                 /**< Hash obsahu vstupu                            */
+    uint64_t inputLength;               /**< Délka vstupu v bajtech                        */
+    uint64_t dataSize;                  /**< Celková délka hodnot tokenů v bajtech         */
+} TokenCacheHeader;
+
+/**
+ * @brief Stav cache tokenů.
+ */
+typedef struct TokenCache {
+    TokenCacheMode mode;        /**< Režim cache                                       */
+    uint8_t *types;             /**< Typy tokenů                                       */
+    uint32_t *lengths;          /**< Délky hodnot tokenů                               */
+    char *data;                 /**< Hodnoty tokenů uložené za sebou                   */
+    size_t count;               /**< Počet tokenů                                      */
+    size_t capacity;            /**< Kapacita polí typů a délek                        */
+    size_t dataSize;            /**< Délka hodnot tokenů                               */
+    size_t dataCapacity;        /**< Kapacita pole hodnot                              */
+    size_t next;                /**< Index dalšího vraceného tokenu                    */
+    size_t dataOffset;          /**< Pozice hodnoty dalšího vraceného tokenu           */
+    uint64_t inputHash;         /**< Hash obsahu vstupu                                */
+    char path[TOKEN_CACHE_PATH_SIZE];   /**< Cesta k souboru cache                     */
+} TokenCache;
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                       DEKLARACE GLOBÁLNÍCH PROMĚNNÝCH                       *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Globální stav cache tokenů.
+ */
+extern TokenCache tokenCache;
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                         DEKLARACE VEŘEJNÝCH FUNKCÍ                          *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Zapne cache tokenů pro načtený vstup scanneru.
+ *
+ * @details Pokud v adresáři existuje platný soubor cache pro obsah vstupu,
+ *          načte jej a přepne se do režimu @c TOKEN_CACHE_READ. Jinak se
+ *          přepne do režimu @c TOKEN_CACHE_RECORD. Pokud je @p directory
+ *          `NULL` nebo vstup není načten v paměti, cache zůstane vypnutá.
+ *
+ * @param [in] directory Cesta k adresáři cache, nebo `NULL`
+ *
+ * @return `false` při chybě alokace paměti, jinak `true`.
+ */
+bool tokenCache_init(const char *directory);
+
+/**
+ * @brief Vrátí další token.
+ *
+ * @details Podle režimu cache vrátí token ze souboru cache, nebo jej získá
+ *          od scanneru (a případně zaznamená).
+ *
+ * @return Další token vstupu.
+ */
+Token tokenCache_getNextToken();
+
+/**
+ * @brief Uvolní zdroje cache tokenů a cache vypne.
+ */
+void tokenCache_free();
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                         DEKLARACE INTERNÍCH FUNKCÍ                          *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Spočítá 64bitový hash FNV-1a obsahu vstupu.
+ *
+ * @param [in] data Ukazatel na vstup
+ * @param [in] length Délka vstupu
+ *
+ * @return Hash vstupu.
+ */
+uint64_t tokenCache_hash(const char *data, size_t length);
+
+/**
+ * @brief Načte soubor cache, pokud odpovídá vstupu.
+ *
+ * @param [in] inputLength Délka vstupu
+ *
+ * @return `true`, pokud byl soubor načten, jinak `false`.
+ */
+bool tokenCache_load(size_t inputLength);
+
+/**
+ * @brief Uloží zaznamenané tokeny do souboru cache.
+ *
+ * @details Soubor se nejprve zapíše pod dočasným názvem a poté přejmenuje,
+ *          aby souběžně spuštěný překladač nenačetl neúplný soubor.
+ */
+void tokenCache_store();
+
+/**
+ * @brief Zaznamená token vrácený scannerem.
+ *
+ * @param [in] token Zaznamenávaný token
+ *
+ * @return `false` při chybě alokace paměti, jinak `true`.
+ */
+bool tokenCache_record(Token token);
+
+/**
+ * @brief Vrátí další token ze souboru cache.
+ *
+ * @return Další token, s novým dynamickým řetězcem jako hodnotou.
+ */
+Token tokenCache_readToken();
+
+#endif // TOKEN_CACHE_H_
+
+/*** Konec souboru token_cache.h ***/
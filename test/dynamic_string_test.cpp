@@ -134,6 +134,33 @@ TEST(StringAppendChar, ManyChars) {
     DString_free(str);
 }
 
+/**
+ * @brief Testuje funkci `DString_appendChars` pro přidání úseku znaků
+ */
+TEST(StringAppendChars, Chunks) {
+    DString *str = DString_init();
+    ASSERT_NE(str, nullptr);
+    const char *first = "ab";
+    const char *second = "cdefghijklmnopqrstuvwxyz0123456789";
+
+    ASSERT_EQ(DString_appendChars(str, first, strlen(first)), STRING_SUCCESS);
+    ASSERT_EQ(DString_appendChars(str, second, 0), STRING_SUCCESS);
+    ASSERT_EQ(DString_appendChars(str, second, strlen(second)), STRING_SUCCESS);
+    ASSERT_EQ(DString_appendChar(str, '!'), STRING_SUCCESS);
+
+    ASSERT_EQ(str->length, strlen(first) + strlen(second) + 1);
+    ASSERT_STREQ(str->str, "abcdefghijklmnopqrstuvwxyz0123456789!");
+
+    DString_free(str);
+}
+
+/**
+ * @brief Testuje funkci `DString_appendChars` pro přidání do NULL
+ */
+TEST(StringAppendChars, NullString) {
+    ASSERT_EQ(DString_appendChars(nullptr, "a", 1), STRING_RESIZE_FAIL);
+}
+
 /**
  * @brief Testuje funkci `DString_copy` pro kopírování řetězce
  */
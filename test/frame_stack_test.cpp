@@ -49,6 +49,47 @@ TEST(FrameStack, Init) {
     frameStack_destroyAll();
 }
 
+/**
+ * @brief Testuje funkci `frameStack_findBuiltIn` pro vyhledání signatury
+ *        vestavěné funkce ve statické tabulce
+ */
+TEST(FrameStack, FindBuiltIn) {
+    frameStack_init();
+
+    // Globální rámec po inicializaci neobsahuje žádné vestavěné funkce
+    ASSERT_EQ(frameStack.bottom->frame->usedSize, 0ULL);
+
+    DString *substring = DString_constCharToDString("substring");
+    DString *readi32 = DString_constCharToDString("readi32");
+    DString *unknown = DString_constCharToDString("foo");
+
+    // Funkce se třemi parametry
+    const BuiltInSignature *builtIn = frameStack_findBuiltIn(substring);
+    ASSERT_NE(builtIn, nullptr);
+    EXPECT_EQ(builtIn->returnType, SYMTABLE_TYPE_STRING_OR_NULL);
+    ASSERT_EQ(builtIn->paramCount, 3ULL);
+    EXPECT_STREQ(builtIn->params[0].id, "s");
+    EXPECT_EQ(builtIn->params[0].type, SYMTABLE_TYPE_STRING);
+    EXPECT_STREQ(builtIn->params[2].id, "j");
+    EXPECT_EQ(builtIn->params[2].type, SYMTABLE_TYPE_INT);
+
+    // Funkce bez parametrů
+    builtIn = frameStack_findBuiltIn(readi32);
+    ASSERT_NE(builtIn, nullptr);
+    EXPECT_EQ(builtIn->returnType, SYMTABLE_TYPE_INT_OR_NULL);
+    EXPECT_EQ(builtIn->paramCount, 0ULL);
+
+    // Neexistující vestavěná funkce
+    EXPECT_EQ(frameStack_findBuiltIn(unknown), nullptr);
+    EXPECT_EQ(frameStack_findBuiltIn(nullptr), nullptr);
+
+    // Uvolníme zásobník
+    frameStack_destroyAll();
+    DString_free(substring);
+    DString_free(readi32);
+    DString_free(unknown);
+}
+
 /**
  * @brief Testuje funkci `frameStack_push` pro přidání nového rámce na zásobník
  */
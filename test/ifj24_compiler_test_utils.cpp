@@ -53,6 +53,9 @@ vector<bool> levels;
 string ASTutils_printCapturedOutput(AST_NodeType type, void *node, bool useColors) {
     stringstream buffer;
 
+    // Každý výpis začíná na nejvyšší úrovni stromu
+    levels.clear();
+
     if (node == nullptr) {
         buffer << "Null node passed" << endl;
         return buffer.str();
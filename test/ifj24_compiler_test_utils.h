@@ -40,7 +40,15 @@
 
 extern "C" {
 #include "error.h"
+#include "settings.h"
 #include "scanner.h"
+#include "scanner_dfa.h"
+#include "scanner_input.h"
+#include "number_literal.h"
+#include "token_cache.h"
+#include "scanner_pipeline.h"
+#include "ast_serializer.h"
+#include "incremental.h"
 #include "ast_nodes.h"
 #include "ast_interface.h"
 #include "parser_common.h"
@@ -49,10 +57,13 @@ extern "C" {
 #include "precedence_parser.h"
 #include "precedence_table.h"
 #include "precedence_stack.h"
+#include "pratt_parser.h"
 #include "symtable.h"
 #include "frame_stack.h"
 #include "semantic_analyser.h"
+#include "ast_inliner.h"
 #include "tac_generator.h"
+#include "output_writer.h"
 #include "built_in_functions.h"
 }
 
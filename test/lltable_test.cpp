@@ -488,4 +488,40 @@ TEST(LLTable, FindRule_ARGUMENTS) {
     EXPECT_EQ(rule, SYNTAX_ERROR);
 }
 
+/**
+ * @brief Testovací případ pro tabulku klasifikace tokenů `parser_tokenKinds`.
+ */
+TEST(LLTable, TokenKinds) {
+    // Token s LL i precedenčním terminálem
+    EXPECT_EQ(parser_tokenKinds[TOKEN_IDENTIFIER].LLterminal, T_ID);
+    EXPECT_EQ(parser_tokenKinds[TOKEN_IDENTIFIER].PrecTerminal, T_PREC_ID);
+    EXPECT_EQ(parser_tokenKinds[TOKEN_K_ifj].LLterminal, T_IFJ);
+    EXPECT_EQ(parser_tokenKinds[TOKEN_K_ifj].PrecTerminal, T_PREC_IFJ);
+
+    // Token pouze pro precedenční parser
+    EXPECT_EQ(parser_tokenKinds[TOKEN_FLOAT].LLterminal, T_UNDEFINED);
+    EXPECT_EQ(parser_tokenKinds[TOKEN_FLOAT].PrecTerminal, T_PREC_FLOAT_LITERAL);
+    EXPECT_EQ(parser_tokenKinds[TOKEN_K_null].LLterminal, T_UNDEFINED);
+    EXPECT_EQ(parser_tokenKinds[TOKEN_K_null].PrecTerminal, T_PREC_NULL_LITERAL);
+
+    // Token pouze pro LL parser a středník jako konec výrazu
+    EXPECT_EQ(parser_tokenKinds[TOKEN_K_while].LLterminal, T_WHILE);
+    EXPECT_EQ(parser_tokenKinds[TOKEN_K_while].PrecTerminal, T_PREC_UNDEFINED);
+    EXPECT_EQ(parser_tokenKinds[TOKEN_SEMICOLON].LLterminal, T_SEMICOLON);
+    EXPECT_EQ(parser_tokenKinds[TOKEN_SEMICOLON].PrecTerminal, T_PREC_DOLLAR);
+
+    // Token bez terminálu
+    EXPECT_EQ(parser_tokenKinds[TOKEN_COMMENT].LLterminal, T_UNDEFINED);
+    EXPECT_EQ(parser_tokenKinds[TOKEN_COMMENT].PrecTerminal, T_PREC_UNDEFINED);
+
+    // Příznaky
+    EXPECT_TRUE(parser_tokenKinds[TOKEN_LEFT_PARENTHESIS].flags & TOKEN_FLAG_STARTS_EXPRESSION);
+    EXPECT_FALSE(parser_tokenKinds[TOKEN_RIGHT_PARENTHESIS].flags & TOKEN_FLAG_STARTS_EXPRESSION);
+    EXPECT_TRUE(parser_tokenKinds[TOKEN_LESS_EQUAL_THAN].flags & TOKEN_FLAG_BINARY_OPERATOR);
+    EXPECT_FALSE(parser_tokenKinds[TOKEN_EQUALITY_SIGN].flags & TOKEN_FLAG_BINARY_OPERATOR);
+    EXPECT_EQ(parser_tokenKinds[TOKEN_K_null].flags,
+              unsigned(TOKEN_FLAG_KEYWORD | TOKEN_FLAG_STARTS_EXPRESSION));
+    EXPECT_EQ(parser_tokenKinds[TOKEN_K_const].flags, unsigned(TOKEN_FLAG_KEYWORD));
+}
+
 /*** Konec souboru lltable_test.cpp ***/
\ No newline at end of file
@@ -0,0 +1,167 @@
+/*******************************************************************************
+ *                                                                             *
+ * Název projektu:   Implementace překladače imperativního jazyka IFJ24        *
+ *                                                                             *
+ * Soubor:           parser_stress_test.cpp                                    *
+ * Autor:            Jan Kalina   <xkalinj00>                                  *
+ *                                                                             *
+ * Datum:            04.12.2024                                                *
+ * Poslední změna:   04.12.2024                                                *
+ *                                                                             *
+ * Tým:      Tým xkalinj00                                                     *
+ * Členové:  Farkašovský Lukáš    <xfarkal00>                                  *
+ *           Hýža Pavel           <xhyzapa00>                                  *
+ *           Kalina Jan           <xkalinj00>                                  *
+ *           Krejčí David         <xkrejcd00>                                  *
+ *                                                                             *
+ ******************************************************************************/
+/**
+ * @file parser_stress_test.cpp
+ * @author Jan Kalina \<xkalinj00>
+ *
+ * @brief Zátěžové testy syntaktického analyzátoru (parseru).
+ * @details Testy analyzují velmi dlouhé a hluboce zanořené programy. Mají
+ *          vlastní testovací program, protože velká halda, kterou po sobě
+ *          zanechají, výrazně zpomaluje testy, které spouští proces překladače
+ *          znovu (např. @c EXPECT_EXIT). Testy jsou vytvořené za využití
+ *          frameworku Google Test.
+ */
+
+/*******************************************************************************
+ *                                                                             *
+ *             AKTIVACE MAKER PRO VIZUALIZACI STRUKTUR PŘEKLADAČE              *
+ *                                                                             *
+ ******************************************************************************/
+
+// Kompletně vypneme výpis
+#define DISABLE_PRINT
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                         IMPORT HLAVIČKOVÝCH SOUBORŮ                         *
+ *                                                                             *
+ ******************************************************************************/
+
+// Import knihoven GoogleTest frameworku
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+// Import sdílených knihoven překladače (test-utils)
+#include "ifj24_compiler_test_utils.h"
+
+
+/*******************************************************************************
+ *                                                                             *
+ *                  ZÁTĚŽOVÉ TESTY ZÁSOBNÍKU BLOKŮ LL PARSERU                  *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Provede syntaktickou analýzu programu předaného jako řetězec.
+ */
+static void parseProgramFromString(const string &program) {
+    FILE* f = tmpfile();
+    ASSERT_NE(f, nullptr);
+    ASSERT_EQ(fwrite(program.data(), 1, program.size(), f), program.size());
+    rewind(f);
+
+    FILE* stdin_backup = stdin;
+    stdin = f;
+    LLparser_parseProgram();
+    stdin = stdin_backup;
+    fclose(f);
+}
+
+/**
+ * @brief Vytvoří program se střídavě zanořenými příkazy "if" a "while".
+ */
+static string generateNestedProgram(size_t depth) {
+    string program = "const ifj = @import(\"ifj24.zig\");\n"
+                     "pub fn main() void {\n    var a: i32 = 0;\n";
+    for (size_t i = 0; i < depth; i++) {
+        program += (i % 2 == 0) ? "if (1 < 2) {\n" : "while (1 < 2) {\n";
+    }
+    program += "a = 1;\n";
+    for (size_t i = depth; i > 0; i--) {
+        program += ((i - 1) % 2 == 0) ? "} else { _ = 2; }\n" : "}\n";
+    }
+    program += "}\n";
+
+    return program;
+}
+
+// Chyba hluboko v zanoření uvolní všechny otevřené bloky
+TEST(LLParserStress, DeepNestingError) {
+    string program = "const ifj = @import(\"ifj24.zig\");\n"
+                     "pub fn main() void {\n    var a: i32 = 0;\n";
+    for (size_t i = 0; i < 1000; i++) {
+        program += "while (a < 1) { a = 1;\n";
+    }
+    program += "}\n";
+
+    EXPECT_EXIT(parseProgramFromString(program), ExitedWithCode(2), "");
+}
+
+// Zanoření nad limit skončí interní chybou místo přetečení zásobníku volání
+TEST(LLParserStress, NestingLimitExceeded) {
+    EXPECT_EXIT(parseProgramFromString(generateNestedProgram(LLPARSER_MAX_NESTING_DEPTH + 1)),
+                ExitedWithCode(99), "");
+    EXPECT_EXIT(parseProgramFromString(generateNestedProgram(10000)),
+                ExitedWithCode(99), "");
+}
+
+// Zanoření až do limitu parser zpracuje bez rekurze
+TEST(LLParserStress, DeepNesting) {
+    const size_t depth = LLPARSER_MAX_NESTING_DEPTH;
+    parseProgramFromString(generateNestedProgram(depth));
+    ASSERT_NE(ASTroot, nullptr);
+    ASSERT_NE(ASTroot->functionList, nullptr);
+
+    // Sestoupíme větvemi "then" a těly cyklů až k nejhlubšímu příkazu
+    AST_StatementNode *st = ASTroot->functionList->body->next;
+    size_t nesting = 0;
+    while (st != nullptr && (st->statementType == AST_STATEMENT_IF ||
+                             st->statementType == AST_STATEMENT_WHILE)) {
+        if (st->statementType == AST_STATEMENT_IF) {
+            ASSERT_NE(((AST_IfNode *)st->statement)->elseBranch, nullptr);
+            st = ((AST_IfNode *)st->statement)->thenBranch;
+        }
+        else {
+            st = ((AST_WhileNode *)st->statement)->body;
+        }
+        nesting++;
+    }
+    EXPECT_EQ(nesting, depth);
+    ASSERT_NE(st, nullptr);
+    EXPECT_EQ(st->statementType, AST_STATEMENT_EXPR);
+
+    IFJ24Compiler_freeAllAllocatedMemory();
+}
+
+// Dlouhý seznam příkazů nesmí zvětšovat zásobník volání
+TEST(LLParserStress, MillionStatements) {
+    const size_t count = 1000000;
+    string program = "const ifj = @import(\"ifj24.zig\");\n"
+                     "pub fn main() void {\n    var a: i32 = 0;\n";
+    program.reserve(program.size() + count * 11 + 4);
+    for (size_t i = 0; i < count; i++) {
+        program += "    a = 1;\n";
+    }
+    program += "}\n";
+
+    parseProgramFromString(program);
+    ASSERT_NE(ASTroot, nullptr);
+    ASSERT_NE(ASTroot->functionList, nullptr);
+
+    // Tělo obsahuje definici proměnné a všechna přiřazení
+    size_t statements = 0;
+    for (AST_StatementNode *st = ASTroot->functionList->body; st != nullptr; st = st->next) {
+        statements++;
+    }
+    EXPECT_EQ(statements, count + 1);
+
+    IFJ24Compiler_freeAllAllocatedMemory();
+}
+
+/*** Konec souboru parser_stress_test.cpp ***/
@@ -50,6 +50,10 @@
  *                                                                             *
  ******************************************************************************/
 
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+
 // Import knihoven GoogleTest frameworku
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
@@ -2453,6 +2457,145 @@ TEST(LLParserError, Statements) {
 }
 
 
+/*******************************************************************************
+ *                                                                             *
+ *                    ANALÝZA VÝRAZŮ METODOU PRATT (DIFERENČNĚ)                *
+ *                                                                             *
+ ******************************************************************************/
+
+/**
+ * @brief Provede syntaktickou analýzu souboru zvoleným analyzátorem výrazů.
+ *
+ * @return Výpis vzniklého AST.
+ */
+static string parseWithExprEngine(const string &path, bool pratt) {
+    FILE* f = fopen(path.c_str(), "r");
+    if (f == nullptr) {
+        return "Can't open file: " + path;
+    }
+    FILE* stdin_backup = stdin;
+    stdin = f;
+
+    prattParser_init(pratt ? "1" : nullptr);
+    LLparser_parseProgram();
+    string output = ASTutils_printCapturedOutput(AST_PROGRAM_NODE, ASTroot);
+    prattParser_init(nullptr);
+
+    IFJ24Compiler_freeAllAllocatedMemory();
+    stdin = stdin_backup;
+    fclose(f);
+
+    return output;
+}
+
+/**
+ * @brief Vrátí seřazené cesty k souborům `*.zig` v zadaném adresáři.
+ */
+static vector<string> listZigFiles(const string &dir) {
+    vector<string> paths;
+    for (const auto &entry : filesystem::directory_iterator(dir)) {
+        if (entry.is_regular_file() && entry.path().extension() == ".zig") {
+            paths.push_back(entry.path().string());
+        }
+    }
+    sort(paths.begin(), paths.end());
+    return paths;
+}
+
+// Oba analyzátory výrazů musí pro všechny syntakticky správné příklady vytvořit shodný AST
+TEST(PrattParser, SameASTAsPrecedenceParser) {
+    vector<string> paths = listZigFiles(syntPath);
+    ASSERT_FALSE(paths.empty());
+
+    for (const string &path : paths) {
+        // Soubory "boundries_XX.zig" končí už při analýze chybou přetečení literálu
+        if (path.find("error_") != string::npos || path.find("boundries_") != string::npos) {
+            continue;
+        }
+
+        string precedence = parseWithExprEngine(path, false);
+        string pratt = parseWithExprEngine(path, true);
+        EXPECT_NE(precedence, "Null node passed\n") << path;
+        EXPECT_EQ(precedence, pratt) << path;
+    }
+}
+
+// Syntaktické chyby musí analyzátor metodou Pratt hlásit stejně jako precedenční
+TEST(PrattParser, SyntaxErrors) {
+    vector<string> paths = listZigFiles(syntErrorPath);
+    ASSERT_FALSE(paths.empty());
+
+    prattParser_init("1");
+    for (const string &path : paths) {
+        FILE* f = fopen(path.c_str(), "r");
+        ASSERT_NE(f, nullptr) << "Can't open file: " << path;
+        FILE* stdin_backup = stdin;
+        stdin = f;
+
+        EXPECT_EXIT(LLparser_parseProgram(), ExitedWithCode(2), "") << path;
+
+        IFJ24Compiler_freeAllAllocatedMemory();
+        stdin = stdin_backup;
+        fclose(f);
+    }
+
+    // Přetečení celočíselného literálu se hlásí při vytváření uzlu operandu
+    for (const string &path : listZigFiles(syntPath)) {
+        if (path.find("boundries_") == string::npos) {
+            continue;
+        }
+        FILE* f = fopen(path.c_str(), "r");
+        ASSERT_NE(f, nullptr) << "Can't open file: " << path;
+        FILE* stdin_backup = stdin;
+        stdin = f;
+
+        EXPECT_EXIT(LLparser_parseProgram(), ExitedWithCode(10), "") << path;
+
+        IFJ24Compiler_freeAllAllocatedMemory();
+        stdin = stdin_backup;
+        fclose(f);
+    }
+    prattParser_init(nullptr);
+}
+
+// Porovnání rychlosti obou analyzátorů výrazů na nejsložitějších výrazech
+TEST(PrattParser, HellishBenchmark) {
+    const int repeat = 200;
+    vector<string> paths;
+    for (const string &path : listZigFiles(syntPath)) {
+        if (path.find("_hellish_") != string::npos) {
+            paths.push_back(path);
+        }
+    }
+    ASSERT_EQ(paths.size(), 4u);
+
+    for (bool pratt : {false, true}) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < repeat; i++) {
+            for (const string &path : paths) {
+                FILE* f = fopen(path.c_str(), "r");
+                ASSERT_NE(f, nullptr);
+                FILE* stdin_backup = stdin;
+                stdin = f;
+
+                prattParser_init(pratt ? "1" : nullptr);
+                LLparser_parseProgram();
+                EXPECT_NE(ASTroot, nullptr);
+
+                IFJ24Compiler_freeAllAllocatedMemory();
+                stdin = stdin_backup;
+                fclose(f);
+            }
+        }
+        auto end = std::chrono::steady_clock::now();
+        prattParser_init(nullptr);
+
+        std::chrono::duration<double, std::milli> elapsed = end - start;
+        cerr << "[ BENCH    ] " << (pratt ? "Pratt:       " : "precedenční: ")
+             << repeat * paths.size() << " souborů za " << elapsed.count() << " ms" << endl;
+    }
+}
+
 /*******************************************************************************
  *                                                                             *
  *               TESTOVACÍ SOUBORY "correct_if_condition_XX.zig"               *
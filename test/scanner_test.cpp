@@ -27,6 +27,11 @@
 #include <stdio.h>
 #include <cstdio>
 #include <cstring>
+#include <chrono>
+#include <thread>
+#include <string>
+#include <vector>
+#include <filesystem>
 
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
@@ -2161,4 +2166,664 @@ TEST(Lex, Double_simple) {
 }
 
 
-/*** Konec souboru scanner_test.cpp ***/
\ No newline at end of file
+/**
+ * @brief Rozlišení klíčových slov a identifikátorů, které se od klíčového
+ *        slova liší délkou nebo jediným znakem.
+ */
+TEST(Get, KeywordsAndNearMisses) {
+    const char *words[] = {
+        "const", "var", "i32", "f64", "pub", "fn", "void", "return", "null",
+        "if", "else", "while", "_", "ifj",
+        "consta", "va", "i64", "f32", "pubx", "f", "voi", "returns", "nul",
+        "iff", "elsa", "whilf", "__", "ifk", "i", "e", "whil", "retur"
+    };
+    const TokenType expected[] = {
+        TOKEN_K_const, TOKEN_K_var, TOKEN_K_i32, TOKEN_K_f64, TOKEN_K_pub,
+        TOKEN_K_fn, TOKEN_K_void, TOKEN_K_return, TOKEN_K_null, TOKEN_K_if,
+        TOKEN_K_else, TOKEN_K_while, TOKEN_K_underscore, TOKEN_K_ifj
+    };
+    const size_t keywordCount = sizeof(expected) / sizeof(expected[0]);
+
+    for(size_t i = 0; i < sizeof(words) / sizeof(words[0]); i++) {
+        DString *str = DString_constCharToDString(words[i]);
+        Token token = scanner_isKeyword(str);
+
+        if(i < keywordCount) {
+            EXPECT_EQ(token.type, expected[i]) << words[i];
+            EXPECT_EQ(token.value, nullptr);
+            DString_free(str);
+        }
+        else {
+            EXPECT_EQ(token.type, TOKEN_IDENTIFIER) << words[i];
+            ASSERT_NE(token.value, nullptr);
+            EXPECT_STREQ(token.value->str, words[i]);
+            DString_free(token.value);
+        }
+    }
+}
+
+/**
+ * @brief Benchmark scanneru na vstupu tvořeném převážně identifikátory.
+ */
+TEST(Lex, IdentifierDenseBenchmark) {
+    const char *words[] = {
+        "value", "counter", "const", "ifj", "index", "var", "result",
+        "i32", "while", "length", "return", "_", "fn", "tmp_1", "nullable"
+    };
+    const size_t wordCount = sizeof(words) / sizeof(words[0]);
+    const size_t repeat = 20000;
+
+    std::string input;
+    for(size_t i = 0; i < repeat; i++) {
+        for(size_t j = 0; j < wordCount; j++) {
+            input += words[j];
+            input += ' ';
+        }
+    }
+
+    FILE* f = fmemopen((void*)input.c_str(), input.size(), "r");
+    ASSERT_NE(f, nullptr);
+    FILE* stdin_backup = stdin;
+    stdin = f;
+
+    size_t identifiers = 0;
+    size_t keywords = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    Token token = scanner_FSM();
+    while(token.type != TOKEN_EOF) {
+        if(token.type == TOKEN_IDENTIFIER) {
+            identifiers++;
+        }
+        else {
+            keywords++;
+        }
+        if(token.value != NULL) {
+            DString_free(token.value);
+        }
+        token = scanner_FSM();
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    stdin = stdin_backup;
+    fclose(f);
+
+    EXPECT_EQ(identifiers, 7 * repeat);
+    EXPECT_EQ(keywords, 8 * repeat);
+
+    std::chrono::duration<double, std::milli> elapsed = end - start;
+    cerr << "[ BENCH    ] " << (identifiers + keywords) << " tokenů za "
+         << elapsed.count() << " ms" << endl;
+}
+
+
+/**
+ * @brief Načte všechny tokeny ze vstupu daným backendem scanneru.
+ *
+ * @details Načítání skončí tokenem EOF nebo první lexikální chybou, která je
+ *          v posloupnosti zaznamenána jako token typu TOKEN_UNINITIALIZED.
+ */
+vector<pair<int, string>> scanAll(FILE *input, Token (*backend)()) {
+    vector<pair<int, string>> tokens;
+    FILE* stdin_backup = stdin;
+    stdin = input;
+    parser_errorWatcher(RESET_ERROR_FLAGS);
+
+    while(true) {
+        Token token = backend();
+        bool lexError = parser_errorWatcher(IS_PARSING_ERROR);
+        string value = (token.value != NULL) ? string(token.value->str) : string();
+        if(token.value != NULL) {
+            DString_free(token.value);
+        }
+
+        if(lexError) {
+            tokens.push_back({TOKEN_UNINITIALIZED, ""});
+            break;
+        }
+        tokens.push_back({token.type, value});
+        if(token.type == TOKEN_EOF) {
+            break;
+        }
+    }
+
+    parser_errorWatcher(RESET_ERROR_FLAGS);
+    stdin = stdin_backup;
+    return tokens;
+}
+
+/**
+ * @brief Ověří, že ruční i tabulkově řízený scanner vrátí pro vstup stejné tokeny.
+ */
+void expectSameTokens(FILE *first, FILE *second, const string &name) {
+    vector<pair<int, string>> expected = scanAll(first, scanner_FSM);
+    vector<pair<int, string>> actual = scanAll(second, scannerDFA_FSM);
+
+    ASSERT_EQ(expected.size(), actual.size()) << name;
+    for(size_t i = 0; i < expected.size(); i++) {
+        EXPECT_EQ(expected[i].first, actual[i].first) << name << ", token " << i;
+        EXPECT_EQ(expected[i].second, actual[i].second) << name << ", token " << i;
+    }
+}
+
+/**
+ * @brief Ekvivalence backendů scanneru na všech lexikálních příkladech
+ *        (a dalších testovacích programech).
+ */
+TEST(DFA, EquivalentOnExamples) {
+    const char *dirs[] = {
+        "../test/test_examples/lexical_examples",
+        "../test/test_examples/ifj24code_examples/in",
+        "../test/test_examples/syntactic_examples",
+        "../test/test_examples/semantic_examples",
+    };
+    size_t checked = 0;
+
+    for(const char *dir : dirs) {
+        for(const auto &entry : filesystem::directory_iterator(dir)) {
+            if(entry.path().extension() != ".zig") {
+                continue;
+            }
+            string path = entry.path().string();
+            FILE *first = fopen(path.c_str(), "r");
+            FILE *second = fopen(path.c_str(), "r");
+            ASSERT_NE(first, nullptr);
+            ASSERT_NE(second, nullptr);
+            expectSameTokens(first, second, path);
+            fclose(first);
+            fclose(second);
+            checked++;
+        }
+    }
+
+    EXPECT_GT(checked, 0u);
+}
+
+/**
+ * @brief Ekvivalence backendů scanneru na okrajových a chybných vstupech.
+ */
+TEST(DFA, EquivalentOnEdgeCases) {
+    const char *inputs[] = {
+        "a1_b2 _ __x const constx ifj.write(x);",
+        "0 12 3.14 1e5 2e+3 4e-2 6.5e10 7.0e+1 9x",
+        "1. 2.e3 3e 3ea 5e+ 5e+ ;",
+        "a==b a=b a!=b a<b a<=b a>b a>=b a/b a / b",
+        "x // komentar ; @ ]\ny // posledni",
+        "@import @import1 @imp @importx @ import",
+        "[]u8 [ ] u8 ?i32 ?f64 ?[]u8 ? [ ] u8 ?i 32",
+        "\"a\\n\\t\\r\\\"\\\\\\x41\\x7e\" \"bad\\q\"",
+        "\"\\xg1\"",
+        "\"neukonceny",
+        "\\\\ prvni\n    \\\\ druhy\n  ;",
+        "\\\\ jediny\n;",
+        "x # y",
+        "]",
+        "!x",
+        "a\x01",
+        "",
+    };
+
+    for(const char *input : inputs) {
+        size_t len = strlen(input);
+        FILE *first = fmemopen((void*)input, len, "r");
+        FILE *second = fmemopen((void*)input, len, "r");
+        ASSERT_NE(first, nullptr);
+        ASSERT_NE(second, nullptr);
+        expectSameTokens(first, second, input);
+        fclose(first);
+        fclose(second);
+    }
+}
+
+
+/**
+ * @brief Vyhledávací funkce vstupu scanneru vrací stejné pozice jako
+ *        jednoduchá skalární implementace (včetně okrajů bloků SSE2).
+ */
+TEST(Input, KernelsMatchScalar) {
+    const char alphabet[] = { ' ', '\t', '\n', '\r', '\v', '\f', '"', '\\', 'a',
+                              '/', '\x01', '\x1f', '\x7f', (char)0x80, (char)0xff };
+    srand(42);
+
+    for(int round = 0; round < 200; round++) {
+        size_t length = (size_t)(rand() % 80);
+        string data;
+        for(size_t i = 0; i < length; i++) {
+            // Převaha mezer a písmen, aby vznikaly i delší úseky bez shody
+            int pick = rand() % 40;
+            data += (pick < (int)sizeof(alphabet)) ? alphabet[pick] : (pick % 2 ? ' ' : 'x');
+        }
+
+        for(size_t from = 0; from <= length; from++) {
+            size_t ws = from, control = from, newline = from, stringEnd = from;
+            while(ws < length && isspace((unsigned char)data[ws])) ws++;
+            while(control < length && (unsigned char)data[control] >= ' ') control++;
+            while(newline < length && data[newline] != '\n') newline++;
+            while(stringEnd < length && data[stringEnd] != '"' && data[stringEnd] != '\\') stringEnd++;
+
+            EXPECT_EQ(scannerInput_skipWhitespace(data.data(), from, length), ws);
+            EXPECT_EQ(scannerInput_findControl(data.data(), from, length), control);
+            EXPECT_EQ(scannerInput_findNewline(data.data(), from, length), newline);
+            EXPECT_EQ(scannerInput_findStringEnd(data.data(), from, length), stringEnd);
+        }
+    }
+}
+
+/**
+ * @brief Scanner nad načteným vstupem vrací stejné tokeny jako při čtení ze STDIN.
+ */
+TEST(Input, BufferedEquivalentOnExamples) {
+    const char *dirs[] = {
+        "../test/test_examples/lexical_examples",
+        "../test/test_examples/ifj24code_examples/in",
+        "../test/test_examples/syntactic_examples",
+    };
+
+    for(const char *dir : dirs) {
+        for(const auto &entry : filesystem::directory_iterator(dir)) {
+            if(entry.path().extension() != ".zig") {
+                continue;
+            }
+            string path = entry.path().string();
+            FILE *f = fopen(path.c_str(), "r");
+            ASSERT_NE(f, nullptr);
+            vector<pair<int, string>> expected = scanAll(f, scanner_FSM);
+
+            rewind(f);
+            string content;
+            char buffer[4096];
+            size_t read;
+            while((read = fread(buffer, 1, sizeof(buffer), f)) > 0) {
+                content.append(buffer, read);
+            }
+            fclose(f);
+
+            ASSERT_TRUE(scannerInput_setBuffer(content.data(), content.size()));
+            vector<pair<int, string>> actual = scanAll(stdin, scanner_FSM);
+            scannerInput_free();
+
+            EXPECT_EQ(expected, actual) << path;
+        }
+    }
+}
+
+/**
+ * @brief Referenční skalární validace vstupu dekódováním znaků UTF-8.
+ */
+static size_t validateReference(const string &data) {
+    size_t i = 0;
+    while(i < data.size()) {
+        unsigned char c = (unsigned char)data[i];
+        if(c < 0x80) {
+            if(c < ' ' && !isspace(c)) return i;
+            i++;
+            continue;
+        }
+
+        size_t length = (c >= 0xF0) ? 4 : (c >= 0xE0) ? 3 : (c >= 0xC0) ? 2 : 0;
+        if(length == 0 || c > 0xF4 || i + length > data.size()) return i;
+
+        uint32_t codePoint = c & (0x7F >> length);
+        for(size_t j = 1; j < length; j++) {
+            unsigned char next = (unsigned char)data[i + j];
+            if((next & 0xC0) != 0x80) return i;
+            codePoint = (codePoint << 6) | (next & 0x3F);
+        }
+
+        // Nejkratší zápis, mimo náhradní páry a nejvýše U+10FFFF
+        const uint32_t minimum[] = { 0, 0, 0x80, 0x800, 0x10000 };
+        if(codePoint < minimum[length] || (codePoint >= 0xD800 && codePoint <= 0xDFFF) ||
+           codePoint > 0x10FFFF) {
+            return i;
+        }
+        i += length;
+    }
+    return data.size();
+}
+
+/**
+ * @brief Validace vstupu vrací stejnou pozici jako referenční implementace.
+ */
+TEST(Input, ValidateMatchesReference) {
+    const char *cases[] = {
+        "const a = 5;",
+        "// p\xc5\x99\xc3\xadli\xc5\xa1 \xc5\xbelu\xc5\xa5ou\xc4\x8dk\xc3\xbd k\xc5\xaf\xc5\x88\n",
+        "\xf0\x9f\x98\x80 emoji",
+        "\xc0\xaf overlong",
+        "\xe0\x80\xaf overlong",
+        "\xed\xa0\x80 surrogate",
+        "\xf4\x90\x80\x80 too big",
+        "\xe2\x82 truncated",
+        "truncated at end \xe2\x82",
+        "lone continuation \x80",
+        "tab\tand\r\nnewlines\v\f",
+        "bell \x07 in program",
+        "escape \x1b in program",
+    };
+    for(const char *text : cases) {
+        string data(text);
+        EXPECT_EQ(scannerInput_validate(data.data(), data.size()), validateReference(data)) << text;
+    }
+    string nul("before\0after", 12);
+    EXPECT_EQ(scannerInput_validate(nul.data(), nul.size()), 6u);
+
+    // Náhodné vstupy s převahou ASCII znaků, aby byly pokryty i bloky SSE2
+    srand(7);
+    for(int round = 0; round < 2000; round++) {
+        size_t length = (size_t)(rand() % 100);
+        string data;
+        for(size_t i = 0; i < length; i++) {
+            int pick = rand() % 100;
+            data += (pick < 90) ? (char)(' ' + pick) : (char)(rand() % 256);
+        }
+        EXPECT_EQ(scannerInput_validate(data.data(), data.size()), validateReference(data));
+    }
+}
+
+/**
+ * @brief Všechny ukázkové zdrojové soubory projdou validací vstupu.
+ */
+TEST(Input, ValidateExamples) {
+    const char *dirs[] = {
+        "../test/test_examples/lexical_examples",
+        "../test/test_examples/ifj24code_examples/in",
+        "../test/test_examples/syntactic_examples",
+    };
+
+    for(const char *dir : dirs) {
+        for(const auto &entry : filesystem::directory_iterator(dir)) {
+            if(entry.path().extension() != ".zig") {
+                continue;
+            }
+            FILE *f = fopen(entry.path().string().c_str(), "r");
+            ASSERT_NE(f, nullptr);
+            string content;
+            char buffer[4096];
+            size_t read;
+            while((read = fread(buffer, 1, sizeof(buffer), f)) > 0) {
+                content.append(buffer, read);
+            }
+            fclose(f);
+
+            ASSERT_TRUE(scannerInput_setBuffer(content.data(), content.size()));
+            EXPECT_TRUE(scannerInput_validateBuffer()) << entry.path();
+            EXPECT_TRUE(scannerInput.validated);
+            scannerInput_free();
+        }
+    }
+}
+
+/**
+ * @brief Benchmark scanneru na vstupu s dlouhými komentáři a řetězci.
+ */
+TEST(Input, CommentAndStringBenchmark) {
+    const size_t repeat = 20000;
+    string input;
+    for(size_t i = 0; i < repeat; i++) {
+        input += "    // komentar, ktery je delsi nez jeden blok SSE2 a obsahuje \"uvozovky\"\n";
+        input += "    ifj.write(\"retezec s dostatecne dlouhym telem bez escape sekvenci\\n\");\n";
+    }
+
+    ASSERT_TRUE(scannerInput_setBuffer(input.data(), input.size()));
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(scannerInput_validateBuffer());
+
+    size_t strings = 0;
+    size_t tokens = 0;
+    Token token = scanner_FSM();
+    while(token.type != TOKEN_EOF && token.type != TOKEN_UNINITIALIZED) {
+        if(token.type == TOKEN_STRING) {
+            strings++;
+        }
+        if(token.value != NULL) {
+            DString_free(token.value);
+        }
+        tokens++;
+        token = scanner_FSM();
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    scannerInput_free();
+
+    EXPECT_EQ(token.type, TOKEN_EOF);
+    EXPECT_EQ(strings, repeat);
+    EXPECT_EQ(tokens, 7 * repeat);
+
+    std::chrono::duration<double, std::milli> elapsed = end - start;
+    cerr << "[ BENCH    ] " << input.size() << " B za " << elapsed.count() << " ms" << endl;
+}
+/**
+ * @brief Převod celočíselných literálů včetně přetečení.
+ */
+TEST(Number, ParseInt) {
+    int64_t value;
+    EXPECT_TRUE(numberLiteral_parseInt("0", 1, &value));
+    EXPECT_EQ(value, 0);
+    EXPECT_TRUE(numberLiteral_parseInt("2147483647", 10, &value));
+    EXPECT_EQ(value, 2147483647);
+    EXPECT_TRUE(numberLiteral_parseInt("9223372036854775807", 19, &value));
+    EXPECT_EQ(value, INT64_MAX);
+    EXPECT_TRUE(numberLiteral_parseInt("99999999999999999999999", 23, &value));
+    EXPECT_EQ(value, INT64_MAX);
+    EXPECT_FALSE(numberLiteral_parseInt("12a", 3, &value));
+    EXPECT_FALSE(numberLiteral_parseInt("", 0, &value));
+}
+
+/**
+ * @brief Převod desetinných literálů dává stejné hodnoty jako strtod.
+ */
+TEST(Number, ParseFloatMatchesStrtod) {
+    vector<string> literals = { "0.0", "1.0", "0.1", "3.14", "1e10", "1E-5", "2.5e+3",
+                                "123456789012345678.5", "1234567890123456789012.0",
+                                "9007199254740993.0", "1e22", "1e23", "1e-22", "4.9e-324",
+                                "1.7976931348623157e308", "0.000000000000000000001",
+                                "00001.5", "0e999999" };
+
+    // Náhodné literály s různým počtem číslic a exponentem
+    srand(23);
+    for(int i = 0; i < 5000; i++) {
+        string literal = to_string(rand() % 100000);
+        if(rand() % 2) {
+            literal += "." + to_string(rand());
+        }
+        if(rand() % 2) {
+            literal += (rand() % 2 ? "e-" : "e") + to_string(rand() % 40);
+        }
+        literals.push_back(literal);
+    }
+
+    for(const string &literal : literals) {
+        double value;
+        ASSERT_TRUE(numberLiteral_parseFloat(literal.c_str(), literal.size(), &value)) << literal;
+        double expected = strtod(literal.c_str(), NULL);
+        EXPECT_EQ(memcmp(&value, &expected, sizeof(double)), 0) << literal;
+    }
+
+    double value;
+    EXPECT_FALSE(numberLiteral_parseFloat("1e", 2, &value));
+    EXPECT_FALSE(numberLiteral_parseFloat("1.5x", 4, &value));
+}
+
+/**
+ * @brief Načte všechny tokeny přes cache tokenů.
+ */
+static vector<pair<int, string>> scanAllCached() {
+    vector<pair<int, string>> tokens;
+    Token token;
+    do {
+        token = tokenCache_getNextToken();
+        string value = (token.value != NULL) ? string(token.value->str, token.value->length) : "<null>";
+        tokens.emplace_back(token.type, value);
+        if(token.value != NULL) {
+            DString_free(token.value);
+        }
+    } while(token.type != TOKEN_EOF && token.type != TOKEN_UNINITIALIZED);
+    return tokens;
+}
+
+/**
+ * @brief Teplá cache vrací stejné tokeny bez spuštění scanneru (benchmark).
+ */
+TEST(TokenCache, WarmCacheSkipsLexing) {
+    filesystem::path dir = filesystem::temp_directory_path() / "ifj24_token_cache_test";
+    filesystem::remove_all(dir);
+    filesystem::create_directories(dir);
+
+    string input;
+    for(size_t i = 0; i < 5000; i++) {
+        input += "    var x" + to_string(i) + ": ?f64 = 3.5e2 * (y + " + to_string(i) + ");\n";
+        input += "    // komentar\n    ifj.write(\"radek\\n\\x41\");\n";
+    }
+    parser_errorWatcher(RESET_ERROR_FLAGS);
+
+    // Studená cache: tokeny vrací scanner a zaznamenávají se
+    ASSERT_TRUE(scannerInput_setBuffer(input.data(), input.size()));
+    ASSERT_TRUE(tokenCache_init(dir.c_str()));
+    EXPECT_EQ(tokenCache.mode, TOKEN_CACHE_RECORD);
+    auto coldStart = std::chrono::steady_clock::now();
+    vector<pair<int, string>> cold = scanAllCached();
+    auto coldEnd = std::chrono::steady_clock::now();
+    EXPECT_EQ(cold.back().first, TOKEN_EOF);
+    EXPECT_EQ(tokenCache.mode, TOKEN_CACHE_OFF);
+
+    // Teplá cache: tokeny se čtou ze souboru a vstup zůstane nepřečten
+    ASSERT_TRUE(scannerInput_setBuffer(input.data(), input.size()));
+    ASSERT_TRUE(tokenCache_init(dir.c_str()));
+    EXPECT_EQ(tokenCache.mode, TOKEN_CACHE_READ);
+    auto warmStart = std::chrono::steady_clock::now();
+    vector<pair<int, string>> warm = scanAllCached();
+    auto warmEnd = std::chrono::steady_clock::now();
+    EXPECT_EQ(scannerInput.position, 0u);
+    EXPECT_EQ(cold, warm);
+
+    // Změněný vstup cache nepoužije
+    input[input.size() - 3] = 'B';
+    ASSERT_TRUE(scannerInput_setBuffer(input.data(), input.size()));
+    ASSERT_TRUE(tokenCache_init(dir.c_str()));
+    EXPECT_EQ(tokenCache.mode, TOKEN_CACHE_RECORD);
+
+    tokenCache_free();
+    scannerInput_free();
+    filesystem::remove_all(dir);
+
+    std::chrono::duration<double, std::milli> coldTime = coldEnd - coldStart;
+    std::chrono::duration<double, std::milli> warmTime = warmEnd - warmStart;
+    cerr << "[ BENCH    ] " << cold.size() << " tokenů: scanner " << coldTime.count()
+         << " ms, cache " << warmTime.count() << " ms" << endl;
+}
+
+/**
+ * @brief Vygeneruje program s mnoha funkcemi o velikosti několika MB.
+ */
+static string generatePipelineProgram(int count) {
+    string program = "const ifj = @import(\"ifj24.zig\");\n";
+    for(int i = 0; i < count; i++) {
+        string call = i == 0 ? "x - 1" : "fun" + to_string(i - 1) + "(x)";
+        program += "pub fn fun" + to_string(i) + "(a: i32) i32 {\n"
+                   "    // komentar k funkci " + to_string(i) + "\n"
+                   "    var x: i32 = a + " + to_string(i) + ";\n"
+                   "    const s = ifj.string(\"retezec \\x41\\n\");\n"
+                   "    const f: f64 = 3.5e2 * 1.25;\n"
+                   "    while (x > 100) {\n"
+                   "        x = x / 2;\n"
+                   "    }\n"
+                   "    if (ifj.strcmp(s, s) == 0) {\n"
+                   "        x = x + ifj.ord(s, 1);\n"
+                   "    } else {\n"
+                   "        x = x * 2;\n"
+                   "    }\n"
+                   "    const y = " + call + ";\n"
+                   "    _ = f;\n"
+                   "    return y;\n"
+                   "}\n";
+    }
+    program += "pub fn main() void {\n"
+               "    const r = fun" + to_string(count - 1) + "(1);\n"
+               "    ifj.write(r);\n"
+               "}\n";
+    return program;
+}
+
+/**
+ * @brief Vlákno scanneru vrací stejné tokeny jako synchronní scanner.
+ */
+TEST(ScannerPipeline, SameTokensAsScanner) {
+    string input = generatePipelineProgram(2000);
+    parser_errorWatcher(RESET_ERROR_FLAGS);
+
+    ASSERT_TRUE(scannerInput_setBuffer(input.data(), input.size()));
+    vector<pair<int, string>> synchronous = scanAllCached();
+
+    ASSERT_TRUE(scannerInput_setBuffer(input.data(), input.size()));
+    scannerPipeline_init("1");
+    vector<pair<int, string>> pipelined = scanAllCached();
+
+    // Za koncem souboru vrací EOF opět scanner
+    Token token = scannerPipeline_getNextToken();
+    EXPECT_EQ(token.type, TOKEN_EOF);
+
+    EXPECT_GT(synchronous.size(), (size_t)SCANNER_PIPELINE_RING_SIZE);
+    EXPECT_EQ(pipelined, synchronous);
+    EXPECT_FALSE(parser_errorWatcher(IS_PARSING_ERROR));
+
+    scannerInput_free();
+}
+
+/**
+ * @brief Lexikální chyba se parseru ohlásí až s tokenem, při jehož čtení vznikla.
+ */
+TEST(ScannerPipeline, ErrorArrivesWithToken) {
+    string input = "a b $ c d";
+    parser_errorWatcher(RESET_ERROR_FLAGS);
+
+    ASSERT_TRUE(scannerInput_setBuffer(input.data(), input.size()));
+    scannerPipeline_init("1");
+
+    // Necháme scanner dočíst celý vstup napřed
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    Token token = scannerPipeline_getNextToken();
+    DString_free(token.value);
+    token = scannerPipeline_getNextToken();
+    DString_free(token.value);
+    EXPECT_FALSE(parser_errorWatcher(IS_PARSING_ERROR));
+
+    // Token s neplatným znakem chybu přinese
+    token = scannerPipeline_getNextToken();
+    if(token.value != NULL) {
+        DString_free(token.value);
+    }
+    EXPECT_TRUE(parser_errorWatcher(IS_PARSING_ERROR));
+
+    // Nepřevzaté tokeny uvolní ukončení vlákna
+    scannerPipeline_free();
+    scannerInput_free();
+    parser_errorWatcher(RESET_ERROR_FLAGS);
+}
+
+/**
+ * @brief Parsování vícemegabajtového programu se synchronním scannerem
+ *        a se scannerem ve vlastním vlákně (benchmark).
+ */
+TEST(ScannerPipeline, ParseBenchmark) {
+    string input = generatePipelineProgram(8000);
+    double times[2];
+
+    for(int pipelined = 0; pipelined < 2; pipelined++) {
+        parser_errorWatcher(RESET_ERROR_FLAGS);
+        ASSERT_TRUE(scannerInput_setBuffer(input.data(), input.size()));
+        scannerPipeline_init(pipelined ? "1" : "0");
+
+        auto start = std::chrono::steady_clock::now();
+        LLparser_parseProgram();
+        std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+        times[pipelined] = duration.count();
+
+        EXPECT_FALSE(parser_errorWatcher(IS_PARSING_ERROR));
+        ASSERT_NE(ASTroot, nullptr);
+        IFJ24Compiler_freeAllAllocatedMemory();
+    }
+
+    cerr << "[ BENCH    ] " << input.size() / 1024 << " KiB: parser se scannerem "
+         << times[0] << " ms, se scannerem ve vlákně " << times[1] << " ms" << endl;
+}
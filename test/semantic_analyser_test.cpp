@@ -27,6 +27,7 @@
  *          abstraktního syntaktického stromu.
  */
 
+#include <chrono>
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 
@@ -1091,3 +1092,364 @@ TEST(SemanticError, DeadCode){
     fclose(f);
     ASTroot = NULL;
 }
+
+/**
+ * @brief Vytvoří program s řetězcem funkcí, volitelně s chybami ve vybraných funkcích.
+ *
+ * @param [in] count Počet funkcí kromě main
+ * @param [in] paramIndex Index funkce se špatným typem argumentu, nebo -1
+ * @param [in] typeIndex Index funkce s podmínkou typu i32, nebo -1
+ */
+static string generateChainProgram(int count, int paramIndex, int typeIndex) {
+    string program = "const ifj = @import(\"ifj24.zig\");\n";
+    for(int i = 0; i < count; i++) {
+        string call = i == 0 ? "x - 1" : "fun" + to_string(i - 1) + "(x)";
+        program += "pub fn fun" + to_string(i) + "(a: i32) i32 {\n"
+                   "    var x: i32 = a + " + to_string(i) + ";\n"
+                   "    x = x * 2;\n";
+        if(i == paramIndex) {
+            program += "    const n = ifj.length(x);\n"
+                       "    ifj.write(n);\n";
+        }
+        if(i == typeIndex) {
+            program += "    if (x) {\n"
+                       "        ifj.write(x);\n"
+                       "    } else {\n"
+                       "        ifj.write(a);\n"
+                       "    }\n";
+        }
+        program += "    const y = " + call + ";\n"
+                   "    return y;\n"
+                   "}\n";
+    }
+    program += "pub fn main() void {\n"
+               "    const r = fun" + to_string(count - 1) + "(1);\n"
+               "    ifj.write(r);\n"
+               "}\n";
+    return program;
+}
+
+/**
+ * @brief Provede analýzu definic funkcí programu s daným počtem vláken.
+ */
+static ErrorType analyseWithThreads(const string &program, const char *threads,
+                                    double *milliseconds = nullptr) {
+    setenv(SEMANTIC_THREADS_ENV, threads, 1);
+
+    FILE* f = fmemopen((void *)program.data(), program.size(), "r");
+    FILE* stdinBackup = stdin;
+    stdin = f;
+
+    parser_errorWatcher(RESET_ERROR_FLAGS);
+    LLparser_parseProgram();
+    auto start = std::chrono::steady_clock::now();
+    ErrorType error = semantic_analyseFunctionDefinitions();
+    if(error == SUCCESS) {
+        error = semantic_analyseVariables();
+    }
+    std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+    if(milliseconds != nullptr) {
+        *milliseconds = duration.count();
+    }
+
+    IFJ24Compiler_freeAllAllocatedMemory();
+    stdin = stdinBackup;
+    fclose(f);
+    unsetenv(SEMANTIC_THREADS_ENV);
+
+    return error;
+}
+
+/**
+ * @brief Testuje paralelní analýzu správného programu s mnoha funkcemi
+ */
+TEST(Parallel, ManyFunctionsCorrect){
+    ASSERT_GE(semantic_threadCount(SEMANTIC_PARALLEL_THRESHOLD), 1u);
+    EXPECT_EQ(semantic_threadCount(SEMANTIC_PARALLEL_THRESHOLD - 1), 1u);
+
+    string program = generateChainProgram(500, -1, -1);
+    EXPECT_EQ(analyseWithThreads(program, "1"), SUCCESS);
+    EXPECT_EQ(analyseWithThreads(program, "8"), SUCCESS);
+}
+
+/**
+ * @brief Testuje výklad přepínače počtu vláken
+ */
+TEST(Parallel, ThreadCountSetting){
+    size_t automatic = settings_threadCount(NULL, 100, 64, 16);
+    ASSERT_GE(automatic, 1u);
+    ASSERT_LE(automatic, 16u);
+
+    EXPECT_EQ(settings_threadCount("4", 100, 64, 16), 4u);
+    EXPECT_EQ(settings_threadCount("4", 63, 64, 16), 1u);
+    EXPECT_EQ(settings_threadCount("99", 100, 64, 16), 16u);
+    EXPECT_EQ(settings_threadCount("0", 100, 64, 16), 1u);
+    EXPECT_EQ(settings_threadCount("-3", 100, 64, 16), 1u);
+
+    // Neplatná hodnota se chová jako nenastavená proměnná
+    EXPECT_EQ(settings_threadCount("", 100, 64, 16), automatic);
+    EXPECT_EQ(settings_threadCount("abc", 100, 64, 16), automatic);
+    EXPECT_EQ(settings_threadCount("4x", 100, 64, 16), automatic);
+    EXPECT_EQ(settings_threadCount("99999999999999999999", 100, 64, 16), automatic);
+}
+
+/**
+ * @brief Testuje, že paralelní analýza hlásí chybu první chybné funkce
+ */
+TEST(Parallel, DeterministicFirstError){
+    // Chyba typu je v dřívější funkci než chyba argumentu a naopak
+    string typeFirst = generateChainProgram(500, 400, 100);
+    string paramFirst = generateChainProgram(500, 100, 400);
+
+    EXPECT_EQ(analyseWithThreads(typeFirst, "1"), ERROR_SEM_TYPE_COMPATIBILITY);
+    EXPECT_EQ(analyseWithThreads(paramFirst, "1"), ERROR_SEM_PARAMS_OR_RETVAL);
+
+    for(int i = 0; i < 10; i++) {
+        EXPECT_EQ(analyseWithThreads(typeFirst, "8"), ERROR_SEM_TYPE_COMPATIBILITY);
+        EXPECT_EQ(analyseWithThreads(paramFirst, "8"), ERROR_SEM_PARAMS_OR_RETVAL);
+    }
+}
+
+/**
+ * @brief Benchmark sekvenční a paralelní analýzy definic funkcí
+ */
+TEST(Parallel, Benchmark){
+    string program = generateChainProgram(4000, -1, -1);
+
+    double sequential = 0;
+    double parallel = 0;
+    EXPECT_EQ(analyseWithThreads(program, "1", &sequential), SUCCESS);
+    EXPECT_EQ(analyseWithThreads(program, "8", &parallel), SUCCESS);
+
+    cerr << "[ BENCH    ] analýza 4000 funkcí: 1 vlákno " << sequential
+         << " ms, 8 vláken " << parallel << " ms" << endl;
+}
+
+/**
+ * @brief Provede analýzu definic funkcí programu a před uvolněním AST
+ *        zavolá kontrolu jeho obsahu.
+ */
+static ErrorType analyseAndCheck(const string &program, const function<void()> &check) {
+    FILE* f = fmemopen((void *)program.data(), program.size(), "r");
+    FILE* stdinBackup = stdin;
+    stdin = f;
+
+    parser_errorWatcher(RESET_ERROR_FLAGS);
+    LLparser_parseProgram();
+    ErrorType error = semantic_analyseFunctionDefinitions();
+    if(error == SUCCESS) {
+        check();
+    }
+
+    IFJ24Compiler_freeAllAllocatedMemory();
+    stdin = stdinBackup;
+    fclose(f);
+
+    return error;
+}
+
+/**
+ * @brief Ověří, že výraz byl nahrazen celočíselným literálem s danou hodnotou.
+ */
+static void expectIntLiteral(AST_ExprNode *expr, int expected) {
+    ASSERT_EQ(expr->exprType, AST_EXPR_LITERAL);
+    AST_VarNode *literal = (AST_VarNode *)expr->expression;
+    ASSERT_EQ(literal->literalType, AST_LITERAL_INT);
+    EXPECT_EQ(*(int *)literal->value, expected);
+}
+
+/**
+ * @brief Testuje nahrazení konstantních výrazů literály i tam, kde volající
+ *        hodnotu výrazu nepožaduje (argument funkce, návratová hodnota)
+ */
+TEST(ConstantFolding, ReplacesSubtreesWithLiterals){
+    string program = "const ifj = @import(\"ifj24.zig\");\n"
+                     "pub fn main() void {\n"
+                     "    ifj.write((0 - 9) / 4);\n"
+                     "    const b: f64 = 1 + 2.5;\n"
+                     "    if (b < 4) {\n"
+                     "        ifj.write(b);\n"
+                     "    } else {\n"
+                     "    }\n"
+                     "    const r = f(7);\n"
+                     "    ifj.write(r);\n"
+                     "}\n"
+                     "pub fn f(x: i32) i32 {\n"
+                     "    ifj.write(x);\n"
+                     "    return 2 * (3 + 4) - 10 / 3;\n"
+                     "}\n";
+
+    ErrorType error = analyseAndCheck(program, [](){
+        AST_StatementNode *statement = ASTroot->functionList->body;
+
+        // Celočíselné dělení zaokrouhluje dolů: -9 / 4 = -3
+        AST_FunCallNode *write = (AST_FunCallNode *)statement->statement;
+        expectIntLiteral(write->arguments->expression, -3);
+
+        // Podmínka se známou hodnotou proměnné je pravdivostní literál,
+        // definice dosazené konstanty b z bloku zmizela
+        statement = statement->next;
+        ASSERT_EQ(statement->statementType, AST_STATEMENT_IF);
+        AST_ExprNode *condition = ((AST_IfNode *)statement->statement)->condition;
+        ASSERT_EQ(condition->exprType, AST_EXPR_LITERAL);
+        AST_VarNode *literal = (AST_VarNode *)condition->expression;
+        ASSERT_EQ(literal->literalType, AST_LITERAL_BOOL);
+        EXPECT_TRUE(*(bool *)literal->value);
+
+        // Návratová hodnota funkce f()
+        statement = ASTroot->functionList->next->body->next;
+        ASSERT_EQ(statement->statementType, AST_STATEMENT_RETURN);
+        expectIntLiteral((AST_ExprNode *)statement->statement, 11);
+    });
+    EXPECT_EQ(error, SUCCESS);
+}
+
+/**
+ * @brief Testuje, že dělení nulou a přetečení i32 ve výrazu známém při
+ *        překladu jsou stejně jako v jazyce Zig chybou překladu
+ */
+TEST(ConstantFolding, DivisionByZeroAndOverflow){
+    string header = "const ifj = @import(\"ifj24.zig\");\n"
+                    "pub fn main() void {\n";
+    string footer = "}\n";
+
+    auto noCheck = [](){};
+    const char *errorPrograms[] = {
+        "    ifj.write(11 / (8 / 12));\n",
+        "    const a = 2147483647 + 1;\n    ifj.write(a);\n",
+        "    const a = (0 - 2147483647 - 1) / (0 - 1);\n    ifj.write(a);\n",
+    };
+    for(const char *body : errorPrograms) {
+        ErrorType error = analyseAndCheck(header + body + footer, noCheck);
+        EXPECT_EQ(error, ERROR_SEM_OTHER) << body;
+    }
+
+    // Největší hodnota i32 ještě chybou není
+    ErrorType error = analyseAndCheck(header + "    const a = 2147483646 + 1;\n"
+                                      "    ifj.write(a);\n" + footer, [](){
+        AST_FunCallNode *write = (AST_FunCallNode *)ASTroot->functionList->body->statement;
+        expectIntLiteral(write->arguments->expression, 2147483647);
+    });
+    EXPECT_EQ(error, SUCCESS);
+}
+
+/**
+ * @brief Testuje dosazení konstant se známou hodnotou do všech použití
+ *        a odstranění jejich definic, na které nezůstal žádný odkaz
+ */
+TEST(ConstantPropagation, DropsSubstitutedDefinitions){
+    string program = "const ifj = @import(\"ifj24.zig\");\n"
+                     "pub fn main() void {\n"
+                     "    const a = 5;\n"
+                     "    const s = ifj.string(\"x\");\n"
+                     "    const n: ?i32 = 3;\n"
+                     "    var v: i32 = a;\n"
+                     "    v = v + a * 2;\n"
+                     "    ifj.write(s);\n"
+                     "    if (n) |x| {\n"
+                     "        ifj.write(x);\n"
+                     "    } else {\n"
+                     "    }\n"
+                     "    while (v < 100) {\n"
+                     "        const k = 10;\n"
+                     "        v = v + k;\n"
+                     "    }\n"
+                     "}\n";
+
+    ErrorType error = analyseAndCheck(program, [](){
+        AST_StatementNode *statement = ASTroot->functionList->body;
+
+        // Řetězec ani hodnotu s null do literálu nedosazujeme, definice zůstanou
+        ASSERT_EQ(statement->statementType, AST_STATEMENT_VAR_DEF);
+        statement = statement->next;
+        ASSERT_EQ(statement->statementType, AST_STATEMENT_VAR_DEF);
+
+        // Definice konstanty a zmizela, proměnná v je inicializována literálem
+        statement = statement->next;
+        ASSERT_EQ(statement->statementType, AST_STATEMENT_VAR_DEF);
+        AST_BinOpNode *def = (AST_BinOpNode *)((AST_ExprNode *)statement->statement)->expression;
+        expectIntLiteral(def->right, 5);
+
+        // Pravý operand přiřazení je složen z dosazené konstanty
+        statement = statement->next;
+        ASSERT_EQ(statement->statementType, AST_STATEMENT_EXPR);
+        AST_BinOpNode *assign = (AST_BinOpNode *)((AST_ExprNode *)statement->statement)->expression;
+        AST_BinOpNode *add = (AST_BinOpNode *)assign->right->expression;
+        expectIntLiteral(add->right, 10);
+
+        statement = statement->next->next;
+        ASSERT_EQ(statement->statementType, AST_STATEMENT_IF);
+
+        // Z těla cyklu zmizela definice konstanty k
+        statement = statement->next;
+        ASSERT_EQ(statement->statementType, AST_STATEMENT_WHILE);
+        AST_StatementNode *body = ((AST_WhileNode *)statement->statement)->body;
+        ASSERT_EQ(body->statementType, AST_STATEMENT_EXPR);
+        EXPECT_EQ(body->next, nullptr);
+        assign = (AST_BinOpNode *)((AST_ExprNode *)body->statement)->expression;
+        add = (AST_BinOpNode *)assign->right->expression;
+        expectIntLiteral(add->right, 10);
+    });
+    EXPECT_EQ(error, SUCCESS);
+}
+
+/**
+ * @brief Testuje hluboce vnořené výrazy se smíšenými typy i32 a f64, u kterých
+ *        se v každé úrovni provádí implicitní konverze operandu
+ */
+TEST(ConstantFolding, DeepMixedExpressions){
+    const int depth = 2000;
+
+    // Doprava vnořený výraz známý při překladu: 1 + (2 + (... + (depth + 0.5)))
+    string known;
+    for(int i = 1; i <= depth; i++) {
+        known += to_string(i) + " + (";
+    }
+    known += "0 + 0.5";
+    known += string(depth, ')');
+
+    // Doleva vnořený výraz s neznámou proměnnou: x * 2 + 1 + 2 + ... + depth
+    string unknown = "x * 2";
+    for(int i = 1; i <= depth; i++) {
+        unknown += " + " + to_string(i);
+    }
+
+    string program = "const ifj = @import(\"ifj24.zig\");\n"
+                     "pub fn main() void {\n"
+                     "    var x: f64 = 1.5;\n"
+                     "    x = x + (" + known + ");\n"
+                     "    x = " + unknown + ";\n"
+                     "    ifj.write(x);\n"
+                     "}\n";
+
+    auto start = std::chrono::steady_clock::now();
+    ErrorType error = analyseAndCheck(program, [depth](){
+        AST_StatementNode *statement = ASTroot->functionList->body->next;
+
+        // Celý pravý operand se složil do jednoho literálu typu f64
+        AST_BinOpNode *assign = (AST_BinOpNode *)((AST_ExprNode *)statement->statement)->expression;
+        AST_BinOpNode *add = (AST_BinOpNode *)assign->right->expression;
+        ASSERT_EQ(add->right->exprType, AST_EXPR_LITERAL);
+        AST_VarNode *literal = (AST_VarNode *)add->right->expression;
+        ASSERT_EQ(literal->literalType, AST_LITERAL_FLOAT);
+        EXPECT_DOUBLE_EQ(*(double *)literal->value, depth * (depth + 1) / 2 + 0.5);
+
+        // Každý celočíselný literál v součtu byl převeden na f64
+        statement = statement->next;
+        assign = (AST_BinOpNode *)((AST_ExprNode *)statement->statement)->expression;
+        AST_ExprNode *expr = assign->right;
+        for(int i = depth; i >= 1; i--) {
+            ASSERT_EQ(expr->exprType, AST_EXPR_BINARY_OP);
+            add = (AST_BinOpNode *)expr->expression;
+            literal = (AST_VarNode *)add->right->expression;
+            ASSERT_EQ(literal->literalType, AST_LITERAL_FLOAT);
+            EXPECT_DOUBLE_EQ(*(double *)literal->value, i);
+            expr = add->left;
+        }
+    });
+    std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+    EXPECT_EQ(error, SUCCESS);
+
+    cerr << "[ BENCH    ] analýza výrazů hloubky " << depth << ": "
+         << duration.count() << " ms" << endl;
+}
@@ -60,8 +60,10 @@ TEST(NoTable, SymDelAll) {
     ASSERT_NE(map, nullptr);
 
     symtable_deleteAll(map, true);
+    EXPECT_EQ(map->itemCount, 0u);
 
     free(map->array);
+    free(map->order);
     free(map);
 }
 
@@ -336,6 +338,7 @@ TEST(Table, SymDelALL) {
 
      // Free bordelu, co jsem s i v testu vytvořil
      free(map->array);
+     free(map->order);
      free(map);
      DString_free(horseVal);
 }
@@ -638,4 +641,43 @@ TEST(Table, FunctionData) {
     DString_free(g);
     DString_free(h);
     DString_free(i);
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Testuje, že pole `order` obsahuje živé položky v pořadí vložení
+ *        i po rozšíření tabulky a odstranění položky
+ */
+TEST(Table, InsertionOrder)
+{
+    SymtablePtr map = symtable_init();
+    ASSERT_NE(map, nullptr);
+
+    // Vložíme více položek, než je počáteční velikost tabulky
+    const size_t count = 4 * TABLE_INIT_SIZE;
+    for(size_t n = 0; n < count; n++) {
+        DString *key = DString_constCharToDString(("sym" + to_string(n)).c_str());
+        ASSERT_EQ(symtable_addItem(map, key, NULL), SYMTABLE_SUCCESS);
+        DString_free(key);
+    }
+    ASSERT_GT(map->allocatedSize, (size_t)TABLE_INIT_SIZE);
+    ASSERT_EQ(map->itemCount, count);
+
+    // Odstraníme položku ze středu
+    DString *deleted = DString_constCharToDString("sym7");
+    ASSERT_EQ(symtable_deleteItem(map, deleted), SYMTABLE_SUCCESS);
+    DString_free(deleted);
+    ASSERT_EQ(map->itemCount, count - 1);
+
+    // Ostatní položky zůstanou v pořadí vložení
+    size_t expected = 0;
+    for(size_t n = 0; n < map->itemCount; n++, expected++) {
+        if(expected == 7) {
+            expected++;
+        }
+        SymtableItem *item = &map->array[map->order[n]];
+        string key = "sym" + to_string(expected);
+        EXPECT_EQ(DString_compareWithConstChar(item->key, key.c_str()), STRING_EQUAL);
+    }
+
+    symtable_destroyTable(map);
+}
@@ -25,6 +25,12 @@
  *          Google Test.
  */
 
+#include <cmath>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <thread>
+#include <unistd.h>
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 
@@ -163,3 +169,820 @@ TEST(TAC, generate_example2) {
     stdin = stdinBackup;
     fclose(f);
 }
+
+/**
+ * @brief Testuje, že se vypíše pouze kód použitých vestavěných funkcí
+ */
+TEST(TAC, builtInFunctions_onlyUsed) {
+    // Žádná vestavěná funkce není použita
+    TAC_builtInReset();
+    CaptureStdout();
+    TAC_builtInFunctions();
+    EXPECT_EQ(GetCapturedStdout(), "");
+
+    // Použijeme pouze ifj.strcmp (funkce bez podprogramu se ignorují)
+    TAC_builtInMarkUsed("strcmp");
+    TAC_builtInMarkUsed("length");
+    CaptureStdout();
+    TAC_builtInFunctions();
+    string output = GetCapturedStdout();
+    EXPECT_NE(output.find("LABEL $$ifj$strcmp\n"), string::npos);
+    EXPECT_EQ(output.find("LABEL $$ifj$substring\n"), string::npos);
+    EXPECT_EQ(output.find("LABEL $$ifj$ord\n"), string::npos);
+
+    // Kód neobsahuje odsazení ani prázdné řádky
+    EXPECT_EQ(output.find("\n\n"), string::npos);
+    EXPECT_EQ(output.find("\n "), string::npos);
+
+    TAC_builtInReset();
+}
+
+/**
+ * @brief Testuje, že se volání `ifj.ord` generuje přímo v místě volání
+ */
+TEST(TAC, generate_ordInline) {
+    char program[] = "const ifj = @import(\"ifj24.zig\");\n"
+                     "pub fn main() void {\n"
+                     "    const s = ifj.string(\"abc\");\n"
+                     "    const a = ifj.ord(s, 1);\n"
+                     "    ifj.write(a);\n"
+                     "    const b = ifj.ord(s, a);\n"
+                     "    ifj.write(b);\n"
+                     "}\n";
+    FILE* f = fmemopen(program, strlen(program), "r");
+    ASSERT_NE(f, nullptr);
+    FILE* stdinBackup = stdin;
+    stdin = f;
+
+    frameStack_init();
+    LLparser_parseProgram();
+    semantic_analyseProgram();
+
+    CaptureStdout();
+    TAC_generateProgram();
+    string output = GetCapturedStdout();
+
+    // Žádné volání podprogramu, návěští jsou pro každé volání unikátní
+    EXPECT_EQ(output.find("CALL $$ifj$ord"), string::npos);
+    EXPECT_EQ(output.find("LABEL $$ifj$ord"), string::npos);
+    EXPECT_NE(output.find("STRI2INT GF@?tempDEST GF@?tempSRC1 GF@?tempSRC2"), string::npos);
+    EXPECT_NE(output.find("LABEL ord_zero$main$0\n"), string::npos);
+    EXPECT_NE(output.find("LABEL ord_zero$main$1\n"), string::npos);
+
+    // Uvolnění alokovaných zdrojů
+    IFJ24Compiler_freeAllAllocatedMemory();
+
+    // Navrácení STDIN do původního stavu a uzavření souboru
+    stdin = stdinBackup;
+    fclose(f);
+}
+
+/**
+ * @brief Testuje vkládání malých listových funkcí do místa volání
+ */
+TEST(TAC, generate_inlineLeafFunction) {
+    char program[] = "const ifj = @import(\"ifj24.zig\");\n"
+                     "pub fn add(a: i32, b: i32) i32 {\n"
+                     "    return a + b * 2;\n"
+                     "}\n"
+                     "pub fn dec(n: i32) i32 {\n"
+                     "    if (n > 0) {\n"
+                     "        return dec(n - 1);\n"
+                     "    } else {\n"
+                     "        return n;\n"
+                     "    }\n"
+                     "}\n"
+                     "pub fn main() void {\n"
+                     "    var x: i32 = 5;\n"
+                     "    x = add(x, 3);\n"
+                     "    const y = dec(x);\n"
+                     "    ifj.write(y);\n"
+                     "}\n";
+    FILE* f = fmemopen(program, strlen(program), "r");
+    ASSERT_NE(f, nullptr);
+    FILE* stdinBackup = stdin;
+    stdin = f;
+
+    frameStack_init();
+    LLparser_parseProgram();
+    semantic_analyseProgram();
+    ASTinliner_inlineProgram();
+
+    CaptureStdout();
+    TAC_generateProgram();
+    string output = GetCapturedStdout();
+
+    // Funkce add je vložena, rekurzivní funkce dec se volá
+    EXPECT_EQ(output.find("CALL $$add"), string::npos);
+    EXPECT_NE(output.find("CALL $$dec"), string::npos);
+
+    // Parametry jsou nahrazeny argumenty volání
+    EXPECT_NE(output.find("PUSHS int@3"), string::npos);
+    EXPECT_EQ(output.find("TF@a$"), string::npos);
+
+    // Uvolnění alokovaných zdrojů
+    IFJ24Compiler_freeAllAllocatedMemory();
+
+    // Navrácení STDIN do původního stavu a uzavření souboru
+    stdin = stdinBackup;
+    fclose(f);
+}
+
+/**
+ * @brief Testuje nahrazení koncové rekurze skokem na začátek funkce
+ */
+TEST(TAC, generate_selfTailCall) {
+    string path = examPath + "test_tail_recursion.zig";
+    FILE* f = fopen(path.c_str(), "r");
+    ASSERT_NE(f, nullptr);
+    FILE* stdinBackup = stdin;
+    stdin = f;
+
+    frameStack_init();
+    LLparser_parseProgram();
+    semantic_analyseProgram();
+
+    CaptureStdout();
+    TAC_generateProgram();
+    string output = GetCapturedStdout();
+
+    // Tělo funkce count se nevolá rekurzivně, ale skáče na svůj začátek
+    size_t start = output.find("LABEL $$count\n");
+    size_t end = output.find("LABEL $$main\n");
+    ASSERT_NE(start, string::npos);
+    ASSERT_NE(end, string::npos);
+    string body = output.substr(start, end - start);
+    EXPECT_EQ(body.find("CALL $$count"), string::npos);
+    EXPECT_EQ(body.find("CREATEFRAME"), string::npos);
+    EXPECT_NE(body.find("JUMP $$count$tail\n"), string::npos);
+
+    // Proměnné jsou definovány před návěštím, aby se DEFVAR neopakoval
+    size_t label = body.find("LABEL $$count$tail\n");
+    ASSERT_NE(label, string::npos);
+    EXPECT_LT(body.find("DEFVAR LF@next$"), label);
+    EXPECT_EQ(body.find("DEFVAR", label), string::npos);
+
+    // Volání z funkce main zůstává
+    EXPECT_NE(output.find("CALL $$count"), string::npos);
+
+    // Uvolnění alokovaných zdrojů
+    IFJ24Compiler_freeAllAllocatedMemory();
+
+    // Navrácení STDIN do původního stavu a uzavření souboru
+    stdin = stdinBackup;
+    fclose(f);
+}
+
+/**
+ * @brief Testuje cyklus while s NULL podmínkou v těle funkce s koncovou
+ *        rekurzí a ve vnořeném cyklu, kde se proměnná bez null definuje
+ *        již v nadřazeném bloku
+ */
+TEST(TAC, generate_nullWhileWithoutVarDef) {
+    const char *files[] = { "test_tail_recursion_null_while.zig",
+                            "test_nested_null_while.zig" };
+    for(const char *file : files) {
+        string path = examPath + file;
+        FILE* f = fopen(path.c_str(), "r");
+        ASSERT_NE(f, nullptr);
+        FILE* stdinBackup = stdin;
+        stdin = f;
+
+        frameStack_init();
+        LLparser_parseProgram();
+        semantic_analyseProgram();
+
+        CaptureStdout();
+        TAC_generateProgram();
+        string output = GetCapturedStdout();
+
+        // Proměnná bez null je definována právě jednou a cyklus do ní přesouvá
+        size_t defvar = output.find("DEFVAR LF@v$");
+        ASSERT_NE(defvar, string::npos) << file;
+        EXPECT_EQ(output.find("DEFVAR LF@v$", defvar + 1), string::npos) << file;
+        EXPECT_NE(output.find("MOVE LF@v$"), string::npos) << file;
+
+        // Uvolnění alokovaných zdrojů
+        IFJ24Compiler_freeAllAllocatedMemory();
+
+        // Navrácení STDIN do původního stavu a uzavření souboru
+        stdin = stdinBackup;
+        fclose(f);
+    }
+}
+
+/**
+ * @brief Testuje, že hexadecimální zápis f64 odpovídá formátu "%a"
+ */
+TEST(TAC, formatHexFloat) {
+    vector<double> values = { 0.0, -0.0, 1.0, -1.0, 0.5, 0.1, 3.0, 2.5, 1e300, 1e-300,
+                              5e-324, 2.2250738585072014e-308, 1.7976931348623157e308,
+                              123456789.0, 1.0 / 3.0 };
+
+    // Doplníme náhodné bitové vzory včetně denormalizovaných čísel
+    srand(17);
+    for(int i = 0; i < 2000; i++) {
+        uint64_t bits = ((uint64_t)rand() << 40) ^ ((uint64_t)rand() << 20) ^ (uint64_t)rand();
+        bits ^= (uint64_t)(rand() % 4096) << 52;
+        double value;
+        memcpy(&value, &bits, sizeof(value));
+        if(!isnan(value) && !isinf(value)) {
+            values.push_back(value);
+        }
+    }
+
+    for(double value : values) {
+        char expected[NUMBER_HEX_FLOAT_SIZE];
+        char actual[NUMBER_HEX_FLOAT_SIZE];
+        snprintf(expected, sizeof(expected), "%a", value);
+        size_t length = numberLiteral_formatHexFloat(value, actual);
+        EXPECT_STREQ(actual, expected);
+        EXPECT_EQ(length, strlen(expected));
+    }
+}
+
+
+/**
+ * @brief Cesta k dočasnému souboru se serializovaným AST.
+ */
+const string serializedAstPath = string(P_tmpdir) + "/ifj24_ast_serializer_test.ast";
+
+/**
+ * @brief Provede syntaktickou a sémantickou analýzu příkladu a uloží jeho AST.
+ *
+ * @param [in] name Název souboru příkladu bez přípony
+ *
+ * @return `true`, pokud se AST podařilo uložit, jinak `false`.
+ */
+static bool analyseAndSaveExample(const string &name) {
+    string path = examPath + name + ".zig";
+    FILE* f = fopen(path.c_str(), "r");
+    if(f == nullptr) {
+        return false;
+    }
+    FILE* stdinBackup = stdin;
+    stdin = f;
+
+    frameStack_init();
+    LLparser_parseProgram();
+    semantic_analyseProgram();
+    bool saved = ASTserializer_saveProgram(serializedAstPath.c_str(), 1, 2);
+
+    stdin = stdinBackup;
+    fclose(f);
+
+    return saved;
+}
+
+/**
+ * @brief Spustí vkládání funkcí a generování kódu a vrátí vygenerovaný kód.
+ */
+static string generateCode() {
+    ASTinliner_inlineProgram();
+    CaptureStdout();
+    TAC_generateProgram();
+    return GetCapturedStdout();
+}
+
+/**
+ * @brief Testuje, že kód z načteného AST odpovídá kódu z původního AST
+ */
+TEST(TAC, serializedAstRoundTrip) {
+    vector<string> examples = {
+        "big_test", "big_test2", "big_testFUNEXP", "escape_and_hexa", "example1",
+        "example2", "example3", "fun", "hello", "multiline", "string_testFUNEXP",
+        "string_test_complexFUNEXP", "test_1", "test_17", "test_2", "test_3", "test_4",
+        "test_5", "test_6", "test_7", "test_8", "test_builtin", "test_definedvar2",
+        "test_expression", "test_hodyhodydejtebodyFUNEXP", "test_i32_retype",
+        "test_multiline", "test_ord", "test_raytrace", "test_substring",
+        "test_tail_recursion"
+    };
+
+    for(const string &name : examples) {
+        SCOPED_TRACE(name);
+        ASSERT_TRUE(analyseAndSaveExample(name));
+        string expected = generateCode();
+        IFJ24Compiler_freeAllAllocatedMemory();
+
+        ASSERT_TRUE(ASTserializer_loadProgram(serializedAstPath.c_str(), 1, 2));
+        ASSERT_NE(ASTroot, nullptr);
+        string actual = generateCode();
+        IFJ24Compiler_freeAllAllocatedMemory();
+
+        EXPECT_EQ(actual, expected);
+    }
+
+    remove(serializedAstPath.c_str());
+}
+
+/**
+ * @brief Testuje, že se soubor pro jiný vstup nebo poškozený soubor nenačte
+ */
+TEST(TAC, serializedAstRejected) {
+    ASSERT_TRUE(analyseAndSaveExample("example1"));
+    IFJ24Compiler_freeAllAllocatedMemory();
+
+    // Načteme obsah souboru pro vytváření poškozených kopií
+    FILE* f = fopen(serializedAstPath.c_str(), "rb");
+    ASSERT_NE(f, nullptr);
+    string original;
+    char chunk[4096];
+    size_t read;
+    while((read = fread(chunk, 1, sizeof(chunk), f)) > 0) {
+        original.append(chunk, read);
+    }
+    fclose(f);
+    ASSERT_GT(original.size(), sizeof(ASTserializer_Header));
+
+    auto loadModified = [&](const string &content, uint64_t hash, uint64_t length) {
+        FILE* out = fopen(serializedAstPath.c_str(), "wb");
+        fwrite(content.data(), 1, content.size(), out);
+        fclose(out);
+        return ASTserializer_loadProgram(serializedAstPath.c_str(), hash, length);
+    };
+
+    // Po úpravě uzlů přepočítáme kontrolní součet, aby soubor odmítlo až ověření uzlů
+    auto sealed = [](string content) {
+        uint64_t checksum = ASTserializer_checksum(AST_SERIALIZER_CHECKSUM_BASIS,
+                                                   &content[sizeof(ASTserializer_Header)],
+                                                   content.size() - sizeof(ASTserializer_Header));
+        memcpy(&content[offsetof(ASTserializer_Header, checksum)], &checksum, sizeof(checksum));
+        return content;
+    };
+    auto nodeOffset = [](size_t index, size_t member) {
+        return sizeof(ASTserializer_Header) + index * sizeof(ASTserializer_Node) + member;
+    };
+
+    // Soubor jiného vstupu
+    EXPECT_FALSE(loadModified(original, 3, 2));
+    EXPECT_FALSE(loadModified(original, 1, 3));
+
+    // Zkrácený soubor a soubor s daty navíc
+    EXPECT_FALSE(loadModified(original.substr(0, original.size() - 1), 1, 2));
+    EXPECT_FALSE(loadModified(original + "x", 1, 2));
+
+    // Změněný bajt bez přepočítaného kontrolního součtu
+    string corrupted = original;
+    corrupted[original.size() - 1] ^= 0x01;
+    EXPECT_FALSE(loadModified(corrupted, 1, 2));
+
+    // Potomek kořene odkazuje zpět na kořen
+    string cyclic = original;
+    uint32_t zero = 0;
+    memcpy(&cyclic[nodeOffset(0, offsetof(ASTserializer_Node, child[1]))], &zero, sizeof(zero));
+    EXPECT_FALSE(loadModified(sealed(cyclic), 1, 2));
+
+    // Uzel se dvěma rodiči (oba potomci kořene odkazují na první funkci)
+    string shared = original;
+    uint32_t function = 0;
+    memcpy(&function, &shared[nodeOffset(0, offsetof(ASTserializer_Node, child[1]))],
+           sizeof(function));
+    memcpy(&shared[nodeOffset(0, offsetof(ASTserializer_Node, child[0]))], &function,
+           sizeof(function));
+    EXPECT_FALSE(loadModified(sealed(shared), 1, 2));
+
+    // Identifikátor mimo tabulku řetězců
+    string outside = original;
+    uint32_t offset = UINT32_MAX - 1;
+    memcpy(&outside[nodeOffset(1, offsetof(ASTserializer_Node, identifier))], &offset,
+           sizeof(offset));
+    EXPECT_FALSE(loadModified(sealed(outside), 1, 2));
+
+    // Příznaky, které typ uzlu nepřipouští (importovaný soubor je literál s hodnotou)
+    string flags = original;
+    flags[nodeOffset(1, offsetof(ASTserializer_Node, flags))] = (char)0xE9;
+    EXPECT_FALSE(loadModified(sealed(flags), 1, 2));
+
+    // Příznak vestavěné funkce u definice funkce
+    string builtIn = original;
+    builtIn[nodeOffset(function, offsetof(ASTserializer_Node, flags))] =
+        AST_SERIALIZER_FLAG_BUILT_IN;
+    EXPECT_FALSE(loadModified(sealed(builtIn), 1, 2));
+
+    // Podtyp mimo rozsah typu uzlu
+    string kind = original;
+    kind[nodeOffset(1, offsetof(ASTserializer_Node, kind))] = (char)0x7F;
+    EXPECT_FALSE(loadModified(sealed(kind), 1, 2));
+
+    // Nepoškozený soubor projde i po přepočtu kontrolního součtu
+    EXPECT_TRUE(loadModified(sealed(original), 1, 2));
+    IFJ24Compiler_freeAllAllocatedMemory();
+
+    // Chybějící soubor
+    remove(serializedAstPath.c_str());
+    EXPECT_FALSE(ASTserializer_loadProgram(serializedAstPath.c_str(), 1, 2));
+
+    // Po neúspěšném načtení nezůstane žádný strom ani rámec
+    EXPECT_EQ(ASTroot, nullptr);
+    EXPECT_EQ(frameStack.top, nullptr);
+
+    // Nepoškozený soubor se načte
+    EXPECT_TRUE(loadModified(original, 1, 2));
+    IFJ24Compiler_freeAllAllocatedMemory();
+    remove(serializedAstPath.c_str());
+}
+
+/**
+ * @brief Benchmark načtení AST oproti syntaktické a sémantické analýze.
+ */
+TEST(TAC, serializedAstBenchmark) {
+    const int repeat = 50;
+
+    auto start = std::chrono::steady_clock::now();
+    for(int i = 0; i < repeat; i++) {
+        ASSERT_TRUE(analyseAndSaveExample("test_raytrace"));
+        IFJ24Compiler_freeAllAllocatedMemory();
+    }
+    auto middle = std::chrono::steady_clock::now();
+    for(int i = 0; i < repeat; i++) {
+        ASSERT_TRUE(ASTserializer_loadProgram(serializedAstPath.c_str(), 1, 2));
+        IFJ24Compiler_freeAllAllocatedMemory();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    remove(serializedAstPath.c_str());
+
+    std::chrono::duration<double, std::milli> analysis = middle - start;
+    std::chrono::duration<double, std::milli> loading = end - middle;
+    cerr << "[ BENCH    ] analýza a uložení " << analysis.count() / repeat
+         << " ms, načtení " << loading.count() / repeat << " ms" << endl;
+}
+
+
+/**
+ * @brief Přeloží program s inkrementálním překladem a vrátí vygenerovaný kód.
+ *
+ * @param [in] program Zdrojový kód programu
+ * @param [in] directory Adresář cache funkcí, nebo `nullptr`
+ * @param [out] reused Počet funkcí převzatých z cache
+ */
+static string compileIncremental(const string &program, const char *directory, size_t *reused) {
+    FILE* f = fmemopen((void *)program.data(), program.size(), "r");
+    if(f == nullptr) {
+        return "";
+    }
+    FILE* stdinBackup = stdin;
+    stdin = f;
+
+    frameStack_init();
+    incremental_init(directory);
+    LLparser_parseProgram();
+    incremental_analyseProgram();
+    ASTinliner_inlineProgram();
+
+    CaptureStdout();
+    incremental_generateProgram();
+    string output = GetCapturedStdout();
+    *reused = incremental.reused;
+
+    IFJ24Compiler_freeAllAllocatedMemory();
+    stdin = stdinBackup;
+    fclose(f);
+
+    return output;
+}
+
+/**
+ * @brief Testuje, že se po změně jedné funkce přeloží jen funkce na ní závislé
+ */
+TEST(TAC, incrementalReusesUnchangedFunctions) {
+    filesystem::path dir = filesystem::temp_directory_path() / "ifj24_incremental_test";
+    filesystem::remove_all(dir);
+    filesystem::create_directories(dir);
+
+    const string prolog = "const ifj = @import(\"ifj24.zig\");\n";
+    const string add = "pub fn add(a: i32, b: i32) i32 {\n"
+                       "    return a + b * 2;\n"
+                       "}\n";
+    const string dec = "pub fn dec(n: i32) i32 {\n"
+                       "    if (n > 0) {\n"
+                       "        return dec(n - 1);\n"
+                       "    } else {\n"
+                       "        return n;\n"
+                       "    }\n"
+                       "}\n";
+    const string count = "pub fn count(n: i32) void {\n"
+                         "    var i: i32 = 0;\n"
+                         "    while (i < n) {\n"
+                         "        ifj.write(i);\n"
+                         "        i = i + 1;\n"
+                         "    }\n"
+                         "}\n";
+    const string main = "pub fn main() void {\n"
+                        "    var x: i32 = 5;\n"
+                        "    x = add(x, 3);\n"
+                        "    const y = dec(x);\n"
+                        "    count(y);\n"
+                        "}\n";
+
+    auto check = [&](const string &program, size_t expectedReused) {
+        size_t reused = 0;
+        string expected = compileIncremental(program, nullptr, &reused);
+        string actual = compileIncremental(program, dir.c_str(), &reused);
+        EXPECT_EQ(actual, expected);
+        EXPECT_EQ(reused, expectedReused);
+    };
+
+    // Studená cache, poté se převezmou všechny funkce
+    {
+        SCOPED_TRACE("cold");
+        check(prolog + add + dec + count + main, 0);
+    }
+    {
+        SCOPED_TRACE("warm");
+        check(prolog + add + dec + count + main, 4);
+    }
+
+    // Bílé znaky a komentáře klíč nemění
+    {
+        SCOPED_TRACE("whitespace");
+        check(prolog + "// komentar\n" + add + "\n\n" + dec + count + main, 4);
+    }
+
+    // Změna těla volané funkce mění klíč volajících, protože o vložení
+    // funkce do místa volání se rozhodne až po sémantické analýze
+    const string dec2 = "pub fn dec(n: i32) i32 {\n"
+                        "    if (n > 1) {\n"
+                        "        return dec(n - 2);\n"
+                        "    } else {\n"
+                        "        return n;\n"
+                        "    }\n"
+                        "}\n";
+    {
+        SCOPED_TRACE("dec body");
+        check(prolog + add + dec2 + count + main, 2);
+    }
+
+    // Tělo vložené funkce je součástí kódu volající funkce main
+    const string add2 = "pub fn add(a: i32, b: i32) i32 {\n"
+                        "    return a - b;\n"
+                        "}\n";
+    {
+        SCOPED_TRACE("inlined body");
+        check(prolog + add2 + dec2 + count + main, 2);
+    }
+
+    // Změna signatury funkce mění klíč volající funkce main
+    const string count2 = "pub fn count(m: i32) void {\n"
+                          "    var i: i32 = 0;\n"
+                          "    while (i < m) {\n"
+                          "        ifj.write(i);\n"
+                          "        i = i + 1;\n"
+                          "    }\n"
+                          "}\n";
+    {
+        SCOPED_TRACE("signature");
+        check(prolog + add2 + dec2 + count2 + main, 2);
+    }
+
+    // Pořadí funkcí kód neovlivňuje
+    {
+        SCOPED_TRACE("reordered");
+        check(prolog + main + count2 + dec2 + add2, 4);
+    }
+
+    filesystem::remove_all(dir);
+}
+
+/**
+ * @brief Testuje cache funkce, kterou lze vložit až po skládání konstant
+ */
+TEST(TAC, incrementalFoldedCallee) {
+    filesystem::path dir = filesystem::temp_directory_path() / "ifj24_incremental_folded_test";
+    filesystem::remove_all(dir);
+    filesystem::create_directories(dir);
+
+    // Výraz má před složením příliš mnoho uzlů na vložení do místa volání
+    auto program = [](const string &last, const string &extra) {
+        return "const ifj = @import(\"ifj24.zig\");\n"
+               "pub fn k() i32 {\n"
+               "    return 1 + 1 + 1 + 1 + 1 + 1 + 1 + 1 + 1 + " + last + ";\n"
+               "}\n"
+               "pub fn main() void {\n"
+               "    const r = k();\n"
+               "    ifj.write(r);\n" + extra +
+               "}\n";
+    };
+    auto check = [&](const string &source) {
+        size_t reused = 0;
+        string expected = compileIncremental(source, nullptr, &reused);
+        string actual = compileIncremental(source, dir.c_str(), &reused);
+        EXPECT_EQ(actual, expected);
+    };
+
+    {
+        SCOPED_TRACE("cold");
+        check(program("1", ""));
+    }
+
+    // Změna vložené funkce se musí projevit ve volající funkci
+    {
+        SCOPED_TRACE("callee");
+        check(program("7", ""));
+    }
+
+    // Funkce z cache se do změněné volající funkce vloží stejně jako bez cache
+    {
+        SCOPED_TRACE("caller");
+        check(program("7", "    ifj.write(2);\n"));
+    }
+
+    filesystem::remove_all(dir);
+}
+
+/**
+ * @brief Testuje cache funkce, kterou lze vložit až po vypuštění definice konstanty
+ */
+TEST(TAC, incrementalPropagatedCallee) {
+    filesystem::path dir = filesystem::temp_directory_path() / "ifj24_incremental_propagated_test";
+    filesystem::remove_all(dir);
+    filesystem::create_directories(dir);
+
+    // Před analýzou má tělo funkce k dva příkazy
+    auto program = [](const string &value) {
+        return "const ifj = @import(\"ifj24.zig\");\n"
+               "pub fn k() i32 {\n"
+               "    const a = " + value + ";\n"
+               "    return a + 1;\n"
+               "}\n"
+               "pub fn main() void {\n"
+               "    const r = k();\n"
+               "    ifj.write(r);\n"
+               "}\n";
+    };
+
+    for(const char *value : { "5", "40" }) {
+        SCOPED_TRACE(value);
+        size_t reused = 0;
+        string expected = compileIncremental(program(value), nullptr, &reused);
+        EXPECT_EQ(compileIncremental(program(value), dir.c_str(), &reused), expected);
+    }
+
+    filesystem::remove_all(dir);
+}
+
+/**
+ * @brief Testuje, že se poškozený soubor funkce nepoužije
+ */
+TEST(TAC, incrementalRejectsCorruptedEntry) {
+    filesystem::path dir = filesystem::temp_directory_path() / "ifj24_incremental_corrupt_test";
+    filesystem::remove_all(dir);
+    filesystem::create_directories(dir);
+
+    const string program = "const ifj = @import(\"ifj24.zig\");\n"
+                           "pub fn main() void {\n"
+                           "    ifj.write(1);\n"
+                           "}\n";
+
+    size_t reused = 0;
+    string expected = compileIncremental(program, nullptr, &reused);
+    EXPECT_EQ(compileIncremental(program, dir.c_str(), &reused), expected);
+
+    // Zkrátíme uložený kód funkce
+    for(const auto &entry : filesystem::directory_iterator(dir)) {
+        filesystem::resize_file(entry.path(), filesystem::file_size(entry.path()) - 1);
+    }
+
+    EXPECT_EQ(compileIncremental(program, dir.c_str(), &reused), expected);
+    EXPECT_EQ(reused, 0u);
+
+    // Soubor se při překladu opravil
+    EXPECT_EQ(compileIncremental(program, dir.c_str(), &reused), expected);
+    EXPECT_EQ(reused, 1u);
+
+    filesystem::remove_all(dir);
+}
+
+
+/**
+ * @brief Vygeneruje program s daným počtem funkcí volajících se v řetězci
+ */
+static string generateFunctionsProgram(int count) {
+    string program = "const ifj = @import(\"ifj24.zig\");\n";
+    for(int i = 0; i < count; i++) {
+        string call = i == 0 ? "x - 1" : "fun" + to_string(i - 1) + "(x)";
+        program += "pub fn fun" + to_string(i) + "(a: i32) i32 {\n"
+                   "    var x: i32 = a + " + to_string(i) + ";\n"
+                   "    const s = ifj.string(\"a b\");\n"
+                   "    const o = ifj.ord(s, 1);\n"
+                   "    while (x > 100) {\n"
+                   "        x = x / 2;\n"
+                   "    }\n"
+                   "    if (ifj.strcmp(s, s) == 0) {\n"
+                   "        x = x + o;\n"
+                   "    } else {\n"
+                   "        x = x * 2;\n"
+                   "    }\n"
+                   "    const y = " + call + ";\n"
+                   "    return y;\n"
+                   "}\n";
+    }
+    program += "pub fn main() void {\n"
+               "    const r = fun" + to_string(count - 1) + "(1);\n"
+               "    ifj.write(r);\n"
+               "}\n";
+    return program;
+}
+
+/**
+ * @brief Testuje, že paralelní generování vypíše stejný kód jako sekvenční
+ */
+TEST(TAC, parallelGenerationMatchesSequential) {
+    string program = generateFunctionsProgram(2 * TAC_PARALLEL_THRESHOLD);
+
+    size_t reused = 0;
+    setenv(TAC_THREADS_ENV, "1", 1);
+    string sequential = compileIncremental(program, nullptr, &reused);
+    setenv(TAC_THREADS_ENV, "8", 1);
+    string parallel = compileIncremental(program, nullptr, &reused);
+    unsetenv(TAC_THREADS_ENV);
+
+    // Návěští jsou vázána na funkci, pořadí generování je proto nepodstatné
+    EXPECT_EQ(parallel, sequential);
+    EXPECT_NE(sequential.find("LABEL while_start$fun0$0\n"), string::npos);
+    EXPECT_NE(sequential.find("LABEL $$ifj$strcmp\n"), string::npos);
+}
+
+/**
+ * @brief Přeloží program a vygeneruje kód na STDOUT, případně přes vlákno výpisu
+ *
+ * @return Doba generování kódu včetně dokončení výpisu v ms
+ */
+static double generateWithWriter(const string &program, const char *setting) {
+    FILE* f = fmemopen((void *)program.data(), program.size(), "r");
+    FILE* stdinBackup = stdin;
+    stdin = f;
+
+    frameStack_init();
+    LLparser_parseProgram();
+    semantic_analyseProgram();
+    ASTinliner_inlineProgram();
+
+    auto start = std::chrono::steady_clock::now();
+    outputWriter_init(setting, stdout);
+    TAC_generateProgram();
+    EXPECT_TRUE(outputWriter_finish());
+    fflush(stdout);
+    std::chrono::duration<double, std::milli> duration = std::chrono::steady_clock::now() - start;
+
+    IFJ24Compiler_freeAllAllocatedMemory();
+    stdin = stdinBackup;
+    fclose(f);
+
+    return duration.count();
+}
+
+/**
+ * @brief Testuje, že vlákno výpisu vypíše stejný kód jako přímý výpis
+ */
+TEST(TAC, asyncOutputMatchesDirect) {
+    // Kód je delší než jeden blok výstupu, vystřídají se tedy oba bloky
+    string program = generateFunctionsProgram(1500);
+
+    CaptureStdout();
+    generateWithWriter(program, "0");
+    string direct = GetCapturedStdout();
+
+    CaptureStdout();
+    generateWithWriter(program, "1");
+    string async = GetCapturedStdout();
+
+    EXPECT_GT(direct.size(), (size_t)OUTPUT_WRITER_CHUNK_SIZE);
+    EXPECT_EQ(async, direct);
+}
+
+/**
+ * @brief Benchmark výpisu do pomalého čtenáře roury s vláknem výpisu a bez něj
+ */
+TEST(TAC, asyncOutputBenchmark) {
+    string program = generateFunctionsProgram(1500);
+    double times[2];
+
+    for(int async = 0; async < 2; async++) {
+        int fds[2];
+        ASSERT_EQ(pipe(fds), 0);
+
+        // Čtenář odebírá data po 64 KiB s prodlevou, jako pomalý konzument
+        std::thread reader([fd = fds[0]]() {
+            vector<char> buffer(64 * 1024);
+            while(read(fd, buffer.data(), buffer.size()) > 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            }
+            close(fd);
+        });
+
+        fflush(stdout);
+        int stdoutBackup = dup(STDOUT_FILENO);
+        dup2(fds[1], STDOUT_FILENO);
+        close(fds[1]);
+
+        times[async] = generateWithWriter(program, async ? "1" : "0");
+
+        dup2(stdoutBackup, STDOUT_FILENO);
+        close(stdoutBackup);
+        reader.join();
+    }
+
+    cerr << "[ BENCH    ] výpis do pomalé roury: přímo " << times[0]
+         << " ms, vláknem výpisu " << times[1] << " ms" << endl;
+}
@@ -0,0 +1,15 @@
+// Cyklus while s NULL podmínkou vnořený v jiném cyklu while
+const ifj = @import("ifj24.zig");
+
+pub fn main() void {
+    var i: i32 = 0;
+    while (i < 3) {
+        var x: ?i32 = i;
+        while (x) |v| {
+            ifj.write(v);
+            x = null;
+        }
+        i = i + 1;
+    }
+    ifj.write("\n");
+}
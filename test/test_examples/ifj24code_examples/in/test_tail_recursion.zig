@@ -0,0 +1,17 @@
+// Koncová rekurze s velkou hloubkou zanoření
+const ifj = @import("ifj24.zig");
+
+pub fn count(n: i32, acc: i32) i32 {
+    if (n == 0) {
+        return acc;
+    } else {
+        const next = n - 1;
+        return count(next, acc + 1);
+    }
+}
+
+pub fn main() void {
+    const result = count(200000, 0);
+    ifj.write(result);
+    ifj.write("\n");
+}
@@ -0,0 +1,21 @@
+// Koncová rekurze ve funkci s cyklem while s NULL podmínkou
+const ifj = @import("ifj24.zig");
+
+pub fn loop(n: i32) i32 {
+    var a: ?i32 = n;
+    while (a) |v| {
+        ifj.write(v);
+        a = null;
+    }
+    if (n == 0) {
+        return 0;
+    } else {
+    }
+    return loop(n - 1);
+}
+
+pub fn main() void {
+    const result = loop(3);
+    ifj.write(result);
+    ifj.write("\n");
+}